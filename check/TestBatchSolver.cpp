@@ -0,0 +1,166 @@
+#include <chrono>
+#include <cmath>
+
+#include "HCheckConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+#include "lp_data/HighsBatchSolver.h"
+
+const bool dev_run = false;
+
+// Changes to some of the costs and row bounds of an LP, that differ
+// with k
+static HighsBatchDelta batchDelta(const HighsLp& lp, const HighsInt k) {
+  HighsBatchDelta delta;
+  for (HighsInt iCol = k % 3; iCol < lp.num_col_; iCol += 3) {
+    delta.cost_index.push_back(iCol);
+    delta.cost_value.push_back(lp.col_cost_[iCol] *
+                               (1 + 0.05 * ((k + iCol) % 5 - 2)));
+  }
+  for (HighsInt iRow = k % 4; iRow < lp.num_row_; iRow += 4) {
+    const double scale = 1 + 0.01 * ((k + iRow) % 3);
+    delta.row_index.push_back(iRow);
+    delta.row_lower.push_back(lp.row_lower_[iRow] * scale);
+    delta.row_upper.push_back(lp.row_upper_[iRow] * scale);
+  }
+  return delta;
+}
+
+// Solve a model defined by a delta with a fresh Highs instance
+static void solveDelta(const HighsLp& lp, const HighsBatchDelta& delta,
+                       HighsModelStatus& model_status, double& objective) {
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  highs.passModel(lp);
+  highs.changeColsCost(delta.cost_index.size(), delta.cost_index.data(),
+                       delta.cost_value.data());
+  highs.changeRowsBounds(delta.row_index.size(), delta.row_index.data(),
+                         delta.row_lower.data(), delta.row_upper.data());
+  highs.run();
+  model_status = highs.getModelStatus();
+  objective = highs.getInfo().objective_function_value;
+}
+
+static bool sameResult(const HighsModelStatus model_status,
+                       const double objective,
+                       const HighsBatchResult& result) {
+  if (result.model_status != model_status) return false;
+  if (model_status != HighsModelStatus::kOptimal) return true;
+  return std::fabs(result.info.objective_function_value - objective) <=
+         1e-7 * std::max(1.0, std::fabs(objective));
+}
+
+TEST_CASE("batch-solver", "[highs_batch_solver]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+  const HighsLp lp = highs.getLp();
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/flugpl.mps");
+  const HighsLp mip = highs.getLp();
+
+  Highs::resetGlobalScheduler(true);
+  HighsBatchSolver batch;
+  REQUIRE(batch.setOptionValue("threads", 2) == HighsStatus::kOk);
+  REQUIRE(batch.setOptionValue("no_such_option", 2) == HighsStatus::kError);
+  const HighsInt num_delta = 12;
+  const HighsInt lp_id = batch.addModel(lp);
+  const HighsInt mip_id = batch.addModel(mip);
+  std::vector<HighsBatchDelta> delta;
+  std::vector<HighsInt> delta_id;
+  for (HighsInt k = 0; k < num_delta; k++) {
+    delta.push_back(batchDelta(lp, k));
+    delta_id.push_back(batch.addModelDelta(lp_id, delta[k]));
+    REQUIRE(delta_id[k] >= 0);
+  }
+  // A model with the same structure as the LP, but different costs
+  HighsLp lp_copy = lp;
+  for (double& cost : lp_copy.col_cost_) cost *= 2;
+  const HighsInt lp_copy_id = batch.addModel(lp_copy);
+  // Deltas must be of a model, and be consistent with it
+  REQUIRE(batch.addModelDelta(delta_id[0], delta[1]) == -1);
+  HighsBatchDelta bad_delta;
+  bad_delta.cost_index.push_back(lp.num_col_);
+  bad_delta.cost_value.push_back(1);
+  REQUIRE(batch.addModelDelta(lp_id, bad_delta) == -1);
+  REQUIRE(batch.getNumQueued() == num_delta + 3);
+
+  std::vector<HighsBatchResult> results(num_delta + 3);
+  REQUIRE(batch.run([&results](const HighsBatchResult& result) {
+    results[result.id] = result;
+  }) == HighsStatus::kOk);
+  REQUIRE(batch.getNumQueued() == 0);
+  REQUIRE(batch.getResults().empty());
+
+  REQUIRE(results[lp_id].model_status == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(results[lp_id].info.objective_function_value -
+                    2.2549496316e+05) < 1e-2);
+  REQUIRE(results[lp_id].basis.valid);
+  REQUIRE(results[mip_id].model_status == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(results[mip_id].info.objective_function_value -
+                    1201500) < 1e-6);
+  REQUIRE(results[lp_copy_id].model_status == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(results[lp_copy_id].info.objective_function_value -
+                    2 * 2.2549496316e+05) < 2e-2);
+  for (HighsInt k = 0; k < num_delta; k++) {
+    HighsModelStatus model_status;
+    double objective;
+    solveDelta(lp, delta[k], model_status, objective);
+    REQUIRE(results[delta_id[k]].id == delta_id[k]);
+    REQUIRE(sameResult(model_status, objective, results[delta_id[k]]));
+  }
+
+  // Models remain available as the base for deltas, and results are
+  // kept if there is no callback
+  const HighsInt next_id = batch.addModelDelta(lp_id, delta[0]);
+  REQUIRE(next_id == num_delta + 3);
+  REQUIRE(batch.run() == HighsStatus::kOk);
+  REQUIRE(batch.getResults().size() == 1);
+  REQUIRE(batch.getResults()[0].id == next_id);
+  REQUIRE(std::fabs(
+              batch.getResults()[0].info.objective_function_value -
+              results[delta_id[0]].info.objective_function_value) < 1e-6);
+  batch.clear();
+  REQUIRE(batch.addModelDelta(lp_id, delta[0]) == -1);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("batch-solver-throughput", "[highs_batch_solver]") {
+  // Compare the time taken to solve a number of models defined by
+  // changes to one LP with a fresh Highs instance for each, and with
+  // a batch solver
+  const HighsInt num_delta = dev_run ? 2000 : 50;
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+  const HighsLp lp = highs.getLp();
+  std::vector<HighsBatchDelta> delta;
+  for (HighsInt k = 0; k < num_delta; k++) delta.push_back(batchDelta(lp, k));
+
+  std::vector<HighsModelStatus> model_status(num_delta);
+  std::vector<double> objective(num_delta);
+  auto start = std::chrono::steady_clock::now();
+  for (HighsInt k = 0; k < num_delta; k++)
+    solveDelta(lp, delta[k], model_status[k], objective[k]);
+  const double single_time =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+
+  start = std::chrono::steady_clock::now();
+  HighsBatchSolver batch;
+  const HighsInt lp_id = batch.addModel(lp);
+  for (HighsInt k = 0; k < num_delta; k++)
+    batch.addModelDelta(lp_id, delta[k]);
+  REQUIRE(batch.run() == HighsStatus::kOk);
+  const double batch_time =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  const std::vector<HighsBatchResult>& results = batch.getResults();
+  for (HighsInt k = 0; k < num_delta; k++)
+    REQUIRE(sameResult(model_status[k], objective[k], results[1 + k]));
+  if (dev_run)
+    printf(
+        "%d models: %.3fs with single instances (%.0f/s); %.3fs in batch "
+        "(%.0f/s)\n",
+        int(num_delta), single_time, num_delta / single_time, batch_time,
+        num_delta / batch_time);
+}
@@ -12,6 +12,7 @@ const double egout_optimal_objective = 568.1007;
 const double egout_objective_target = 610;
 const HighsInt adlittle_ipm_iteration_limit = 5;
 const HighsInt adlittle_simplex_iteration_limit = 30;
+const HighsInt adlittle_pdlp_iteration_limit = 100;
 
 const HighsInt kLogBufferSize = kIoBufferSize;
 const HighsInt kUserCallbackNoData = -1;
@@ -144,6 +145,16 @@ HighsCallbackFunctionType userInterruptCallback =
                 int(data_out->ipm_iteration_count));
           data_in->user_interrupt =
               data_out->ipm_iteration_count > adlittle_ipm_iteration_limit;
+        } else if (callback_type == kCallbackPdlpInterrupt) {
+          if (dev_run)
+            printf(
+                "userInterruptCallback(type %2d; data %2d): %s with iteration "
+                "count = "
+                "%d\n",
+                callback_type, local_callback_data, message.c_str(),
+                int(data_out->pdlp_iteration_count));
+          data_in->user_interrupt =
+              data_out->pdlp_iteration_count > adlittle_pdlp_iteration_limit;
         } else if (callback_type == kCallbackMipInterrupt) {
           if (dev_run)
             printf(
@@ -294,6 +305,22 @@ TEST_CASE("highs-callback-ipm-interrupt", "[highs-callback]") {
   REQUIRE(highs.getInfo().ipm_iteration_count > adlittle_ipm_iteration_limit);
 }
 
+TEST_CASE("highs-callback-pdlp-interrupt", "[highs-callback]") {
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setCallback(userInterruptCallback);
+  highs.startCallback(kCallbackPdlpInterrupt);
+  highs.readModel(filename);
+  highs.setOptionValue("solver", kPdlpString);
+  HighsStatus status = highs.run();
+  REQUIRE(status == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(highs.getInfo().pdlp_iteration_count >
+          adlittle_pdlp_iteration_limit);
+}
+
 TEST_CASE("highs-callback-mip-interrupt", "[highs-callback]") {
   std::string filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
   Highs highs;
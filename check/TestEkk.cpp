@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <cmath>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
 #include "lp_data/HConst.h"
+#include "util/HighsRandom.h"
 
 const bool dev_run = false;
 
@@ -92,3 +96,246 @@ TEST_CASE("EkkPrimal-all", "[highs_test_ekk]") {
   ekk_distillation(highs);
   ekk_blending(highs);
 }
+
+// Interrupt the simplex solver at its second check for an interrupt,
+// when the dual simplex solver has set up its edge weights but not
+// yet performed an iteration
+HighsCallbackFunctionType interruptBeforeIteration =
+    [](int callback_type, const std::string& message,
+       const HighsCallbackDataOut* data_out, HighsCallbackDataIn* data_in,
+       void* user_callback_data) {
+      HighsInt& num_call = *(HighsInt*)user_callback_data;
+      data_in->user_interrupt = ++num_call > 1;
+    };
+
+// Get the dual steepest edge weights that the dual simplex solver
+// sets up when starting from the given basis
+std::vector<double> initialDualEdgeWeights(const HighsBasis& basis,
+                                           const bool block,
+                                           const HighsInt num_threads = 0) {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", num_threads);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("dual_steepest_edge_weight_block", block);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/25fv47.mps");
+  HighsInt num_call = 0;
+  highs.setCallback(interruptBeforeIteration, &num_call);
+  highs.startCallback(kCallbackSimplexInterrupt);
+  REQUIRE(highs.setBasis(basis) == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(highs.getInfo().simplex_iteration_count == 0);
+  const double* weight = highs.getDualEdgeWeights();
+  REQUIRE(weight != nullptr);
+  return std::vector<double>(weight, weight + highs.getNumRow());
+}
+
+TEST_CASE("Ekk-dse-weight-block", "[highs_test_ekk]") {
+  // Get an advanced basis that is far from optimal
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("simplex_iteration_limit", 500);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/25fv47.mps");
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+  const HighsBasis basis = highs.getBasis();
+  const std::vector<double> weight = initialDualEdgeWeights(basis, false);
+  // The weights computed in blocks are the same to within rounding,
+  // whether they are computed in serial or in parallel
+  Highs::resetGlobalScheduler(true);
+  for (HighsInt num_threads = 1; num_threads <= 2; num_threads++) {
+    const std::vector<double> block_weight =
+        initialDualEdgeWeights(basis, true, num_threads);
+    REQUIRE(block_weight.size() == weight.size());
+    for (size_t iRow = 0; iRow < weight.size(); iRow++)
+      REQUIRE(std::fabs(block_weight[iRow] - weight[iRow]) <=
+              1e-10 * std::max(1.0, weight[iRow]));
+    Highs::resetGlobalScheduler(true);
+  }
+}
+
+TEST_CASE("Ekk-dse-weight-keep", "[highs_test_ekk]") {
+  // Weights are compared with those for a new model, which would be
+  // scaled differently, so neither model is scaled
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("simplex_scale_strategy", kSimplexScaleStrategyOff);
+  highs.setOptionValue("dual_steepest_edge_weight_keep", true);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/25fv47.mps");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double* optimal_weight = highs.getDualEdgeWeights();
+  REQUIRE(optimal_weight != nullptr);
+  const HighsInt num_col = highs.getNumCol();
+  const HighsInt num_row = highs.getNumRow();
+  // Map each basic variable to its weight
+  std::vector<HighsInt> basic_variable(num_row);
+  highs.getBasicVariables(basic_variable.data());
+  std::vector<double> variable_weight(num_col + num_row, 0);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const HighsInt iVar = basic_variable[iRow] >= 0
+                              ? basic_variable[iRow]
+                              : num_col - 1 - basic_variable[iRow];
+    variable_weight[iVar] = optimal_weight[iRow];
+  }
+  // Add a row that cuts off the optimal solution
+  const std::vector<double>& col_value = highs.getSolution().col_value;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  double activity = 0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    if (col_value[iCol] <= 0) continue;
+    index.push_back(iCol);
+    value.push_back(1);
+    activity += col_value[iCol];
+  }
+  REQUIRE(highs.addRow(-kHighsInf, 0.5 * activity, index.size(), index.data(),
+                       value.data()) == HighsStatus::kOk);
+  const HighsBasis basis = highs.getBasis();
+  // Get the weights that the dual simplex solver starts with
+  HighsInt num_call = 0;
+  highs.setCallback(interruptBeforeIteration, &num_call);
+  highs.startCallback(kCallbackSimplexInterrupt);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  const double* kept_weight = highs.getDualEdgeWeights();
+  REQUIRE(kept_weight != nullptr);
+  basic_variable.resize(num_row + 1);
+  highs.getBasicVariables(basic_variable.data());
+  // The weights of the basic variables other than the new logical
+  // have been kept, and the weight of the new logical is exact
+  Highs exact;
+  exact.setOptionValue("output_flag", dev_run);
+  exact.setOptionValue("presolve", kHighsOffString);
+  exact.setOptionValue("simplex_scale_strategy", kSimplexScaleStrategyOff);
+  exact.passModel(highs.getLp());
+  HighsInt exact_num_call = 0;
+  exact.setCallback(interruptBeforeIteration, &exact_num_call);
+  exact.startCallback(kCallbackSimplexInterrupt);
+  REQUIRE(exact.setBasis(basis) == HighsStatus::kOk);
+  exact.run();
+  const double* exact_weight = exact.getDualEdgeWeights();
+  REQUIRE(exact_weight != nullptr);
+  std::vector<HighsInt> exact_basic_variable(num_row + 1);
+  exact.getBasicVariables(exact_basic_variable.data());
+  HighsInt num_new_logical = 0;
+  for (HighsInt iRow = 0; iRow <= num_row; iRow++) {
+    const HighsInt iVar = basic_variable[iRow] >= 0
+                              ? basic_variable[iRow]
+                              : num_col - 1 - basic_variable[iRow];
+    if (iVar < num_col + num_row) {
+      REQUIRE(kept_weight[iRow] == variable_weight[iVar]);
+      continue;
+    }
+    num_new_logical++;
+    for (HighsInt jRow = 0; jRow <= num_row; jRow++) {
+      if (exact_basic_variable[jRow] != basic_variable[iRow]) continue;
+      REQUIRE(std::fabs(kept_weight[iRow] - exact_weight[jRow]) <=
+              1e-10 * exact_weight[jRow]);
+    }
+  }
+  REQUIRE(num_new_logical == 1);
+  // Solving from the kept weights gives the same optimal objective
+  highs.stopCallback(kCallbackSimplexInterrupt);
+  exact.stopCallback(kCallbackSimplexInterrupt);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(exact.run() == HighsStatus::kOk);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    exact.getInfo().objective_function_value) <=
+          1e-8 * std::max(1.0, std::fabs(exact.getInfo()
+                                             .objective_function_value)));
+}
+
+TEST_CASE("Ekk-extend-invert", "[highs_test_ekk]") {
+  // Solve a sequence of modified LPs without and with extending the
+  // factorization of the basis matrix, and keeping the dual steepest
+  // edge weights. More rows are added than the factorization may be
+  // extended by, so it is also formed from scratch
+  const HighsInt num_new_row = 20;
+  std::vector<double> objective[3];
+  for (HighsInt pass = 0; pass < 3; pass++) {
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("presolve", kHighsOffString);
+    highs.setOptionValue("simplex_extend_invert", pass > 0);
+    highs.setOptionValue("dual_steepest_edge_weight_keep", pass > 1);
+    highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    const HighsInt num_col = highs.getNumCol();
+    const std::vector<double> col_value = highs.getSolution().col_value;
+    const std::vector<double> col_cost = highs.getLp().col_cost_;
+    const double optimal_objective = highs.getInfo().objective_function_value;
+    // Alternately add rows that increase the optimal objective, and
+    // rows that cut off more of the original optimal solution
+    HighsRandom random;
+    for (HighsInt iRow = 0; iRow < num_new_row; iRow++) {
+      std::vector<HighsInt> index;
+      std::vector<double> value;
+      double activity = 0;
+      for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+        if (iRow % 2 == 0) {
+          if (!col_cost[iCol]) continue;
+          index.push_back(iCol);
+          value.push_back(col_cost[iCol]);
+        } else {
+          if (col_value[iCol] <= 0 || random.fraction() < 0.5) continue;
+          index.push_back(iCol);
+          value.push_back(1);
+          activity += col_value[iCol];
+        }
+      }
+      const double lower =
+          iRow % 2 == 0 ? (1 + 0.002 * (iRow + 1)) * optimal_objective
+                        : -kHighsInf;
+      const double upper =
+          iRow % 2 == 0 ? kHighsInf : (1 - 0.01 * iRow) * activity;
+      REQUIRE(highs.addRow(lower, upper, index.size(), index.data(),
+                           value.data()) == HighsStatus::kOk);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      objective[pass].push_back(highs.getInfo().objective_function_value);
+    }
+    // Change a coefficient of a nonbasic column, and add a copy of a
+    // nonbasic column with a lower cost. Since the column depends on
+    // the optimal basis, the optimal objective is compared with that
+    // of the LP solved from scratch
+    auto requireScratchObjective = [&]() {
+      Highs scratch;
+      scratch.setOptionValue("output_flag", dev_run);
+      scratch.setOptionValue("presolve", kHighsOffString);
+      scratch.passModel(highs.getLp());
+      REQUIRE(scratch.run() == HighsStatus::kOk);
+      const double scratch_objective =
+          scratch.getInfo().objective_function_value;
+      REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                        scratch_objective) <=
+              1e-8 * std::max(1.0, std::fabs(scratch_objective)));
+    };
+    const HighsBasis& basis = highs.getBasis();
+    HighsInt nonbasic_col = 0;
+    while (basis.col_status[nonbasic_col] == HighsBasisStatus::kBasic)
+      nonbasic_col++;
+    REQUIRE(highs.changeCoeff(0, nonbasic_col, 1) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    requireScratchObjective();
+    const HighsLp& lp = highs.getLp();
+    const HighsInt from_el = lp.a_matrix_.start_[nonbasic_col];
+    const HighsInt to_el = lp.a_matrix_.start_[nonbasic_col + 1];
+    const std::vector<HighsInt> index(
+        lp.a_matrix_.index_.begin() + from_el,
+        lp.a_matrix_.index_.begin() + to_el);
+    const std::vector<double> value(lp.a_matrix_.value_.begin() + from_el,
+                                    lp.a_matrix_.value_.begin() + to_el);
+    REQUIRE(highs.addCol(lp.col_cost_[nonbasic_col] - 1, 0, 10, index.size(),
+                         index.data(), value.data()) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    requireScratchObjective();
+    if (pass == 0) continue;
+    REQUIRE(objective[pass].size() == objective[0].size());
+    for (size_t k = 0; k < objective[0].size(); k++)
+      REQUIRE(std::fabs(objective[pass][k] - objective[0][k]) <=
+              1e-8 * std::max(1.0, std::fabs(objective[0][k])));
+  }
+}
@@ -1,6 +1,9 @@
+#include <chrono>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "parallel/HighsParallel.h"
 #include "util/HFactor.h"
 
 const bool dev_run = false;
@@ -19,6 +22,9 @@ HighsInt rowOut(const HighsInt variable_out);
 bool iterate(const HighsInt variable_out, const HighsInt variable_in);
 bool testSolve();
 bool testSolveDense();
+bool testBlockTran();
+double reachCacheSolves(HFactor& tree_factor, const HighsInt num_pass,
+                        std::vector<double>& result);
 
 TEST_CASE("Factor-dense-tran", "[highs_test_factor]") {
   std::string filename;
@@ -45,6 +51,7 @@ TEST_CASE("Factor-dense-tran", "[highs_test_factor]") {
     solution[iRow] = random.fraction();
   rhs.setup(num_row);
   REQUIRE(testSolveDense());
+  REQUIRE(testBlockTran());
 }
 
 TEST_CASE("Factor-put-get-iterate", "[highs_test_factor]") {
@@ -177,6 +184,88 @@ TEST_CASE("Factor-get-set-invert", "[highs_test_factor]") {
   for (basis_change = from_basis_change; basis_change < to_basis_change;
        basis_change++)
     REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
+  REQUIRE(testBlockTran());
+}
+
+TEST_CASE("Factor-dense-kernel", "[highs_test_factor]") {
+  // Form an LP whose constraint matrix has about half of its entries
+  // nonzero, so that the kernel of the basis matrix of structurals is
+  // factored as a dense matrix
+  const HighsInt dim = 100;
+  HighsRandom random;
+  lp.clear();
+  lp.num_col_ = dim;
+  lp.num_row_ = dim;
+  lp.col_cost_.assign(dim, 1);
+  lp.col_lower_.assign(dim, 0);
+  lp.col_upper_.assign(dim, kHighsInf);
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  lp.a_matrix_.num_col_ = dim;
+  lp.a_matrix_.num_row_ = dim;
+  lp.a_matrix_.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    for (HighsInt iRow = 0; iRow < dim; iRow++) {
+      if (iRow != iCol && random.fraction() < 0.5) continue;
+      lp.a_matrix_.index_.push_back(iRow);
+      lp.a_matrix_.value_.push_back(random.fraction() - 0.5);
+    }
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+  }
+  // The rows are equations satisfied by x = 1
+  lp.row_lower_.assign(dim, 0);
+  for (HighsInt iEl = 0; iEl < lp.a_matrix_.numNz(); iEl++)
+    lp.row_lower_[lp.a_matrix_.index_[iEl]] += lp.a_matrix_.value_[iEl];
+  lp.row_upper_ = lp.row_lower_;
+  num_col = dim;
+  num_row = dim;
+  solution.resize(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    solution[iRow] = random.fraction();
+  rhs.setup(num_row);
+
+  Highs::resetGlobalScheduler(true);
+  basic_set.clear();
+  for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set.push_back(iCol);
+  factor.setup(lp.a_matrix_, basic_set);
+  REQUIRE(factor.build() == 0);
+  REQUIRE(factor.dense_kernel_dim == dim);
+  REQUIRE(testSolveDense());
+  const InvertibleRepresentation serial_invert = factor.getInvert();
+
+  // The factors are the same when the dense kernel is factored in
+  // parallel
+  highs::parallel::initialize_scheduler(4);
+  basic_set.clear();
+  for (HighsInt iCol = 0; iCol < dim; iCol++) basic_set.push_back(iCol);
+  factor.setup(lp.a_matrix_, basic_set);
+  REQUIRE(factor.build() == 0);
+  REQUIRE(factor.dense_kernel_dim == dim);
+  const InvertibleRepresentation parallel_invert = factor.getInvert();
+  REQUIRE(parallel_invert.u_pivot_index == serial_invert.u_pivot_index);
+  REQUIRE(parallel_invert.u_pivot_value == serial_invert.u_pivot_value);
+  REQUIRE(parallel_invert.l_index == serial_invert.l_index);
+  REQUIRE(parallel_invert.l_value == serial_invert.l_value);
+  REQUIRE(parallel_invert.u_index == serial_invert.u_index);
+  REQUIRE(parallel_invert.u_value == serial_invert.u_value);
+
+  // A singular dense kernel is left to Markowitz pivoting, which
+  // identifies the rank deficiency
+  basic_set.clear();
+  for (HighsInt iCol = 0; iCol < dim; iCol++)
+    basic_set.push_back(iCol == 1 ? 0 : iCol);
+  factor.setup(lp.a_matrix_, basic_set);
+  REQUIRE(factor.build() == 1);
+  REQUIRE(factor.dense_kernel_dim == 0);
+  Highs::resetGlobalScheduler(true);
+
+  // The simplex solver reaches the basis of structurals
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.passModel(lp);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value - dim) < 1e-6);
 }
 
 HighsInt rowOut(const HighsInt variable_out) {
@@ -382,3 +471,248 @@ bool testSolveDense() {
 
   return true;
 }
+
+bool testBlockTran() {
+  // Check that FTRAN and BTRAN for a block of RHS give the same
+  // results as for each RHS in turn, both when the factors are
+  // traversed for the block, and when each RHS is solved in turn
+  const HighsInt num_rhs = 5;
+  HighsRandom random;
+  std::vector<double> block(num_row * num_rhs, 0);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    for (HighsInt k = 0; k < num_rhs; k++)
+      if (random.fraction() < 0.2)
+        block[iRow * num_rhs + k] = random.fraction() - 0.5;
+  for (HighsInt transpose = 0; transpose < 2; transpose++) {
+    for (HighsInt pass = 0; pass < 2; pass++) {
+      const double expected_density = pass;
+      std::vector<double> block_solution = block;
+      if (transpose) {
+        factor.btranBlock(block_solution, num_rhs, expected_density);
+      } else {
+        factor.ftranBlock(block_solution, num_rhs, expected_density);
+      }
+      double error_norm = 0;
+      for (HighsInt k = 0; k < num_rhs; k++) {
+        std::vector<double> vector_solution(num_row);
+        for (HighsInt iRow = 0; iRow < num_row; iRow++)
+          vector_solution[iRow] = block[iRow * num_rhs + k];
+        if (transpose) {
+          factor.btranCall(vector_solution);
+        } else {
+          factor.ftranCall(vector_solution);
+        }
+        for (HighsInt iRow = 0; iRow < num_row; iRow++)
+          error_norm = std::max(
+              std::fabs(vector_solution[iRow] -
+                        block_solution[iRow * num_rhs + k]) /
+                  std::max(1.0, std::fabs(vector_solution[iRow])),
+              error_norm);
+      }
+      if (dev_run)
+        printf("Block %s (expected density %g): %g\n",
+               transpose ? "BTRAN" : "FTRAN", expected_density, error_norm);
+      if (error_norm > 1e-10) return false;
+    }
+  }
+  return true;
+}
+
+TEST_CASE("Factor-reach-cache", "[highs_test_factor]") {
+  // Form a basis matrix whose columns correspond to the nodes of a
+  // binary tree, with entries in the rows of the node and its parent,
+  // so that FTRAN and BTRAN with unit vectors are hyper-sparse
+  const HighsInt dim = dev_run ? 1000000 : 10000;
+  HighsSparseMatrix matrix;
+  matrix.format_ = MatrixFormat::kColwise;
+  matrix.num_col_ = dim;
+  matrix.num_row_ = dim;
+  matrix.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < dim; iCol++) {
+    if (iCol > 0) {
+      matrix.index_.push_back((iCol - 1) / 2);
+      matrix.value_.push_back(1);
+    }
+    matrix.index_.push_back(iCol);
+    matrix.value_.push_back(2);
+    matrix.start_.push_back(matrix.index_.size());
+  }
+  std::vector<HighsInt> tree_basic_index;
+  for (HighsInt iCol = 0; iCol < dim; iCol++)
+    tree_basic_index.push_back(iCol);
+  HFactor tree_factor;
+  tree_factor.setup(matrix, tree_basic_index);
+  REQUIRE(tree_factor.build() == 0);
+  REQUIRE(!tree_factor.getReachCache());
+
+  const HighsInt num_pass = dev_run ? 1000 : 10;
+  std::vector<double> result;
+  const double no_cache_time = reachCacheSolves(tree_factor, num_pass, result);
+
+  // Caching the reach gives the same results
+  tree_factor.setReachCache(true);
+  std::vector<double> cache_result;
+  const double cache_time =
+      reachCacheSolves(tree_factor, num_pass, cache_result);
+  REQUIRE(cache_result == result);
+  HighsInt num_lookup;
+  HighsInt num_hit;
+  tree_factor.getReachCacheCount(num_lookup, num_hit);
+  REQUIRE(num_lookup > 0);
+  REQUIRE(num_hit > num_lookup / 2);
+  if (dev_run)
+    printf(
+        "%d hyper-sparse solves: %.3fs without reach cache; %.3fs with "
+        "reach cache (%d hits)\n",
+        int(num_lookup), no_cache_time, cache_time, int(num_hit));
+
+  // The cache is cleared when INVERT is formed
+  REQUIRE(tree_factor.build() == 0);
+  reachCacheSolves(tree_factor, 1, cache_result);
+  REQUIRE(cache_result == result);
+  HighsInt num_lookup_after_build;
+  HighsInt num_hit_after_build;
+  tree_factor.getReachCacheCount(num_lookup_after_build, num_hit_after_build);
+  REQUIRE(num_lookup_after_build > num_lookup);
+  REQUIRE(num_hit_after_build == num_hit);
+
+  // The simplex solver takes the same iterations with the cache
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps");
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInt iteration_count = highs.getInfo().simplex_iteration_count;
+  const double objective = highs.getInfo().objective_function_value;
+  highs.clearSolver();
+  highs.setOptionValue("factor_reach_cache", true);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getInfo().simplex_iteration_count == iteration_count);
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+}
+
+double reachCacheSolves(HFactor& tree_factor, const HighsInt num_pass,
+                        std::vector<double>& result) {
+  // FTRAN and BTRAN with the same unit vectors in each pass,
+  // recording the results of the first pass
+  const HighsInt dim = tree_factor.num_row;
+  const HighsInt num_pattern = 32;
+  HVector tran;
+  tran.setup(dim);
+  result.clear();
+  auto start = std::chrono::steady_clock::now();
+  for (HighsInt pass = 0; pass < num_pass; pass++) {
+    for (HighsInt k = 0; k < 2 * num_pattern; k++) {
+      const HighsInt iRow = dim - 1 - ((k / 2) * 7919) % (dim / 2);
+      tran.clear();
+      tran.index[tran.count++] = iRow;
+      tran.array[iRow] = 1;
+      if (k % 2) {
+        tree_factor.btranCall(tran, 0);
+      } else {
+        tree_factor.ftranCall(tran, 0);
+      }
+      if (pass) continue;
+      for (HighsInt iX = 0; iX < tran.count; iX++) {
+        result.push_back(tran.index[iX]);
+        result.push_back(tran.array[tran.index[iX]]);
+      }
+    }
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+TEST_CASE("Factor-extend-rows", "[highs_test_factor]") {
+  // Extend the factorization of an optimal basis matrix, after
+  // updates, by rows whose logicals are basic. Check solves with the
+  // extended basis matrix, and after further updates with pivots in
+  // the new rows
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+  highs.run();
+  lp = highs.getLp();
+  num_col = lp.num_col_;
+  num_row = lp.num_row_;
+  const HighsInt num_new_row = 5;
+  basic_set.resize(num_row);
+  highs.getBasicVariables(basic_set.data());
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    basic_set[iRow] = basic_set[iRow] < 0 ? num_col - basic_set[iRow] - 1
+                                          : basic_set[iRow];
+  // HFactor refers to the basic variables, so they mustn't move when
+  // the logicals of the new rows are added
+  basic_set.reserve(num_row + num_new_row);
+  HighsRandom random;
+  auto setupSolves = [&]() {
+    solution.resize(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      solution[iRow] = random.fraction();
+    rhs.setup(num_row);
+    col_aq.setup(num_row);
+    row_ep.setup(num_row);
+  };
+  // Replace the basic variable in the row of the largest pivot in the
+  // column of a nonbasic structural
+  auto iterateLargestPivot = [&](const HighsInt from_row) {
+    std::vector<bool> basic(num_col + num_row, false);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      basic[basic_set[iRow]] = true;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      if (basic[iCol]) continue;
+      col_aq.clear();
+      lp.a_matrix_.collectAj(col_aq, iCol, 1);
+      factor.ftranCall(col_aq, 1);
+      HighsInt row_out = -1;
+      double max_pivot = 0.1;
+      for (HighsInt iRow = from_row; iRow < num_row; iRow++) {
+        if (std::fabs(col_aq.array[iRow]) <= max_pivot) continue;
+        max_pivot = std::fabs(col_aq.array[iRow]);
+        row_out = iRow;
+      }
+      if (row_out >= 0) return iterate(basic_set[row_out], iCol);
+    }
+    return false;
+  };
+  setupSolves();
+  factor.setup(lp.a_matrix_, basic_set);
+  REQUIRE(factor.build() == 0);
+  for (basis_change = 0; basis_change < 3; basis_change++)
+    REQUIRE(iterateLargestPivot(0));
+  // Form rows with random entries in about a fifth of the columns
+  HighsSparseMatrix new_rows;
+  new_rows.format_ = MatrixFormat::kRowwise;
+  new_rows.num_col_ = num_col;
+  new_rows.num_row_ = num_new_row;
+  new_rows.start_.assign(1, 0);
+  for (HighsInt iRow = 0; iRow < num_new_row; iRow++) {
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      if (random.fraction() > 0.2) continue;
+      new_rows.index_.push_back(iCol);
+      new_rows.value_.push_back(random.fraction() - 0.5);
+    }
+    new_rows.start_.push_back(new_rows.index_.size());
+  }
+  // The logicals of the new rows are basic
+  for (HighsInt iRow = num_row; iRow < num_row + num_new_row; iRow++)
+    basic_set.push_back(num_col + iRow);
+  factor.addRows(&new_rows);
+  REQUIRE(factor.num_row == num_row + num_new_row);
+  lp.a_matrix_.addRows(new_rows);
+  num_row += num_new_row;
+  lp.num_row_ = num_row;
+  setupSolves();
+  REQUIRE(testSolve());
+  REQUIRE(testBlockTran());
+  // Updates with pivots in the new rows
+  for (; basis_change < 6; basis_change++)
+    REQUIRE(iterateLargestPivot(num_row - num_new_row));
+  REQUIRE(testBlockTran());
+  // INVERT of the extended basis matrix, once HFactor has been set up
+  // for its dimensions
+  factor.setup(lp.a_matrix_, basic_set);
+  REQUIRE(factor.build() == 0);
+  REQUIRE(testSolve());
+}
@@ -1,14 +1,17 @@
 #include <cstdio>
+#include <fstream>
 
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "io/FilereaderBinary.h"
 #include "io/FilereaderEms.h"
 #include "io/HMPSIO.h"
 #include "io/HMpsFF.h"
 #include "io/HighsIO.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsLpUtils.h"
+#include "parallel/HighsParallel.h"
 
 const bool dev_run = false;
 
@@ -343,3 +346,282 @@ TEST_CASE("filereader-dD2e", "[highs_filereader]") {
   objective_value = highs.getInfo().objective_function_value;
   REQUIRE(objective_value == optimal_objective_value);
 }
+
+// Compare the model read by the free format MPS parser with and
+// without a memory map, splitting the mapped file into chunks of
+// several sizes so that sections are parsed in many pieces
+void mappedMpsModelTest(const std::string& filename) {
+  HighsOptions options;
+  options.output_flag = dev_run;
+  HighsModel model_stream;
+  free_format_parser::HMpsFF stream_parser;
+  stream_parser.use_mapped_file = false;
+  const FreeFormatParserReturnCode stream_result =
+      stream_parser.loadProblem(options.log_options, filename, model_stream);
+  for (const size_t chunk_size : {size_t{1}, size_t{100}, size_t{1} << 22}) {
+    HighsModel model_mapped;
+    free_format_parser::HMpsFF mapped_parser;
+    mapped_parser.mapped_chunk_size = chunk_size;
+    REQUIRE(mapped_parser.loadProblem(options.log_options, filename,
+                                      model_mapped) == stream_result);
+    if (stream_result != FreeFormatParserReturnCode::kSuccess) continue;
+    const HighsLp& lp_stream = model_stream.lp_;
+    const HighsLp& lp_mapped = model_mapped.lp_;
+    REQUIRE(model_mapped == model_stream);
+    REQUIRE(lp_mapped.a_matrix_ == lp_stream.a_matrix_);
+    REQUIRE(lp_mapped.col_cost_ == lp_stream.col_cost_);
+    REQUIRE(lp_mapped.col_lower_ == lp_stream.col_lower_);
+    REQUIRE(lp_mapped.col_upper_ == lp_stream.col_upper_);
+    REQUIRE(lp_mapped.row_lower_ == lp_stream.row_lower_);
+    REQUIRE(lp_mapped.row_upper_ == lp_stream.row_upper_);
+    REQUIRE(lp_mapped.integrality_ == lp_stream.integrality_);
+    REQUIRE(lp_mapped.cost_row_location_ == lp_stream.cost_row_location_);
+  }
+}
+
+// Write a synthetic MPS file using all the features of the sections
+// handled by the mapped file parser
+void writeSyntheticMps(const std::string& filename, const HighsInt num_row,
+                       const HighsInt num_col) {
+  std::ofstream f(filename);
+  f << "NAME synthetic\nOBJSENSE\n    MAX\nROWS\n N  obj\n N  free\n";
+  const char row_types[] = {'G', 'L', 'E'};
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    f << " " << row_types[iRow % 3] << "  r" << iRow << "\n";
+  f << "COLUMNS\n";
+  const HighsInt num_nz_per_col = std::min(HighsInt{6}, num_row);
+  bool integral = false;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    if ((iCol % 10 == 3) != integral) {
+      integral = !integral;
+      f << "    MARKER  'MARKER'  " << (integral ? "'INTORG'" : "'INTEND'")
+        << "\n";
+    }
+    if (iCol % 5 == 0) f << "* column " << iCol << "\n";
+    const std::string name = "c" + std::to_string(iCol);
+    if (iCol % 4 != 1) f << "    " << name << "  obj  " << iCol % 7 << "\n";
+    if (iCol % 9 == 2) f << "    " << name << "  free  1\n";
+    for (HighsInt k = 0; k < num_nz_per_col; k++) {
+      const HighsInt iRow = (iCol + k * (num_row / num_nz_per_col)) % num_row;
+      f << "    " << name << "  r" << iRow << "  " << (k + 1)
+        << (iCol % 6 == 0 ? ".5D0" : ".25");
+      if (k + 1 < num_nz_per_col && iCol % 2 == 0) {
+        k++;
+        const HighsInt jRow =
+            (iCol + k * (num_row / num_nz_per_col)) % num_row;
+        f << "\tr" << jRow << "\t" << -k;
+      }
+      f << "\n";
+    }
+  }
+  if (integral) f << "    MARKER  'MARKER'  'INTEND'\n";
+  f << "RHS\n    RHS  obj  -2.5\n";
+  for (HighsInt iRow = 0; iRow < num_row; iRow += 2) {
+    if (iRow % 4 == 0)
+      f << "    RHS  r" << iRow << "  " << iRow << "\n";
+    else
+      f << "    r" << iRow << "  " << -iRow << "e-1\n";
+  }
+  f << "RANGES\n";
+  for (HighsInt iRow = 0; iRow < num_row; iRow += 5)
+    f << "    RNG  r" << iRow << "  " << (iRow % 2 ? -3 : 4) << "\n";
+  f << "BOUNDS\n";
+  const char* bound_types[] = {"UP", "LO", "FX", "MI", "PL", "BV",
+                               "LI", "UI", "FR", "SC", "SI", "XX"};
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const std::string type = bound_types[iCol % 12];
+    if (type == "XX") continue;
+    f << " " << type << " BND  c" << iCol;
+    if (type != "MI" && type != "PL" && type != "BV" && type != "FR")
+      f << "  " << iCol % 5 + 1;
+    f << "\n";
+  }
+  f << "ENDATA\n";
+}
+
+TEST_CASE("filereader-mps-mapped", "[highs_filereader]") {
+  const std::vector<std::string> models = {
+      "25fv47", "80bau3b", "adlittle", "afiro", "avgas", "bell5", "bgetam",
+      "blending", "box1", "chip", "dD2e", "dcmulti", "e226", "egout",
+      "etamacro", "ex72a", "flugpl", "forest6", "galenet", "gams10am",
+      "garbage", "gas11", "greenbea", "gt2", "infeasible", "israel", "klein1",
+      "lseu", "p01", "p0548", "primal1", "qap04", "qjh", "qjh_qmatrix",
+      "qjh_quadobj", "qjh_uncon", "refinery", "rgn", "scrs8", "sctest",
+      "semi-continuous", "semi-integer", "shell", "small_mip", "sp150x300d",
+      "stair", "standata", "standgub", "standmps", "test", "woodinfe"};
+  for (const std::string& model : models)
+    mappedMpsModelTest(std::string(HIGHS_DIR) + "/check/instances/" + model +
+                       ".mps");
+
+  const std::string filename = "synthetic.mps";
+  writeSyntheticMps(filename, 50, 200);
+  mappedMpsModelTest(filename);
+  // Parse the chunks in parallel
+  Highs::resetGlobalScheduler(true);
+  highs::parallel::initialize_scheduler(2);
+  mappedMpsModelTest(filename);
+  Highs::resetGlobalScheduler(true);
+
+  // Anomalies, such as an unknown row name, are left to the stream
+  // parser
+  std::ofstream f(filename);
+  f << "NAME anomaly\nROWS\n N  obj\n L  r0\nCOLUMNS\n"
+       "    c0  r0  1  unknown  1\nRHS\n    RHS  r0  1\nENDATA\n";
+  f.close();
+  mappedMpsModelTest(filename);
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("filereader-mps-mapped-throughput", "[highs_filereader]") {
+  // Compare the time taken by the free format MPS parser with and
+  // without a memory map for a model with 10^5 (10^7 when dev_run)
+  // nonzeros
+  const HighsInt num_col = dev_run ? 2000000 : 20000;
+  const std::string filename = "throughput.mps";
+  writeSyntheticMps(filename, num_col / 4, num_col);
+  std::ifstream size_file(filename, std::ios::binary | std::ios::ate);
+  const double megabytes = size_file.tellg() / 1e6;
+  size_file.close();
+  HighsOptions options;
+  options.output_flag = dev_run;
+  std::vector<HighsModel> model(2);
+  for (HighsInt k = 0; k < 2; k++) {
+    free_format_parser::HMpsFF parser;
+    parser.use_mapped_file = k == 1;
+    const double start = free_format_parser::getWallTime();
+    REQUIRE(parser.loadProblem(options.log_options, filename, model[k]) ==
+            FreeFormatParserReturnCode::kSuccess);
+    const double time = free_format_parser::getWallTime() - start;
+    if (dev_run)
+      printf("%s parser reads %.1f MB in %.3fs: %.1f MB/s\n",
+             k ? "Mapped" : "Stream", megabytes, time, megabytes / time);
+  }
+  REQUIRE(model[1] == model[0]);
+  std::remove(filename.c_str());
+}
+
+// Write a model to a binary file, and check that reading the file
+// yields the same model
+void binaryModelTest(const std::string& filename) {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  if (highs.readModel(filename) == HighsStatus::kError) return;
+  const std::string filename_hbin = "binary.hbin";
+  REQUIRE(highs.writeModel(filename_hbin) == HighsStatus::kOk);
+  HighsOptions options;
+  options.output_flag = dev_run;
+  FilereaderBinary reader;
+  HighsModel model;
+  REQUIRE(reader.readModelFromFile(options, filename_hbin, model) ==
+          FilereaderRetcode::kOk);
+  REQUIRE(!reader.solution.value_valid);
+  REQUIRE(!reader.basis.valid);
+  const HighsLp& lp = highs.getLp();
+  const HighsLp& lp_hbin = model.lp_;
+  REQUIRE(lp_hbin.num_col_ == lp.num_col_);
+  REQUIRE(lp_hbin.num_row_ == lp.num_row_);
+  REQUIRE(lp_hbin.a_matrix_ == lp.a_matrix_);
+  REQUIRE(lp_hbin.col_cost_ == lp.col_cost_);
+  REQUIRE(lp_hbin.col_lower_ == lp.col_lower_);
+  REQUIRE(lp_hbin.col_upper_ == lp.col_upper_);
+  REQUIRE(lp_hbin.row_lower_ == lp.row_lower_);
+  REQUIRE(lp_hbin.row_upper_ == lp.row_upper_);
+  REQUIRE(lp_hbin.integrality_ == lp.integrality_);
+  REQUIRE(lp_hbin.col_names_ == lp.col_names_);
+  REQUIRE(lp_hbin.row_names_ == lp.row_names_);
+  REQUIRE(lp_hbin.model_name_ == lp.model_name_);
+  REQUIRE(lp_hbin.objective_name_ == lp.objective_name_);
+  REQUIRE(lp_hbin.offset_ == lp.offset_);
+  REQUIRE(lp_hbin.sense_ == lp.sense_);
+  REQUIRE(model.hessian_ == highs.getModel().hessian_);
+  std::remove(filename_hbin.c_str());
+}
+
+TEST_CASE("filereader-binary", "[highs_filereader]") {
+  const std::vector<std::string> models = {
+      "25fv47", "adlittle", "avgas", "bell5", "box1", "dcmulti", "egout",
+      "flugpl", "garbage", "gas11", "qjh", "qjh_quadobj", "semi-continuous",
+      "semi-integer", "small_mip", "woodinfe"};
+  for (const std::string& model : models)
+    binaryModelTest(std::string(HIGHS_DIR) + "/check/instances/" + model +
+                    ".mps");
+  binaryModelTest(std::string(HIGHS_DIR) + "/check/instances/avgas.lp");
+
+  // The solution and basis are written with the model, so re-solving
+  // the LP requires no iterations
+  const std::string filename = "binary.hbin";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/adlittle.mps") ==
+          HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsSolution solution = highs.getSolution();
+  const HighsBasis basis = highs.getBasis();
+  const double objective = highs.getInfo().objective_function_value;
+  REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.getSolution().value_valid);
+  REQUIRE(highs.getSolution().dual_valid);
+  REQUIRE(highs.getSolution().col_value == solution.col_value);
+  REQUIRE(highs.getSolution().row_dual == solution.row_dual);
+  REQUIRE(highs.getBasis().valid);
+  REQUIRE(highs.getBasis().col_status == basis.col_status);
+  REQUIRE(highs.getBasis().row_status == basis.row_status);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getInfo().simplex_iteration_count == 0);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value - objective) <
+          1e-8);
+
+  // The MIP incumbent is written with the model
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/flugpl.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const std::vector<double> incumbent = highs.getSolution().col_value;
+  REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.getSolution().value_valid);
+  REQUIRE(highs.getSolution().col_value == incumbent);
+
+  // Corrupt and truncated files are rejected
+  std::ifstream in(filename, std::ios::binary);
+  const std::string contents((std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>());
+  in.close();
+  std::string corrupt = contents;
+  corrupt[corrupt.size() / 2] ^= 1;
+  std::ofstream(filename, std::ios::binary) << corrupt;
+  REQUIRE(highs.readModel(filename) == HighsStatus::kError);
+  std::ofstream(filename, std::ios::binary)
+      << contents.substr(0, contents.size() - 8);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kError);
+  std::ofstream(filename, std::ios::binary) << "NAME not binary\n";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kError);
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("filereader-binary-throughput", "[highs_filereader]") {
+  // Compare the time taken to read a model with 10^5 (10^7 when
+  // dev_run) nonzeros from a free format MPS file and a binary file
+  const HighsInt num_col = dev_run ? 2000000 : 20000;
+  const std::string filename_mps = "throughput.mps";
+  const std::string filename_hbin = "throughput.hbin";
+  writeSyntheticMps(filename_mps, num_col / 4, num_col);
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  double start = free_format_parser::getWallTime();
+  REQUIRE(highs.readModel(filename_mps) == HighsStatus::kOk);
+  const double mps_time = free_format_parser::getWallTime() - start;
+  const HighsLp lp = highs.getLp();
+  REQUIRE(highs.writeModel(filename_hbin) == HighsStatus::kOk);
+  start = free_format_parser::getWallTime();
+  REQUIRE(highs.readModel(filename_hbin) == HighsStatus::kOk);
+  const double hbin_time = free_format_parser::getWallTime() - start;
+  if (dev_run)
+    printf("Model read from MPS file in %.3fs and binary file in %.3fs\n",
+           mps_time, hbin_time);
+  REQUIRE(highs.getLp().a_matrix_ == lp.a_matrix_);
+  REQUIRE(highs.getLp().col_names_ == lp.col_names_);
+  std::remove(filename_mps.c_str());
+  std::remove(filename_hbin.c_str());
+}
@@ -0,0 +1,267 @@
+#include <cmath>
+
+#include "HCheckConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+
+const bool dev_run = false;
+
+// A cutting stock problem: rolls of width 100 are cut into items of
+// the given widths to meet the demands
+const HighsInt kRollWidth = 100;
+const std::vector<HighsInt> kItemWidth = {45, 36, 31, 14};
+const std::vector<double> kItemDemand = {97, 610, 395, 211};
+
+// Find the pattern of items that fits the roll and has the greatest
+// total weight, by dynamic programming over the width used
+static double bestPattern(const std::vector<double>& weight,
+                          std::vector<HighsInt>& pattern) {
+  const HighsInt num_item = kItemWidth.size();
+  std::vector<double> value(kRollWidth + 1, 0);
+  std::vector<HighsInt> last_item(kRollWidth + 1, -1);
+  for (HighsInt width = 1; width <= kRollWidth; width++) {
+    value[width] = value[width - 1];
+    for (HighsInt iItem = 0; iItem < num_item; iItem++) {
+      if (kItemWidth[iItem] > width) continue;
+      const double item_value =
+          value[width - kItemWidth[iItem]] + weight[iItem];
+      if (item_value > value[width]) {
+        value[width] = item_value;
+        last_item[width] = iItem;
+      }
+    }
+  }
+  pattern.assign(num_item, 0);
+  for (HighsInt width = kRollWidth; width > 0;) {
+    const HighsInt iItem = last_item[width];
+    if (iItem < 0) {
+      width--;
+    } else {
+      pattern[iItem]++;
+      width -= kItemWidth[iItem];
+    }
+  }
+  return value[kRollWidth];
+}
+
+// All patterns of items that fit the roll
+static void allPatterns(const HighsInt iItem, const HighsInt width,
+                        std::vector<HighsInt>& pattern,
+                        std::vector<std::vector<HighsInt>>& patterns) {
+  if (iItem == HighsInt(kItemWidth.size())) {
+    for (HighsInt count : pattern)
+      if (count) {
+        patterns.push_back(pattern);
+        break;
+      }
+    return;
+  }
+  for (pattern[iItem] = 0; pattern[iItem] * kItemWidth[iItem] <= width;
+       pattern[iItem]++)
+    allPatterns(iItem + 1, width - pattern[iItem] * kItemWidth[iItem],
+                pattern, patterns);
+  pattern[iItem] = 0;
+}
+
+static void sparsePattern(const std::vector<HighsInt>& pattern,
+                          std::vector<HighsInt>& index,
+                          std::vector<double>& value) {
+  index.clear();
+  value.clear();
+  for (HighsInt iItem = 0; iItem < HighsInt(pattern.size()); iItem++) {
+    if (!pattern[iItem]) continue;
+    index.push_back(iItem);
+    value.push_back(pattern[iItem]);
+  }
+}
+
+// The optimal objective of the LP with a column for every pattern
+static double allPatternsObjective() {
+  std::vector<HighsInt> pattern(kItemWidth.size(), 0);
+  std::vector<std::vector<HighsInt>> patterns;
+  allPatterns(0, kRollWidth, pattern, patterns);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (double demand : kItemDemand) highs.addRow(demand, kHighsInf, 0, 0, 0);
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  for (const std::vector<HighsInt>& pattern : patterns) {
+    sparsePattern(pattern, index, value);
+    highs.addCol(1, 0, kHighsInf, index.size(), index.data(), value.data());
+  }
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  return highs.getInfo().objective_function_value;
+}
+
+static void reportRounds(const Highs& highs) {
+  if (!dev_run) return;
+  const std::vector<HighsGenerationRound>& rounds =
+      highs.getGenerationRounds();
+  for (size_t round = 0; round < rounds.size(); round++)
+    printf(
+        "Round %2d: objective %12.6g; %3d iterations; %2d columns %2d rows "
+        "%s\n",
+        int(round), rounds[round].objective_function_value,
+        int(rounds[round].simplex_iteration_count),
+        int(rounds[round].num_new_col), int(rounds[round].num_new_row),
+        rounds[round].speculative ? "(speculative)" : "");
+}
+
+TEST_CASE("generate-columns", "[highs_generation]") {
+  // Solve the LP relaxation of the cutting stock problem by column
+  // generation, starting from patterns of a single item
+  const HighsInt num_item = kItemWidth.size();
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (double demand : kItemDemand) highs.addRow(demand, kHighsInf, 0, 0, 0);
+  for (HighsInt iItem = 0; iItem < num_item; iItem++) {
+    const double value = kRollWidth / kItemWidth[iItem];
+    highs.addCol(1, 0, kHighsInf, 1, &iItem, &value);
+  }
+  HighsInt num_call = 0;
+  HighsGenerationCallback callback = [&](const HighsSolution& solution,
+                                         HighsGeneration& generation) {
+    num_call++;
+    REQUIRE(HighsInt(solution.row_dual.size()) == num_item);
+    std::vector<HighsInt> pattern;
+    if (bestPattern(solution.row_dual, pattern) <= 1 + 1e-9) return;
+    std::vector<HighsInt> index;
+    std::vector<double> value;
+    sparsePattern(pattern, index, value);
+    generation.addCol(1, 0, kHighsInf, index.size(), index.data(),
+                      value.data());
+  };
+  REQUIRE(highs.generate(callback) == HighsStatus::kOk);
+  reportRounds(highs);
+  const std::vector<HighsGenerationRound>& rounds = highs.getGenerationRounds();
+  REQUIRE(rounds.size() > 1);
+  REQUIRE(num_call >= HighsInt(rounds.size()));
+  HighsInt num_new_col = 0;
+  for (const HighsGenerationRound& round : rounds) {
+    REQUIRE(round.model_status == HighsModelStatus::kOptimal);
+    num_new_col += round.num_new_col;
+  }
+  REQUIRE(rounds.back().num_new_col == 0);
+  REQUIRE(highs.getNumCol() == num_item + num_new_col);
+  const double objective = highs.getInfo().objective_function_value;
+  REQUIRE(rounds.back().objective_function_value == objective);
+  const double all_patterns_objective = allPatternsObjective();
+  REQUIRE(std::fabs(objective - all_patterns_objective) <=
+          1e-8 * all_patterns_objective);
+  // The options changed by generate() are restored
+  bool simplex_extend_invert;
+  highs.getOptionValue("simplex_extend_invert", simplex_extend_invert);
+  REQUIRE(!simplex_extend_invert);
+}
+
+TEST_CASE("generate-rows", "[highs_generation]") {
+  // Solve the dual of the LP relaxation of the cutting stock problem
+  // by row generation, starting from the rows for patterns of a
+  // single item
+  const HighsInt num_item = kItemWidth.size();
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (HighsInt iItem = 0; iItem < num_item; iItem++)
+    highs.addCol(kItemDemand[iItem], 0, kHighsInf, 0, 0, 0);
+  highs.changeObjectiveSense(ObjSense::kMaximize);
+  for (HighsInt iItem = 0; iItem < num_item; iItem++) {
+    const double value = kRollWidth / kItemWidth[iItem];
+    highs.addRow(-kHighsInf, 1, 1, &iItem, &value);
+  }
+  HighsGenerationCallback callback = [&](const HighsSolution& solution,
+                                         HighsGeneration& generation) {
+    std::vector<HighsInt> pattern;
+    if (bestPattern(solution.col_value, pattern) <= 1 + 1e-9) return;
+    std::vector<HighsInt> index;
+    std::vector<double> value;
+    sparsePattern(pattern, index, value);
+    generation.addRow(-kHighsInf, 1, index.size(), index.data(),
+                      value.data());
+  };
+  REQUIRE(highs.generate(callback) == HighsStatus::kOk);
+  reportRounds(highs);
+  const std::vector<HighsGenerationRound>& rounds = highs.getGenerationRounds();
+  REQUIRE(rounds.size() > 1);
+  REQUIRE(rounds.back().num_new_row == 0);
+  const double objective = highs.getInfo().objective_function_value;
+  const double all_patterns_objective = allPatternsObjective();
+  REQUIRE(std::fabs(objective - all_patterns_objective) <=
+          1e-8 * all_patterns_objective);
+}
+
+TEST_CASE("generate-max-round", "[highs_generation]") {
+  // Add columns to an LP once, after which it is solved again
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+  const HighsInt num_col = highs.getNumCol();
+  HighsGenerationCallback callback = [&](const HighsSolution& solution,
+                                         HighsGeneration& generation) {
+    // Add a copy of the first column with a lower cost
+    const HighsLp& lp = highs.getLp();
+    const HighsInt from_el = lp.a_matrix_.start_[0];
+    const HighsInt to_el = lp.a_matrix_.start_[1];
+    generation.addCol(lp.col_cost_[0] - 1, 0, 1, to_el - from_el,
+                      &lp.a_matrix_.index_[from_el],
+                      &lp.a_matrix_.value_[from_el]);
+  };
+  REQUIRE(highs.generate(callback, 1) == HighsStatus::kWarning);
+  const std::vector<HighsGenerationRound>& rounds = highs.getGenerationRounds();
+  REQUIRE(rounds.size() == 2);
+  REQUIRE(rounds[0].num_new_col == 1);
+  REQUIRE(rounds[1].num_new_col == 0);
+  REQUIRE(highs.getNumCol() == num_col + 1);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  // Generation is only for LPs
+  highs.changeColIntegrality(0, HighsVarType::kInteger);
+  REQUIRE(highs.generate(callback) == HighsStatus::kError);
+}
+
+TEST_CASE("generate-lazy-rows", "[highs_generation]") {
+  // Solve an LP by adding its rows when they are violated, starting
+  // without any. The columns are bounded so that the LPs are bounded
+  const double col_bound = 1e4;
+  Highs full;
+  full.setOptionValue("output_flag", false);
+  full.readModel(std::string(HIGHS_DIR) + "/check/instances/25fv47.mps");
+  HighsLp lp = full.getLp();
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    lp.col_lower_[iCol] = std::max(lp.col_lower_[iCol], -col_bound);
+    lp.col_upper_[iCol] = std::min(lp.col_upper_[iCol], col_bound);
+  }
+  full.passModel(lp);
+  REQUIRE(full.run() == HighsStatus::kOk);
+  lp.a_matrix_.ensureRowwise();
+  const HighsSparseMatrix& ar_matrix = lp.a_matrix_;
+  std::vector<bool> in_lp(lp.num_row_, false);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.addCols(lp.num_col_, lp.col_cost_.data(), lp.col_lower_.data(),
+                lp.col_upper_.data(), 0, nullptr, nullptr, nullptr);
+  highs.changeObjectiveOffset(lp.offset_);
+  HighsGenerationCallback callback = [&](const HighsSolution& solution,
+                                         HighsGeneration& generation) {
+    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+      if (in_lp[iRow]) continue;
+      double activity = 0;
+      for (HighsInt iEl = ar_matrix.start_[iRow];
+           iEl < ar_matrix.start_[iRow + 1]; iEl++)
+        activity +=
+            ar_matrix.value_[iEl] * solution.col_value[ar_matrix.index_[iEl]];
+      if (activity >= lp.row_lower_[iRow] - 1e-7 &&
+          activity <= lp.row_upper_[iRow] + 1e-7)
+        continue;
+      in_lp[iRow] = true;
+      const HighsInt from_el = ar_matrix.start_[iRow];
+      generation.addRow(lp.row_lower_[iRow], lp.row_upper_[iRow],
+                        ar_matrix.start_[iRow + 1] - from_el,
+                        &ar_matrix.index_[from_el], &ar_matrix.value_[from_el]);
+    }
+  };
+  REQUIRE(highs.generate(callback) == HighsStatus::kOk);
+  reportRounds(highs);
+  const double objective = highs.getInfo().objective_function_value;
+  const double full_objective = full.getInfo().objective_function_value;
+  REQUIRE(std::fabs(objective - full_objective) <=
+          1e-8 * std::max(1.0, std::fabs(full_objective)));
+}
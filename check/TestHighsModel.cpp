@@ -127,3 +127,136 @@ TEST_CASE("highs-integrality", "[highs_model]") {
   REQUIRE(highs.getColIntegrality(0, integrality) == HighsStatus::kOk);
   REQUIRE(integrality == HighsVarType::kInteger);
 }
+
+// Form a block-diagonal LP from copies of an LP, with an optional
+// linking row over all of the columns
+static HighsLp blockDiagonalLp(const HighsLp& lp, const HighsInt num_copy,
+                               const bool linking_row) {
+  HighsLp block_lp;
+  block_lp.num_col_ = num_copy * lp.num_col_;
+  block_lp.num_row_ = num_copy * lp.num_row_;
+  block_lp.sense_ = lp.sense_;
+  block_lp.offset_ = num_copy * lp.offset_;
+  block_lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  block_lp.a_matrix_.num_col_ = block_lp.num_col_;
+  block_lp.a_matrix_.num_row_ = block_lp.num_row_;
+  for (HighsInt iCopy = 0; iCopy < num_copy; iCopy++) {
+    const HighsInt row_offset = iCopy * lp.num_row_;
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+      block_lp.col_cost_.push_back(lp.col_cost_[iCol]);
+      block_lp.col_lower_.push_back(lp.col_lower_[iCol]);
+      block_lp.col_upper_.push_back(lp.col_upper_[iCol]);
+      if (lp.integrality_.size())
+        block_lp.integrality_.push_back(lp.integrality_[iCol]);
+      for (HighsInt iEl = lp.a_matrix_.start_[iCol];
+           iEl < lp.a_matrix_.start_[iCol + 1]; iEl++) {
+        block_lp.a_matrix_.index_.push_back(row_offset +
+                                            lp.a_matrix_.index_[iEl]);
+        block_lp.a_matrix_.value_.push_back(lp.a_matrix_.value_[iEl]);
+      }
+      if (linking_row) {
+        block_lp.a_matrix_.index_.push_back(block_lp.num_row_);
+        block_lp.a_matrix_.value_.push_back(1.0);
+      }
+      block_lp.a_matrix_.start_.push_back(block_lp.a_matrix_.index_.size());
+    }
+    block_lp.row_lower_.insert(block_lp.row_lower_.end(),
+                               lp.row_lower_.begin(), lp.row_lower_.end());
+    block_lp.row_upper_.insert(block_lp.row_upper_.end(),
+                               lp.row_upper_.begin(), lp.row_upper_.end());
+  }
+  if (linking_row) {
+    block_lp.num_row_++;
+    block_lp.a_matrix_.num_row_++;
+    block_lp.row_lower_.push_back(-kHighsInf);
+    block_lp.row_upper_.push_back(kHighsInf);
+  }
+  return block_lp;
+}
+
+TEST_CASE("highs-block-structure", "[highs_model]") {
+  const HighsInt num_copy = 3;
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/adlittle.mps");
+  const HighsLp lp = highs.getLp();
+  HighsBlockStructure block_structure;
+  REQUIRE(highs.getBlockStructure(block_structure) == HighsStatus::kOk);
+  REQUIRE(block_structure.num_block == 1);
+  REQUIRE(block_structure.num_linking_row == 0);
+
+  for (HighsInt k = 0; k < 2; k++) {
+    const bool linking_row = k == 1;
+    REQUIRE(highs.passModel(blockDiagonalLp(lp, num_copy, linking_row)) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.getBlockStructure(block_structure) == HighsStatus::kOk);
+    REQUIRE(block_structure.num_block == num_copy);
+    REQUIRE(block_structure.num_linking_row == (linking_row ? 1 : 0));
+    for (HighsInt iCopy = 0; iCopy < num_copy; iCopy++) {
+      for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+        REQUIRE(block_structure.col_block[iCopy * lp.num_col_ + iCol] ==
+                iCopy);
+      for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+        REQUIRE(block_structure.row_block[iCopy * lp.num_row_ + iRow] ==
+                iCopy);
+    }
+    if (linking_row)
+      REQUIRE(block_structure.row_block[num_copy * lp.num_row_] == -1);
+  }
+}
+
+TEST_CASE("highs-solve-components", "[highs_model]") {
+  const HighsInt num_copy = 4;
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (HighsInt k = 0; k < 2; k++) {
+    const bool mip = k == 1;
+    const std::string model = mip ? "flugpl" : "adlittle";
+    highs.readModel(std::string(HIGHS_DIR) + "/check/instances/" + model +
+                    ".mps");
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    const double objective = highs.getInfo().objective_function_value;
+    const HighsLp block_lp = blockDiagonalLp(highs.getLp(), num_copy, false);
+
+    Highs::resetGlobalScheduler(true);
+    highs.setOptionValue("threads", 2);
+    highs.setOptionValue("solve_components", true);
+    highs.passModel(block_lp);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const HighsInfo& info = highs.getInfo();
+    REQUIRE(std::fabs(info.objective_function_value - num_copy * objective) <
+            1e-6 * std::max(1.0, std::fabs(objective)));
+    REQUIRE(info.primal_solution_status == kSolutionStatusFeasible);
+    if (mip) {
+      REQUIRE(info.mip_gap < 1e-4);
+    } else {
+      REQUIRE(info.dual_solution_status == kSolutionStatusFeasible);
+      REQUIRE(info.basis_validity == kBasisValidityValid);
+      // The assembled basis is optimal for the whole model
+      highs.setOptionValue("solve_components", false);
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getInfo().simplex_iteration_count == 0);
+    }
+    highs.resetOptions();
+    highs.setOptionValue("output_flag", dev_run);
+    Highs::resetGlobalScheduler(true);
+  }
+
+  // Making one component infeasible makes the model infeasible
+  HighsLp lp;
+  lp.num_col_ = 4;
+  lp.num_row_ = 2;
+  lp.col_cost_ = {1, 1, 1, 1};
+  lp.col_lower_ = {0, 0, 0, 0};
+  lp.col_upper_ = {1, 1, 1, 1};
+  lp.row_lower_ = {1, 3};
+  lp.row_upper_ = {inf, inf};
+  lp.a_matrix_.start_ = {0, 1, 2, 3, 4};
+  lp.a_matrix_.index_ = {0, 0, 1, 1};
+  lp.a_matrix_.value_ = {1, 1, 1, 1};
+  highs.setOptionValue("solve_components", true);
+  highs.passModel(lp);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+}
@@ -81,3 +81,41 @@ TEST_CASE("test-analytic-centre-box", "[highs_ipm]") {
   REQUIRE(solution_norm < 1e-6);
   if (dev_run) printf("Analytic centre solution norm is %g\n", solution_norm);
 }
+
+TEST_CASE("test-ipx-cholesky", "[highs_ipm]") {
+  std::vector<std::string> models = {"afiro", "adlittle", "shell", "25fv47"};
+  for (const std::string& model : models) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.readModel(filename);
+    highs.run();
+    const double objective = highs.getInfo().objective_function_value;
+
+    highs.setOptionValue("solver", kIpmString);
+    highs.setOptionValue("ipx_kkt_solver", kIpxKktSolverCholesky);
+    for (HighsInt presolve = 0; presolve < 2; presolve++) {
+      highs.setOptionValue("presolve",
+                           presolve ? kHighsOnString : kHighsOffString);
+      for (HighsInt crossover = 0; crossover < 2; crossover++) {
+        highs.setOptionValue("run_crossover",
+                             crossover ? kHighsOnString : kHighsOffString);
+        highs.clearSolver();
+        REQUIRE(highs.run() == HighsStatus::kOk);
+        REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+        const double ipm_objective = highs.getInfo().objective_function_value;
+        if (dev_run)
+          printf("%s presolve %d crossover %d: objective %g (%g)\n",
+                 model.c_str(), int(presolve), int(crossover), ipm_objective,
+                 objective);
+        // Without crossover, the interior solution is only accurate to
+        // the IPM tolerances
+        const double tolerance = crossover ? 1e-8 : 1e-4;
+        REQUIRE(std::fabs(ipm_objective - objective) <=
+                tolerance * std::max(1.0, std::fabs(objective)));
+        if (crossover) REQUIRE(highs.getBasis().valid);
+      }
+    }
+  }
+}
@@ -1,7 +1,12 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
 #include "filereaderlp/reader.hpp"
+#include "io/FilereaderLp.h"
 
 const bool dev_run = false;
 
@@ -20,3 +25,182 @@ TEST_CASE("lp-file-format-quad-no-space", "[LpFileFormat]") {
 
   // todo: read the coefficients/variables off the highs model
 }
+
+// Compare the model read from an LP file with and without the single
+// pass streaming reader
+void streamLpModelTest(const std::string& filename) {
+  HighsOptions options;
+  options.output_flag = dev_run;
+  std::vector<HighsModel> model(2);
+  std::vector<FilereaderRetcode> retcode(2);
+  for (HighsInt k = 0; k < 2; k++) {
+    options.lp_parser_streaming = k == 1;
+    FilereaderLp reader;
+    retcode[k] = reader.readModelFromFile(options, filename, model[k]);
+  }
+  REQUIRE(retcode[1] == retcode[0]);
+  if (retcode[0] != FilereaderRetcode::kOk) return;
+  const HighsLp& lp_original = model[0].lp_;
+  const HighsLp& lp_stream = model[1].lp_;
+  REQUIRE(model[1] == model[0]);
+  REQUIRE(lp_stream.a_matrix_ == lp_original.a_matrix_);
+  REQUIRE(lp_stream.col_cost_ == lp_original.col_cost_);
+  REQUIRE(lp_stream.col_lower_ == lp_original.col_lower_);
+  REQUIRE(lp_stream.col_upper_ == lp_original.col_upper_);
+  REQUIRE(lp_stream.row_lower_ == lp_original.row_lower_);
+  REQUIRE(lp_stream.row_upper_ == lp_original.row_upper_);
+  REQUIRE(lp_stream.integrality_ == lp_original.integrality_);
+  REQUIRE(lp_stream.col_names_ == lp_original.col_names_);
+  REQUIRE(lp_stream.row_names_ == lp_original.row_names_);
+  REQUIRE(lp_stream.objective_name_ == lp_original.objective_name_);
+  REQUIRE(lp_stream.offset_ == lp_original.offset_);
+  REQUIRE(lp_stream.sense_ == lp_original.sense_);
+  REQUIRE(model[1].hessian_ == model[0].hessian_);
+}
+
+// Write a synthetic LP file using all the features of the sections
+// handled by the streaming reader
+void writeSyntheticLp(const std::string& filename, const HighsInt num_row,
+                      const HighsInt num_col) {
+  std::ofstream f(filename);
+  f << "\\ Synthetic LP file\nMaximize\n obj: 2.5";
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    if (iCol % 10 == 0) f << "\n";
+    if (iCol % 9 == 2)
+      f << " - x" << iCol;
+    else if (iCol % 4 != 1)
+      f << " + " << iCol % 7 << " x" << iCol;
+  }
+  f << "\n /* a comment\n over lines */ + [ x0 ^ 2 + 2 x0 * x1"
+       " - x2 * x3 + 0 x4 ^ 2 + x1^2 ]/2\nSubject To\n";
+  const HighsInt num_nz_per_row = std::min(HighsInt{6}, num_col);
+  const char* comparison[] = {"<=", ">=", "="};
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    if (iRow % 3) f << " r" << iRow << ":";
+    for (HighsInt k = 0; k < num_nz_per_row; k++) {
+      const HighsInt iCol = (iRow + k * (num_col / num_nz_per_row)) % num_col;
+      if (k == 3 && iRow % 2) f << "\n  ";
+      if (iRow % 5 == k)
+        f << " - x" << iCol;
+      else
+        f << " + " << (k + 1) << (iRow % 6 == 0 ? ".5e0" : ".25") << " x"
+          << iCol;
+    }
+    // A constant, a zero coefficient and a repeated column
+    if (iRow % 11 == 1) f << " + 3 + 0 x" << iRow % num_col << " - x0";
+    f << " " << comparison[iRow % 3] << " "
+      << (iRow % 4 ? iRow : -iRow) << "\n";
+  }
+  f << "Bounds\n";
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const std::string name = "x" + std::to_string(iCol);
+    switch (iCol % 7) {
+      case 0:
+        f << " " << name << " free\n";
+        break;
+      case 1:
+        f << " -3 <= " << name << " <= " << iCol % 5 + 1 << "\n";
+        break;
+      case 2:
+        f << " " << name << " >= -2\n";
+        break;
+      case 3:
+        f << " 4 <= " << name << "\n";
+        break;
+      case 4:
+        f << " " << name << " = 1.5\n";
+        break;
+      case 5:
+        f << " " << name << " <= inf\n";
+        break;
+      default:;
+    }
+  }
+  // Integrality sections in the order written by HiGHS, with columns
+  // that only occur in these sections
+  f << "Binaries\n binary_only";
+  for (HighsInt iCol = 3; iCol < num_col; iCol += 10) f << " x" << iCol;
+  f << "\nGenerals\n general_only binary_only";
+  for (HighsInt iCol = 4; iCol < num_col; iCol += 10) f << " x" << iCol;
+  f << "\nSemi-Continuous\n semi_only";
+  for (HighsInt iCol = 4; iCol < num_col; iCol += 5) f << " x" << iCol;
+  f << "\nEnd\n";
+}
+
+TEST_CASE("lp-file-format-stream", "[LpFileFormat]") {
+  const std::vector<std::string> models = {
+      "1448",    "1449a", "1449b", "1451", "fixed-binary", "garbage",
+      "no-newline-eof", "qcqp", "qjh", "qjh_uncon", "qpinfeasible",
+      "qptestnw", "qpunbounded", "semi-continuous", "semi-integer"};
+  for (const std::string& model : models)
+    streamLpModelTest(std::string(HIGHS_DIR) + "/check/instances/" + model +
+                      ".lp");
+
+  const std::string filename = "synthetic.lp";
+  writeSyntheticLp(filename, 50, 200);
+  streamLpModelTest(filename);
+
+  // Files that are left to the original reader, as well as some
+  // small ones handled by the streaming reader
+  const std::vector<std::string> files = {
+      // SOS
+      "min\n x + y\nst\n x + y >= 1\nsos\n s1: S1:: x:1 y:2\nend\n",
+      // Bounds before constraints
+      "min\n x + y\nbounds\n x <= 4\nst\n c: x + y >= 1\nend\n",
+      // Repeated section
+      "min\n x\nst\n x >= 1\nst\n y >= 1\nend\n",
+      // Tokens after end
+      "min\n x\nst\n x >= 1\nend\n x\n",
+      // No end
+      "min\n x\nst\n x >= 1\n",
+      // Comment whose end is not found
+      "min\n x /* a comment */ + y\nst\n x >= 1\nend\n",
+      // Empty objective
+      "min\nst\n x >= 1\nend\n",
+      // Strict inequality
+      "min\n x\nst\n x > 1\nend\n",
+      // Indicator constraint
+      "min\n x\nst\n b = 1 -> x >= 1\nend\n",
+      // Repeated integrality section keyword, unnamed constraints,
+      // and constraint names beginning HiGHS_R
+      "max x\nsubject to\n x + y <= 1\n HiGHS_R7: x - y >= 0\n"
+      "integers x integers y\nend",
+      "minimize\n - - x + + y\nsuch that\n HiGHS_R1: x >= 1\n"
+      " y <= 2\nsemi y\nbounds\n y <= 3\nend\n"};
+  for (const std::string& contents : files) {
+    std::ofstream f(filename);
+    f << contents;
+    f.close();
+    streamLpModelTest(filename);
+  }
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("lp-file-format-stream-throughput", "[LpFileFormat]") {
+  // Compare the time taken by the LP file reader with and without
+  // streaming for a model with 10^5 (10^7 when dev_run) nonzeros
+  const HighsInt num_row = dev_run ? 2000000 : 20000;
+  const std::string filename = "throughput.lp";
+  writeSyntheticLp(filename, num_row, num_row / 2);
+  std::ifstream size_file(filename, std::ios::binary | std::ios::ate);
+  const double megabytes = size_file.tellg() / 1e6;
+  size_file.close();
+  HighsOptions options;
+  options.output_flag = dev_run;
+  std::vector<HighsModel> model(2);
+  for (HighsInt k = 0; k < 2; k++) {
+    options.lp_parser_streaming = k == 1;
+    FilereaderLp reader;
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE(reader.readModelFromFile(options, filename, model[k]) ==
+            FilereaderRetcode::kOk);
+    const double time = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+    if (dev_run)
+      printf("%s reader reads %.1f MB in %.3fs: %.1f MB/s\n",
+             k ? "Streaming" : "Original", megabytes, time, megabytes / time);
+  }
+  REQUIRE(model[1] == model[0]);
+  std::remove(filename.c_str());
+}
@@ -1,6 +1,10 @@
+#include <algorithm>
+#include <chrono>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
+#include "util/HighsRandom.h"
 
 const bool dev_run = false;
 
@@ -313,6 +317,132 @@ TEST_CASE("mip-with-lp-solver", "[highs_lp_solver]") {
   REQUIRE(status == HighsStatus::kOk);
 }
 
+TEST_CASE("concurrent-lp-solver", "[highs_lp_solver]") {
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 3);
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+
+  highs.setOptionValue("solver", kConcurrentString);
+  for (HighsInt k = 0; k < 2; k++) {
+    // Solve with and without presolve
+    highs.setOptionValue("presolve", k == 0 ? kHighsOffString : kHighsOnString);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double objective = highs.getInfo().objective_function_value;
+    REQUIRE(std::fabs(objective - optimal_objective) <
+            1e-6 * std::max(1.0, std::fabs(optimal_objective)));
+  }
+
+  // Simplex cannot determine the model status, so IPM or PDLP wins
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("simplex_iteration_limit", 1);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) <
+          1e-6 * std::max(1.0, std::fabs(optimal_objective)));
+  highs.setOptionValue("simplex_iteration_limit", kHighsIInf);
+
+  // The concurrent solver must also determine infeasibility
+  filename = std::string(HIGHS_DIR) + "/check/instances/galenet.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("parallel-iteration-dual", "[highs_lp_solver]") {
+  // A covering LP that is large enough for the loops of the dual
+  // simplex iterations to be partitioned across threads. Each row is
+  // covered by a column with a bidiagonal pattern, and by some columns
+  // with random patterns. A dense budget row makes the pivotal rows
+  // dense
+  const HighsInt num_cover_row = 10000;
+  const HighsInt num_random_col = 4000;
+  const HighsInt col_num_nz = 3;
+  HighsRandom random;
+  HighsLp lp;
+  lp.num_col_ = num_cover_row + num_random_col;
+  lp.num_row_ = num_cover_row + 1;
+  lp.row_lower_.assign(num_cover_row, 1);
+  lp.row_upper_.assign(num_cover_row, kHighsInf);
+  lp.row_lower_.push_back(0.6 * num_cover_row);
+  lp.row_upper_.push_back(0.6 * num_cover_row);
+  lp.col_lower_.assign(lp.num_col_, 0);
+  lp.col_upper_.assign(lp.num_col_, 1);
+  HighsSparseMatrix& matrix = lp.a_matrix_;
+  matrix.num_col_ = lp.num_col_;
+  matrix.num_row_ = lp.num_row_;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    lp.col_cost_.push_back(1 + random.fraction());
+    const HighsInt from_el = matrix.index_.size();
+    if (iCol < num_cover_row) {
+      matrix.index_.push_back(iCol);
+      if (iCol + 1 < num_cover_row) matrix.index_.push_back(iCol + 1);
+    } else {
+      while (HighsInt(matrix.index_.size()) < from_el + col_num_nz) {
+        const HighsInt iRow = random.integer(num_cover_row);
+        if (std::find(matrix.index_.begin() + from_el, matrix.index_.end(),
+                      iRow) == matrix.index_.end())
+          matrix.index_.push_back(iRow);
+      }
+    }
+    matrix.index_.push_back(num_cover_row);
+    matrix.value_.resize(matrix.index_.size(), 1);
+    matrix.start_.push_back(matrix.index_.size());
+  }
+
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("solver", kSimplexString);
+  highs.setOptionValue("simplex_strategy", kSimplexStrategyDual);
+  // Limit the iterations so that the test is quick when threads must
+  // share cores
+  highs.setOptionValue("simplex_iteration_limit", dev_run ? kHighsIInf : 20);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  auto start = std::chrono::steady_clock::now();
+  const HighsStatus run_status = highs.run();
+  REQUIRE(run_status != HighsStatus::kError);
+  const double serial_time = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+  const HighsModelStatus model_status = highs.getModelStatus();
+  const HighsInt iteration_count = highs.getInfo().simplex_iteration_count;
+  const double objective = highs.getInfo().objective_function_value;
+  const std::vector<double> col_value = highs.getSolution().col_value;
+  const std::vector<HighsBasisStatus> col_status = highs.getBasis().col_status;
+
+  // The parallel iterations are identical
+  highs.setOptionValue("simplex_parallel_iteration", true);
+  highs.clearSolver();
+  start = std::chrono::steady_clock::now();
+  REQUIRE(highs.run() == run_status);
+  const double parallel_time = std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+  REQUIRE(highs.getModelStatus() == model_status);
+  REQUIRE(highs.getInfo().simplex_iteration_count == iteration_count);
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+  REQUIRE(highs.getSolution().col_value == col_value);
+  REQUIRE(highs.getBasis().col_status == col_status);
+  if (dev_run)
+    printf("Serial dual simplex: %d iterations in %g s; parallel in %g s\n",
+           int(iteration_count), serial_time, parallel_time);
+  Highs::resetGlobalScheduler(true);
+}
+
 TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   std::string filename;
   HighsStatus status;
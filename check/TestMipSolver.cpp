@@ -688,6 +688,33 @@ TEST_CASE("IP-with-fract-bounds-no-presolve", "[highs_test_mip_solver]") {
   REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
 }
 
+TEST_CASE("MIP-race", "[highs_test_mip_solver]") {
+  const double flugpl_optimal_objective = 1201500;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  // The race needs more than one thread
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("mip_race_concurrency", 2);
+  highs.readModel(filename);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(objectiveOk(highs.getInfo().objective_function_value,
+                      flugpl_optimal_objective, dev_run));
+
+  // Racing on the maximization form of the same model
+  HighsLp lp = highs.getLp();
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) lp.col_cost_[iCol] *= -1;
+  lp.sense_ = ObjSense::kMaximize;
+  highs.passModel(lp);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(objectiveOk(highs.getInfo().objective_function_value,
+                      -flugpl_optimal_objective, dev_run));
+  Highs::resetGlobalScheduler(true);
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective, const bool dev_run) {
   double error = std::fabs(optimal_objective - require_optimal_objective) /
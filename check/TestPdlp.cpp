@@ -174,3 +174,36 @@ TEST_CASE("pdlp-unbounded-lp", "[pdlp]") {
     REQUIRE(highs.getModelStatus() == HighsModelStatus::kUnbounded);
   }
 }
+
+TEST_CASE("pdlp-threads", "[pdlp]") {
+  // The multithreaded CPU kernels must give the same iterates as the
+  // serial path, so PDLP should stop at the same point whatever the
+  // number of threads. 80bau3b has enough nonzeros for the
+  // matrix-vector products to be performed in parallel
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps";
+  const HighsInt pdlp_iteration_limit = 100;
+  std::vector<double> col_value;
+  double objective_function_value = 0;
+  for (HighsInt threads = 1; threads <= 2; threads++) {
+    Highs::resetGlobalScheduler(true);
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("threads", threads);
+    highs.setOptionValue("solver", kPdlpString);
+    highs.setOptionValue("presolve", kHighsOffString);
+    highs.setOptionValue("pdlp_iteration_limit", pdlp_iteration_limit);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kWarning);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kIterationLimit);
+    if (threads == 1) {
+      col_value = highs.getSolution().col_value;
+      objective_function_value = highs.getInfo().objective_function_value;
+    } else {
+      REQUIRE(highs.getSolution().col_value == col_value);
+      REQUIRE(highs.getInfo().objective_function_value ==
+              objective_function_value);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
@@ -601,3 +601,77 @@ TEST_CASE("write-presolved-model", "[highs_test_presolve]") {
   REQUIRE(highs.getInfo().simplex_iteration_count == -1);
   std::remove(presolved_model_file.c_str());
 }
+
+TEST_CASE("presolve-parallel-hashing", "[highs_test_presolve]") {
+  // An LP with more than 10^5 nonzeros and many parallel columns, for
+  // which the hash values in the detection of parallel rows and
+  // columns are computed in parallel when there are several
+  // threads. The presolved LP should not depend on the number of
+  // threads
+  const HighsInt num_base_col = 12000;
+  const HighsInt num_row = 4000;
+  const HighsInt num_nz_per_col = 8;
+  const HighsInt row_stride = num_row / num_nz_per_col;
+  HighsLp lp;
+  lp.num_row_ = num_row;
+  lp.row_lower_.assign(num_row, -kHighsInf);
+  lp.row_upper_.assign(num_row, 1000);
+  uint64_t seed = 1;
+  auto random = [&](HighsInt n) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    return HighsInt((seed >> 33) % uint64_t(n));
+  };
+  // Completes a column whose entries have been added
+  auto addCol = [&](const double cost) {
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+    lp.col_cost_.push_back(cost);
+    lp.col_lower_.push_back(0);
+    lp.col_upper_.push_back(10);
+    lp.num_col_++;
+  };
+  for (HighsInt iCol = 0; iCol < num_base_col; iCol++) {
+    // One entry in each of num_nz_per_col distinct bands of rows
+    const HighsInt start = lp.a_matrix_.index_.size();
+    for (HighsInt k = 0; k < num_nz_per_col; k++) {
+      lp.a_matrix_.index_.push_back(k * row_stride + random(row_stride));
+      lp.a_matrix_.value_.push_back(1.0 + random(20));
+    }
+    const double cost = -1.0 - random(10);
+    addCol(cost);
+    // Every tenth column has a parallel copy with a different scale
+    // and correspondingly scaled cost, so they can be merged
+    if (iCol % 10 != 0) continue;
+    for (HighsInt iEl = start; iEl < start + num_nz_per_col; iEl++) {
+      lp.a_matrix_.index_.push_back(lp.a_matrix_.index_[iEl]);
+      lp.a_matrix_.value_.push_back(2 * lp.a_matrix_.value_[iEl]);
+    }
+    addCol(2 * cost);
+  }
+  lp.a_matrix_.num_col_ = lp.num_col_;
+  lp.a_matrix_.num_row_ = lp.num_row_;
+  REQUIRE(lp.a_matrix_.numNz() > 100000);
+
+  std::vector<HighsLp> presolved_lp;
+  for (const HighsInt threads : {1, 2}) {
+    Highs::resetGlobalScheduler(true);
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("threads", threads);
+    REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+    REQUIRE(highs.presolve() == HighsStatus::kOk);
+    REQUIRE(highs.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+    presolved_lp.push_back(highs.getPresolvedLp());
+  }
+  Highs::resetGlobalScheduler(true);
+  const HighsLp& lp0 = presolved_lp[0];
+  const HighsLp& lp1 = presolved_lp[1];
+  REQUIRE(lp0.num_col_ < lp.num_col_);
+  REQUIRE(lp1.num_col_ == lp0.num_col_);
+  REQUIRE(lp1.num_row_ == lp0.num_row_);
+  REQUIRE(lp1.a_matrix_ == lp0.a_matrix_);
+  REQUIRE(lp1.col_cost_ == lp0.col_cost_);
+  REQUIRE(lp1.col_lower_ == lp0.col_lower_);
+  REQUIRE(lp1.col_upper_ == lp0.col_upper_);
+  REQUIRE(lp1.row_lower_ == lp0.row_lower_);
+  REQUIRE(lp1.row_upper_ == lp0.row_upper_);
+}
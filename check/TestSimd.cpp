@@ -0,0 +1,201 @@
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include "HCheckConfig.h"
+#include "Highs.h"
+#include "catch.hpp"
+#include "util/HighsRandom.h"
+#include "util/HighsSimd.h"
+
+const bool dev_run = false;
+
+// Data for the kernels, with a sprinkling of tiny values
+struct SimdData {
+  HighsInt dim;
+  std::vector<double> array;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  std::vector<int8_t> move;
+  std::vector<double> weight;
+  SimdData(const HighsInt dim_) : dim(dim_) {
+    HighsRandom random;
+    for (HighsInt k = 0; k < dim; k++) {
+      const double tiny = random.fraction() < 0.1 ? 1e-15 : 1;
+      array.push_back(tiny * (random.fraction() - 0.3));
+      value.push_back(random.fraction() - 0.5);
+      move.push_back(int8_t(random.integer(3) - 1));
+      weight.push_back(0.5 + random.fraction());
+      index.push_back(k);
+    }
+    // A random order of distinct indices
+    random.shuffle(index.data(), dim);
+  }
+};
+
+// Results of the kernels, which must not depend on the level
+struct SimdResult {
+  std::vector<double> row_update;
+  std::vector<double> sparse_dot;
+  std::vector<HighsInt> pack_index;
+  std::vector<double> pack_value;
+  std::vector<std::pair<HighsInt, double>> possible;
+  std::vector<HighsInt> best_index;
+  std::vector<double> best_merit;
+  std::vector<double> tight;
+};
+
+static bool bitwiseEqual(const std::vector<double>& v0,
+                         const std::vector<double>& v1) {
+  return v0.size() == v1.size() &&
+         (v0.empty() ||
+          std::memcmp(v0.data(), v1.data(), v0.size() * sizeof(double)) == 0);
+}
+
+static bool sameResult(const SimdResult& r0, const SimdResult& r1) {
+  return bitwiseEqual(r0.row_update, r1.row_update) &&
+         bitwiseEqual(r0.sparse_dot, r1.sparse_dot) &&
+         r0.pack_index == r1.pack_index &&
+         bitwiseEqual(r0.pack_value, r1.pack_value) &&
+         r0.possible == r1.possible && r0.best_index == r1.best_index &&
+         bitwiseEqual(r0.best_merit, r1.best_merit) &&
+         bitwiseEqual(r0.tight, r1.tight);
+}
+
+// Run each kernel with counts that exercise the vector and scalar
+// parts, returning the time taken by each
+static std::vector<double> runKernels(const SimdData& data,
+                                      const HighsInt num_repeat,
+                                      SimdResult& result) {
+  const HighsInt dim = data.dim;
+  std::vector<double> kernel_time;
+  auto start = std::chrono::steady_clock::now();
+  auto lap = [&]() {
+    auto now = std::chrono::steady_clock::now();
+    kernel_time.push_back(std::chrono::duration<double>(now - start).count());
+    start = now;
+  };
+  result.row_update.assign(dim, 0);
+  for (HighsInt repeat = 0; repeat < num_repeat; repeat++)
+    for (HighsInt count = dim - 3; count <= dim; count++)
+      highsSimdRowUpdate(result.row_update.data(), data.index.data(),
+                         data.value.data(), count, 1.0 / (count + repeat));
+  lap();
+  result.sparse_dot.clear();
+  for (HighsInt repeat = 0; repeat < num_repeat; repeat++)
+    for (HighsInt count = dim - 7; count <= dim; count++)
+      result.sparse_dot.push_back(highsSimdSparseDot(
+          data.array.data(), data.index.data(), data.value.data(), count));
+  lap();
+  result.pack_index.assign(dim, 0);
+  result.pack_value.assign(dim, 0);
+  for (HighsInt repeat = 0; repeat < num_repeat; repeat++)
+    highsSimdGatherPack(data.array.data(), data.index.data(), dim - 5, dim,
+                        result.pack_index.data(), result.pack_value.data());
+  lap();
+  result.possible.resize(dim);
+  HighsInt num_possible = 0;
+  for (HighsInt repeat = 0; repeat < num_repeat; repeat++)
+    num_possible = highsSimdFilterPossible(
+        data.index.data(), data.value.data(), dim - 1, data.move.data(), -1,
+        1e-2, result.possible.data());
+  result.possible.resize(num_possible);
+  lap();
+  result.best_index.clear();
+  result.best_merit.clear();
+  for (HighsInt repeat = 0; repeat < num_repeat; repeat++) {
+    double best_merit = 0;
+    const HighsInt from = repeat % dim;
+    HighsInt best_index = highsSimdChooseMerit(
+        data.array.data(), data.weight.data(), from, dim, best_merit, -1);
+    best_index = highsSimdChooseMerit(data.array.data(), data.weight.data(),
+                                      0, from, best_merit, best_index);
+    result.best_index.push_back(best_index);
+    result.best_merit.push_back(best_merit);
+  }
+  lap();
+  for (HighsInt repeat = 0; repeat < num_repeat; repeat++) {
+    result.tight = data.array;
+    highsSimdTight(result.tight.data(), dim - 1);
+  }
+  lap();
+  return kernel_time;
+}
+
+TEST_CASE("simd-kernels", "[highs_simd]") {
+  const HighsSimdLevel cpu_level = highsSimdCpuLevel();
+  if (dev_run)
+    printf("CPU supports %s kernels\n",
+           highsSimdLevelToString(cpu_level).c_str());
+  REQUIRE(highsSimdLevel() == cpu_level);
+  const SimdData data(1001);
+  SimdResult portable_result;
+  REQUIRE(highsSimdSetLevel(HighsSimdLevel::kPortable) ==
+          HighsSimdLevel::kPortable);
+  runKernels(data, 3, portable_result);
+  // Filtering possible candidates and scanning for the best merit
+  // are not trivial
+  REQUIRE(portable_result.possible.size() > 0);
+  REQUIRE(portable_result.possible.size() < data.index.size());
+  REQUIRE(portable_result.best_index[0] >= 0);
+  for (HighsInt level = 1; level <= HighsInt(cpu_level); level++) {
+    REQUIRE(highsSimdSetLevel(HighsSimdLevel(level)) ==
+            HighsSimdLevel(level));
+    SimdResult level_result;
+    runKernels(data, 3, level_result);
+    REQUIRE(sameResult(level_result, portable_result));
+  }
+  // A level that the CPU doesn't support isn't used
+  REQUIRE(highsSimdSetLevel(HighsSimdLevel::kAvx512) == cpu_level);
+}
+
+TEST_CASE("simd-benchmark", "[highs_simd]") {
+  // Time the kernels at each level that the CPU supports
+  const std::vector<std::string> kernel_name = {
+      "row update", "sparse dot",   "gather pack",
+      "filter",     "choose merit", "tight"};
+  const SimdData data(dev_run ? 100000 : 1000);
+  const HighsInt num_repeat = dev_run ? 1000 : 10;
+  const HighsInt cpu_level = HighsInt(highsSimdCpuLevel());
+  std::vector<std::vector<double>> level_time;
+  SimdResult portable_result;
+  for (HighsInt level = 0; level <= cpu_level; level++) {
+    highsSimdSetLevel(HighsSimdLevel(level));
+    SimdResult level_result;
+    level_time.push_back(runKernels(data, num_repeat, level_result));
+    if (level == 0) {
+      portable_result = level_result;
+    } else {
+      REQUIRE(sameResult(level_result, portable_result));
+    }
+  }
+  if (dev_run) {
+    printf("Kernel        ");
+    for (HighsInt level = 0; level <= cpu_level; level++)
+      printf(" %9s", highsSimdLevelToString(HighsSimdLevel(level)).c_str());
+    printf("\n");
+    for (size_t k = 0; k < kernel_name.size(); k++) {
+      printf("%-14s", kernel_name[k].c_str());
+      for (HighsInt level = 0; level <= cpu_level; level++)
+        printf(" %8.4fs", level_time[level][k]);
+      printf("\n");
+    }
+  }
+}
+
+TEST_CASE("simd-simplex", "[highs_simd]") {
+  // The simplex solver takes the same path with all kernels
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.readModel(std::string(HIGHS_DIR) + "/check/instances/25fv47.mps");
+  highsSimdSetLevel(HighsSimdLevel::kPortable);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInt iteration_count = highs.getInfo().simplex_iteration_count;
+  const double objective = highs.getInfo().objective_function_value;
+  highsSimdSetLevel(highsSimdCpuLevel());
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getInfo().simplex_iteration_count == iteration_count);
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+}
@@ -25,6 +25,7 @@ set(include_dirs_python
 set(cupdlp_sources_python
   src/pdlp/cupdlp/cupdlp_cs.c
   src/pdlp/cupdlp/cupdlp_linalg.c
+  src/pdlp/cupdlp/cupdlp_parallel.cpp
   src/pdlp/cupdlp/cupdlp_proj.c
   src/pdlp/cupdlp/cupdlp_restart.c
   src/pdlp/cupdlp/cupdlp_scaling_cuda.c
@@ -36,6 +37,7 @@ set(cupdlp_headers_python
   src/pdlp/cupdlp/cupdlp_cs.h
   src/pdlp/cupdlp/cupdlp_defs.h
   src/pdlp/cupdlp/cupdlp_linalg.h
+  src/pdlp/cupdlp/cupdlp_parallel.h
   src/pdlp/cupdlp/cupdlp_proj.h
   src/pdlp/cupdlp/cupdlp_restart.h
   src/pdlp/cupdlp/cupdlp_scaling_cuda.h
@@ -112,6 +114,7 @@ set(ipx_sources_python
   src/ipm/ipx/ipx_c.cc
   src/ipm/ipx/iterate.cc
   src/ipm/ipx/kkt_solver_basis.cc
+  src/ipm/ipx/kkt_solver_chol.cc
   src/ipm/ipx/kkt_solver_diag.cc
   src/ipm/ipx/kkt_solver.cc
   src/ipm/ipx/linear_operator.cc
@@ -121,6 +124,7 @@ set(ipx_sources_python
   src/ipm/ipx/maxvolume.cc
   src/ipm/ipx/model.cc
   src/ipm/ipx/normal_matrix.cc
+  src/ipm/ipx/sparse_cholesky.cc
   src/ipm/ipx/sparse_matrix.cc
   src/ipm/ipx/sparse_utils.cc
   src/ipm/ipx/splitted_normal_matrix.cc
@@ -150,6 +154,7 @@ set(ipx_sources_python
   src/ipm/ipx/ipx_status.h
   src/ipm/ipx/iterate.h
   src/ipm/ipx/kkt_solver_basis.h
+  src/ipm/ipx/kkt_solver_chol.h
   src/ipm/ipx/kkt_solver_diag.h
   src/ipm/ipx/kkt_solver.h
   src/ipm/ipx/linear_operator.h
@@ -161,6 +166,7 @@ set(ipx_sources_python
   src/ipm/ipx/multistream.h
   src/ipm/ipx/normal_matrix.h
   src/ipm/ipx/power_method.h
+  src/ipm/ipx/sparse_cholesky.h
   src/ipm/ipx/sparse_matrix.h
   src/ipm/ipx/sparse_utils.h
   src/ipm/ipx/splitted_normal_matrix.h
@@ -173,17 +179,22 @@ set(highs_sources_python
     extern/filereaderlp/reader.cpp
     src/interfaces/highs_c_api.cpp
     src/io/Filereader.cpp
+    src/io/FilereaderBinary.cpp
     src/io/FilereaderEms.cpp
     src/io/FilereaderLp.cpp
+    src/io/FilereaderLpStream.cpp
     src/io/FilereaderMps.cpp
     src/io/HighsIO.cpp
     src/io/HMpsFF.cpp
+    src/io/HMpsFFMapped.cpp
     src/io/HMPSIO.cpp
     src/io/LoadOptions.cpp
     src/ipm/IpxWrapper.cpp
     src/lp_data/Highs.cpp
+    src/lp_data/HighsBatchSolver.cpp
     src/lp_data/HighsCallback.cpp
     src/lp_data/HighsDebug.cpp
+    src/lp_data/HighsGeneration.cpp
     src/lp_data/HighsInfo.cpp
     src/lp_data/HighsInfoDebug.cpp
     src/lp_data/HighsInterface.cpp
@@ -224,6 +235,7 @@ set(highs_sources_python
     src/model/HighsHessian.cpp
     src/model/HighsHessianUtils.cpp
     src/model/HighsModel.cpp
+    src/model/HighsModelComponents.cpp
     src/parallel/HighsTaskExecutor.cpp
     src/pdlp/CupdlpWrapper.cpp
     src/presolve/HighsPostsolveStack.cpp
@@ -262,6 +274,7 @@ set(highs_sources_python
     src/test/DevKkt.cpp
     src/util/HFactor.cpp
     src/util/HFactorDebug.cpp
+    src/util/HFactorBlock.cpp
     src/util/HFactorExtend.cpp
     src/util/HFactorRefactor.cpp
     src/util/HFactorUtils.cpp
@@ -269,6 +282,7 @@ set(highs_sources_python
     src/util/HighsLinearSumBounds.cpp
     src/util/HighsMatrixPic.cpp
     src/util/HighsMatrixUtils.cpp
+    src/util/HighsSimd.cpp
     src/util/HighsSort.cpp
     src/util/HighsSparseMatrix.cpp
     src/util/HighsUtils.cpp
@@ -284,10 +298,12 @@ set(highs_headers_python
     extern/pdqsort/pdqsort.h
     src/interfaces/highs_c_api.h
     src/io/Filereader.h
+    src/io/FilereaderBinary.h
     src/io/FilereaderEms.h
     src/io/FilereaderLp.h
     src/io/FilereaderMps.h
     src/io/HighsIO.h
+    src/io/HighsMappedFile.h
     src/io/HMpsFF.h
     src/io/HMPSIO.h
     src/io/LoadOptions.h
@@ -295,9 +311,11 @@ set(highs_headers_python
     src/ipm/IpxWrapper.h
     src/lp_data/HConst.h
     src/lp_data/HighsAnalysis.h
+    src/lp_data/HighsBatchSolver.h
     src/lp_data/HighsCallback.h
     src/lp_data/HighsCallbackStruct.h
     src/lp_data/HighsDebug.h
+    src/lp_data/HighsGeneration.h
     src/lp_data/HighsInfo.h
     src/lp_data/HighsInfoDebug.h
     src/lp_data/HighsLp.h
@@ -324,6 +342,7 @@ set(highs_headers_python
     src/mip/HighsImplications.h
     src/mip/HighsLpAggregator.h
     src/mip/HighsLpRelaxation.h
+    src/mip/HighsMipRace.h
     src/mip/HighsMipSolver.h
     src/mip/HighsMipSolverData.h
     src/mip/HighsModkSeparator.h
@@ -341,6 +360,7 @@ set(highs_headers_python
     src/model/HighsHessian.h
     src/model/HighsHessianUtils.h
     src/model/HighsModel.h
+    src/model/HighsModelComponents.h
     src/parallel/HighsBinarySemaphore.h
     src/parallel/HighsCacheAlign.h
     src/parallel/HighsCombinable.h
@@ -421,6 +441,7 @@ set(highs_headers_python
     src/util/HighsMemoryAllocation.h
     src/util/HighsRandom.h
     src/util/HighsRbTree.h
+    src/util/HighsSimd.h
     src/util/HighsSort.h
     src/util/HighsSparseMatrix.h
     src/util/HighsSparseVectorSum.h
@@ -25,6 +25,7 @@ set(include_dirs
 set(cupdlp_sources
   pdlp/cupdlp/cupdlp_cs.c
   pdlp/cupdlp/cupdlp_linalg.c
+  pdlp/cupdlp/cupdlp_parallel.cpp
   pdlp/cupdlp/cupdlp_proj.c
   pdlp/cupdlp/cupdlp_restart.c
   pdlp/cupdlp/cupdlp_scaling_cuda.c
@@ -36,6 +37,7 @@ set(cupdlp_headers
   pdlp/cupdlp/cupdlp_cs.h
   pdlp/cupdlp/cupdlp_defs.h
   pdlp/cupdlp/cupdlp_linalg.h
+  pdlp/cupdlp/cupdlp_parallel.h
   pdlp/cupdlp/cupdlp_proj.h
   pdlp/cupdlp/cupdlp_restart.h
   pdlp/cupdlp/cupdlp_scaling_cuda.h
@@ -112,6 +114,7 @@ set(ipx_sources
   ipm/ipx/ipx_c.cc
   ipm/ipx/iterate.cc
   ipm/ipx/kkt_solver_basis.cc
+  ipm/ipx/kkt_solver_chol.cc
   ipm/ipx/kkt_solver_diag.cc
   ipm/ipx/kkt_solver.cc
   ipm/ipx/linear_operator.cc
@@ -121,6 +124,7 @@ set(ipx_sources
   ipm/ipx/maxvolume.cc
   ipm/ipx/model.cc
   ipm/ipx/normal_matrix.cc
+  ipm/ipx/sparse_cholesky.cc
   ipm/ipx/sparse_matrix.cc
   ipm/ipx/sparse_utils.cc
   ipm/ipx/splitted_normal_matrix.cc
@@ -150,6 +154,7 @@ set(ipx_headers
   ipm/ipx/ipx_status.h
   ipm/ipx/iterate.h
   ipm/ipx/kkt_solver_basis.h
+  ipm/ipx/kkt_solver_chol.h
   ipm/ipx/kkt_solver_diag.h
   ipm/ipx/kkt_solver.h
   ipm/ipx/linear_operator.h
@@ -161,6 +166,7 @@ set(ipx_headers
   ipm/ipx/multistream.h
   ipm/ipx/normal_matrix.h
   ipm/ipx/power_method.h
+  ipm/ipx/sparse_cholesky.h
   ipm/ipx/sparse_matrix.h
   ipm/ipx/sparse_utils.h
   ipm/ipx/splitted_normal_matrix.h
@@ -173,17 +179,22 @@ set(highs_sources
     ../extern/filereaderlp/reader.cpp
     interfaces/highs_c_api.cpp
     io/Filereader.cpp
+    io/FilereaderBinary.cpp
     io/FilereaderEms.cpp
     io/FilereaderLp.cpp
+    io/FilereaderLpStream.cpp
     io/FilereaderMps.cpp
     io/HighsIO.cpp
     io/HMpsFF.cpp
+    io/HMpsFFMapped.cpp
     io/HMPSIO.cpp
     io/LoadOptions.cpp
     ipm/IpxWrapper.cpp
     lp_data/Highs.cpp
+    lp_data/HighsBatchSolver.cpp
     lp_data/HighsCallback.cpp
     lp_data/HighsDebug.cpp
+    lp_data/HighsGeneration.cpp
     lp_data/HighsInfo.cpp
     lp_data/HighsInfoDebug.cpp
     lp_data/HighsDeprecated.cpp
@@ -225,6 +236,7 @@ set(highs_sources
     model/HighsHessian.cpp
     model/HighsHessianUtils.cpp
     model/HighsModel.cpp
+    model/HighsModelComponents.cpp
     parallel/HighsTaskExecutor.cpp
     pdlp/CupdlpWrapper.cpp
     presolve/HighsPostsolveStack.cpp
@@ -263,6 +275,7 @@ set(highs_sources
     test/DevKkt.cpp
     util/HFactor.cpp
     util/HFactorDebug.cpp
+    util/HFactorBlock.cpp
     util/HFactorExtend.cpp
     util/HFactorRefactor.cpp
     util/HFactorUtils.cpp
@@ -270,6 +283,7 @@ set(highs_sources
     util/HighsLinearSumBounds.cpp
     util/HighsMatrixPic.cpp
     util/HighsMatrixUtils.cpp
+    util/HighsSimd.cpp
     util/HighsSort.cpp
     util/HighsSparseMatrix.cpp
     util/HighsUtils.cpp
@@ -288,10 +302,12 @@ set(highs_headers
     ../extern/zstr/zstr.hpp
     interfaces/highs_c_api.h
     io/Filereader.h
+    io/FilereaderBinary.h
     io/FilereaderEms.h
     io/FilereaderLp.h
     io/FilereaderMps.h
     io/HighsIO.h
+    io/HighsMappedFile.h
     io/HMpsFF.h
     io/HMPSIO.h
     io/LoadOptions.h
@@ -299,9 +315,11 @@ set(highs_headers
     ipm/IpxWrapper.h
     lp_data/HConst.h
     lp_data/HighsAnalysis.h
+    lp_data/HighsBatchSolver.h
     lp_data/HighsCallback.h
     lp_data/HighsCallbackStruct.h
     lp_data/HighsDebug.h
+    lp_data/HighsGeneration.h
     lp_data/HighsInfo.h
     lp_data/HighsInfoDebug.h
     lp_data/HighsLp.h
@@ -328,6 +346,7 @@ set(highs_headers
     mip/HighsImplications.h
     mip/HighsLpAggregator.h
     mip/HighsLpRelaxation.h
+    mip/HighsMipRace.h
     mip/HighsMipSolver.h
     mip/HighsMipSolverData.h
     mip/HighsModkSeparator.h
@@ -345,6 +364,7 @@ set(highs_headers
     model/HighsHessian.h
     model/HighsHessianUtils.h
     model/HighsModel.h
+    model/HighsModelComponents.h
     parallel/HighsBinarySemaphore.h
     parallel/HighsCacheAlign.h
     parallel/HighsCombinable.h
@@ -425,6 +445,7 @@ set(highs_headers
     util/HighsMemoryAllocation.h
     util/HighsRandom.h
     util/HighsRbTree.h
+    util/HighsSimd.h
     util/HighsSort.h
     util/HighsSparseMatrix.h
     util/HighsSparseVectorSum.h
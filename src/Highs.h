@@ -17,6 +17,7 @@
 #include <sstream>
 
 #include "lp_data/HighsCallback.h"
+#include "lp_data/HighsGeneration.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsRanging.h"
 #include "lp_data/HighsSolutionDebug.h"
@@ -179,6 +180,21 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Solve the incumbent LP repeatedly, adding the columns and
+   * rows generated by the callback from each optimal solution, until
+   * none are generated or they have been added max_round times
+   */
+  HighsStatus generate(const HighsGenerationCallback& callback,
+                       const HighsInt max_round = kHighsIInf);
+
+  /**
+   * @brief Get the record of each round of the last call to generate()
+   */
+  const std::vector<HighsGenerationRound>& getGenerationRounds() const {
+    return generation_round_;
+  }
+
   /**
    * @brief Postsolve the incumbent model using a solution
    */
@@ -507,6 +523,12 @@ class Highs {
                                  const HighsInt method = 0,
                                  const double ill_conditioning_bound = 1e-4);
 
+  /**
+   * @brief Get the blocks of columns and rows of the model, including
+   * any linking rows that border a block-diagonal structure
+   */
+  HighsStatus getBlockStructure(HighsBlockStructure& block_structure);
+
   /**
    * @brief Get the current model objective value
    */
@@ -1336,6 +1358,7 @@ class Highs {
   HEkk ekk_instance_;
 
   HighsPresolveLog presolve_log_;
+  std::vector<HighsGenerationRound> generation_round_;
 
   HighsInt max_threads = 0;
   // This is strictly for debugging. It's used to check whether
@@ -1357,6 +1380,7 @@ class Highs {
   HighsStatus callSolveLp(HighsLp& lp, const string message);
   HighsStatus callSolveQp();
   HighsStatus callSolveMip();
+  HighsStatus solveComponents(bool& decomposed);
   HighsStatus callRunPostsolve(const HighsSolution& solution,
                                const HighsBasis& basis);
 
@@ -7,6 +7,7 @@
 #include <cassert>
 
 #include "Highs.h"
+#include "lp_data/HighsBatchSolver.h"
 #include "lp_data/HighsCallback.h"
 
 namespace py = pybind11;
@@ -149,6 +150,67 @@ std::tuple<HighsStatus, HighsRanging> highs_getRanging(Highs* h) {
   return std::make_tuple(status, ranging);
 }
 
+HighsStatus highs_batchRun(HighsBatchSolver* batch,
+                           const HighsBatchCallback& callback) {
+  // Release the GIL while the models are solved, reacquiring it to
+  // call any callback
+  HighsBatchCallback batch_callback = nullptr;
+  if (callback)
+    batch_callback = [&callback](const HighsBatchResult& result) {
+      py::gil_scoped_acquire acquire;
+      callback(result);
+    };
+  py::gil_scoped_release release;
+  return batch->run(batch_callback);
+}
+
+HighsStatus highs_generate(Highs* h, const py::function& callback,
+                           const HighsInt max_round) {
+  // Release the GIL while the LPs are solved, reacquiring it to call
+  // the callback with a reference to the generation
+  HighsGenerationCallback generation_callback =
+      [&callback](const HighsSolution& solution, HighsGeneration& generation) {
+        py::gil_scoped_acquire acquire;
+        callback(solution,
+                 py::cast(&generation, py::return_value_policy::reference));
+      };
+  py::gil_scoped_release release;
+  return h->generate(generation_callback, max_round);
+}
+
+void highs_generationAddCol(HighsGeneration* generation, double cost,
+                            double lower, double upper, HighsInt num_nz,
+                            py::array_t<HighsInt> indices,
+                            py::array_t<double> values) {
+  py::buffer_info indices_info = indices.request();
+  py::buffer_info values_info = values.request();
+
+  HighsInt* indices_ptr = reinterpret_cast<HighsInt*>(indices_info.ptr);
+  double* values_ptr = static_cast<double*>(values_info.ptr);
+
+  generation->addCol(cost, lower, upper, num_nz, indices_ptr, values_ptr);
+}
+
+void highs_generationAddRow(HighsGeneration* generation, double lower,
+                            double upper, HighsInt num_nz,
+                            py::array_t<HighsInt> indices,
+                            py::array_t<double> values) {
+  py::buffer_info indices_info = indices.request();
+  py::buffer_info values_info = values.request();
+
+  HighsInt* indices_ptr = reinterpret_cast<HighsInt*>(indices_info.ptr);
+  double* values_ptr = static_cast<double*>(values_info.ptr);
+
+  generation->addRow(lower, upper, num_nz, indices_ptr, values_ptr);
+}
+
+std::tuple<HighsStatus, HighsBlockStructure> highs_getBlockStructure(
+    Highs* h) {
+  HighsBlockStructure block_structure;
+  HighsStatus status = h->getBlockStructure(block_structure);
+  return std::make_tuple(status, block_structure);
+}
+
 HighsStatus highs_addRow(Highs* h, double lower, double upper,
                          HighsInt num_new_nz, py::array_t<HighsInt> indices,
                          py::array_t<double> values) {
@@ -843,6 +905,9 @@ PYBIND11_MODULE(_core, m) {
       .def("postsolve", &highs_postsolve)
       .def("postsolve", &highs_mipPostsolve)
       .def("run", &Highs::run)
+      .def("generate", &highs_generate, py::arg("callback"),
+           py::arg("max_round") = kHighsIInf)
+      .def("getGenerationRounds", &Highs::getGenerationRounds)
       .def("presolve", &Highs::presolve)
       .def("writeSolution", &highs_writeSolution)
       .def("readSolution", &Highs::readSolution)
@@ -890,6 +955,7 @@ PYBIND11_MODULE(_core, m) {
       .def("getModelStatus", &highs_getModelStatus)  //&Highs::getModelStatus)
       .def("getModelPresolveStatus", &Highs::getModelPresolveStatus)
       .def("getRanging", &highs_getRanging)
+      .def("getBlockStructure", &highs_getBlockStructure)
       .def("getObjectiveValue", &Highs::getObjectiveValue)
       .def("getNumCol", &Highs::getNumCol)
       .def("getNumRow", &Highs::getNumRow)
@@ -979,6 +1045,12 @@ PYBIND11_MODULE(_core, m) {
       .def_readwrite("debug_origin_name", &HighsBasis::debug_origin_name)
       .def_readwrite("col_status", &HighsBasis::col_status)
       .def_readwrite("row_status", &HighsBasis::row_status);
+  py::class_<HighsBlockStructure>(m, "HighsBlockStructure")
+      .def(py::init<>())
+      .def_readwrite("num_block", &HighsBlockStructure::num_block)
+      .def_readwrite("num_linking_row", &HighsBlockStructure::num_linking_row)
+      .def_readwrite("col_block", &HighsBlockStructure::col_block)
+      .def_readwrite("row_block", &HighsBlockStructure::row_block);
   py::class_<HighsRangingRecord>(m, "HighsRangingRecord")
       .def(py::init<>())
       .def_readwrite("value_", &HighsRangingRecord::value_)
@@ -994,6 +1066,86 @@ PYBIND11_MODULE(_core, m) {
       .def_readwrite("col_bound_dn", &HighsRanging::col_bound_dn)
       .def_readwrite("row_bound_up", &HighsRanging::row_bound_up)
       .def_readwrite("row_bound_dn", &HighsRanging::row_bound_dn);
+  py::class_<HighsGeneration>(m, "HighsGeneration")
+      .def(py::init<>())
+      .def_readwrite("col_cost", &HighsGeneration::col_cost)
+      .def_readwrite("col_lower", &HighsGeneration::col_lower)
+      .def_readwrite("col_upper", &HighsGeneration::col_upper)
+      .def_readwrite("col_start", &HighsGeneration::col_start)
+      .def_readwrite("col_index", &HighsGeneration::col_index)
+      .def_readwrite("col_value", &HighsGeneration::col_value)
+      .def_readwrite("row_lower", &HighsGeneration::row_lower)
+      .def_readwrite("row_upper", &HighsGeneration::row_upper)
+      .def_readwrite("row_start", &HighsGeneration::row_start)
+      .def_readwrite("row_index", &HighsGeneration::row_index)
+      .def_readwrite("row_value", &HighsGeneration::row_value)
+      .def("addCol", &highs_generationAddCol)
+      .def("addRow", &highs_generationAddRow)
+      .def("numCol", &HighsGeneration::numCol)
+      .def("numRow", &HighsGeneration::numRow)
+      .def("empty", &HighsGeneration::empty)
+      .def("clear", &HighsGeneration::clear);
+  py::class_<HighsGenerationRound>(m, "HighsGenerationRound")
+      .def(py::init<>())
+      .def_readwrite("model_status", &HighsGenerationRound::model_status)
+      .def_readwrite("objective_function_value",
+                     &HighsGenerationRound::objective_function_value)
+      .def_readwrite("simplex_iteration_count",
+                     &HighsGenerationRound::simplex_iteration_count)
+      .def_readwrite("num_new_col", &HighsGenerationRound::num_new_col)
+      .def_readwrite("num_new_row", &HighsGenerationRound::num_new_row)
+      .def_readwrite("speculative", &HighsGenerationRound::speculative)
+      .def_readwrite("solve_time", &HighsGenerationRound::solve_time)
+      .def_readwrite("generate_time", &HighsGenerationRound::generate_time)
+      .def_readwrite("add_time", &HighsGenerationRound::add_time);
+  py::class_<HighsBatchDelta>(m, "HighsBatchDelta")
+      .def(py::init<>())
+      .def_readwrite("cost_index", &HighsBatchDelta::cost_index)
+      .def_readwrite("cost_value", &HighsBatchDelta::cost_value)
+      .def_readwrite("col_index", &HighsBatchDelta::col_index)
+      .def_readwrite("col_lower", &HighsBatchDelta::col_lower)
+      .def_readwrite("col_upper", &HighsBatchDelta::col_upper)
+      .def_readwrite("row_index", &HighsBatchDelta::row_index)
+      .def_readwrite("row_lower", &HighsBatchDelta::row_lower)
+      .def_readwrite("row_upper", &HighsBatchDelta::row_upper);
+  py::class_<HighsBatchResult>(m, "HighsBatchResult")
+      .def(py::init<>())
+      .def_readwrite("id", &HighsBatchResult::id)
+      .def_readwrite("run_status", &HighsBatchResult::run_status)
+      .def_readwrite("model_status", &HighsBatchResult::model_status)
+      .def_readwrite("info", &HighsBatchResult::info)
+      .def_readwrite("solution", &HighsBatchResult::solution)
+      .def_readwrite("basis", &HighsBatchResult::basis)
+      .def_readwrite("run_time", &HighsBatchResult::run_time);
+  py::class_<HighsBatchSolver>(m, "HighsBatchSolver")
+      .def(py::init<>())
+      .def("setOptionValue",
+           static_cast<HighsStatus (HighsBatchSolver::*)(const std::string&,
+                                                         const bool)>(
+               &HighsBatchSolver::setOptionValue))
+      .def("setOptionValue",
+           static_cast<HighsStatus (HighsBatchSolver::*)(const std::string&,
+                                                         const int)>(
+               &HighsBatchSolver::setOptionValue))
+      .def("setOptionValue",
+           static_cast<HighsStatus (HighsBatchSolver::*)(const std::string&,
+                                                         const double)>(
+               &HighsBatchSolver::setOptionValue))
+      .def("setOptionValue",
+           static_cast<HighsStatus (HighsBatchSolver::*)(
+               const std::string&, const std::string&)>(
+               &HighsBatchSolver::setOptionValue))
+      .def("passOptions", &HighsBatchSolver::passOptions)
+      .def("getOptions", &HighsBatchSolver::getOptions)
+      .def("addModel", static_cast<HighsInt (HighsBatchSolver::*)(HighsModel)>(
+                           &HighsBatchSolver::addModel))
+      .def("addModel", static_cast<HighsInt (HighsBatchSolver::*)(HighsLp)>(
+                           &HighsBatchSolver::addModel))
+      .def("addModelDelta", &HighsBatchSolver::addModelDelta)
+      .def("run", &highs_batchRun, py::arg("callback") = py::none())
+      .def("getResults", &HighsBatchSolver::getResults)
+      .def("getNumQueued", &HighsBatchSolver::getNumQueued)
+      .def("clear", &HighsBatchSolver::clear);
   // constants
   m.attr("kHighsInf") = kHighsInf;
   m.attr("kHighsIInf") = kHighsIInf;
@@ -1152,6 +1304,8 @@ PYBIND11_MODULE(_core, m) {
       .value("kCallbackMipGetCutPool", HighsCallbackType::kCallbackMipGetCutPool)
       .value("kCallbackMipDefineLazyConstraints",
 	     HighsCallbackType::kCallbackMipDefineLazyConstraints)
+      .value("kCallbackPdlpInterrupt",
+             HighsCallbackType::kCallbackPdlpInterrupt)
       .value("kCallbackMax", HighsCallbackType::kCallbackMax)
       .value("kNumCallbackType", HighsCallbackType::kNumCallbackType)
       .export_values();
@@ -26,6 +26,12 @@ from ._core import \
     HighsBasis, \
     HighsRangingRecord, \
     HighsRanging, \
+    HighsBlockStructure, \
+    HighsGeneration, \
+    HighsGenerationRound, \
+    HighsBatchDelta, \
+    HighsBatchResult, \
+    HighsBatchSolver, \
     kHighsInf, \
     kHighsIInf, \
     HIGHS_VERSION_MAJOR, \
@@ -124,6 +130,12 @@ __all__ = ["__doc__",
            "HighsBasis",
            "HighsRangingRecord",
            "HighsRanging",
+           "HighsBlockStructure",
+           "HighsGeneration",
+           "HighsGenerationRound",
+           "HighsBatchDelta",
+           "HighsBatchResult",
+           "HighsBatchSolver",
            "kHighsInf",
            "kHighsIInf",
            "HIGHS_VERSION_MAJOR",
@@ -11,6 +11,7 @@
 #include "highs_c_api.h"
 
 #include "Highs.h"
+#include "lp_data/HighsBatchSolver.h"
 
 HighsInt Highs_lpCall(const HighsInt num_col, const HighsInt num_row,
                       const HighsInt num_nz, const HighsInt a_format,
@@ -513,6 +514,25 @@ HighsInt Highs_getBasis(const void* highs, HighsInt* col_status,
   return kHighsStatusOk;
 }
 
+HighsInt Highs_getBlockStructure(void* highs, HighsInt* num_block,
+                                 HighsInt* num_linking_row, HighsInt* col_block,
+                                 HighsInt* row_block) {
+  HighsBlockStructure block_structure;
+  HighsInt status =
+      (HighsInt)((Highs*)highs)->getBlockStructure(block_structure);
+  *num_block = block_structure.num_block;
+  *num_linking_row = block_structure.num_linking_row;
+  if (col_block != nullptr) {
+    for (size_t i = 0; i < block_structure.col_block.size(); i++)
+      col_block[i] = block_structure.col_block[i];
+  }
+  if (row_block != nullptr) {
+    for (size_t i = 0; i < block_structure.row_block.size(); i++)
+      row_block[i] = block_structure.row_block[i];
+  }
+  return status;
+}
+
 HighsInt Highs_getModelStatus(const void* highs) {
   return (HighsInt)((Highs*)highs)->getModelStatus();
 }
@@ -1392,6 +1412,177 @@ const void* Highs_getCallbackDataOutItem(const HighsCallbackDataOut* data_out,
   return nullptr;
 }
 
+void* Highs_batchCreate(void) { return new HighsBatchSolver(); }
+
+void Highs_batchDestroy(void* batch) { delete (HighsBatchSolver*)batch; }
+
+HighsInt Highs_batchSetBoolOptionValue(void* batch, const char* option,
+                                       const HighsInt value) {
+  return (HighsInt)((HighsBatchSolver*)batch)
+      ->setOptionValue(std::string(option), (bool)value);
+}
+
+HighsInt Highs_batchSetIntOptionValue(void* batch, const char* option,
+                                      const HighsInt value) {
+  return (HighsInt)((HighsBatchSolver*)batch)
+      ->setOptionValue(std::string(option), value);
+}
+
+HighsInt Highs_batchSetDoubleOptionValue(void* batch, const char* option,
+                                         const double value) {
+  return (HighsInt)((HighsBatchSolver*)batch)
+      ->setOptionValue(std::string(option), value);
+}
+
+HighsInt Highs_batchSetStringOptionValue(void* batch, const char* option,
+                                         const char* value) {
+  return (HighsInt)((HighsBatchSolver*)batch)
+      ->setOptionValue(std::string(option), std::string(value));
+}
+
+HighsInt Highs_batchAddMip(void* batch, const HighsInt num_col,
+                           const HighsInt num_row, const HighsInt num_nz,
+                           const HighsInt a_format, const HighsInt sense,
+                           const double offset, const double* col_cost,
+                           const double* col_lower, const double* col_upper,
+                           const double* row_lower, const double* row_upper,
+                           const HighsInt* a_start, const HighsInt* a_index,
+                           const double* a_value, const HighsInt* integrality) {
+  if (num_col < 0 || num_row < 0 || num_nz < 0) return -1;
+  const bool a_rowwise = a_format == (HighsInt)MatrixFormat::kRowwise;
+  if (num_nz > 0 && !a_rowwise && a_format != (HighsInt)MatrixFormat::kColwise)
+    return -1;
+  HighsLp lp;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.sense_ = sense == (HighsInt)ObjSense::kMaximize ? ObjSense::kMaximize
+                                                     : ObjSense::kMinimize;
+  lp.offset_ = offset;
+  lp.col_cost_.assign(col_cost, col_cost + num_col);
+  lp.col_lower_.assign(col_lower, col_lower + num_col);
+  lp.col_upper_.assign(col_upper, col_upper + num_col);
+  lp.row_lower_.assign(row_lower, row_lower + num_row);
+  lp.row_upper_.assign(row_upper, row_upper + num_row);
+  const HighsInt num_vec = a_rowwise ? num_row : num_col;
+  lp.a_matrix_.format_ =
+      a_rowwise ? MatrixFormat::kRowwise : MatrixFormat::kColwise;
+  lp.a_matrix_.num_col_ = num_col;
+  lp.a_matrix_.num_row_ = num_row;
+  if (num_nz > 0) {
+    lp.a_matrix_.start_.assign(a_start, a_start + num_vec);
+    lp.a_matrix_.index_.assign(a_index, a_index + num_nz);
+    lp.a_matrix_.value_.assign(a_value, a_value + num_nz);
+  }
+  lp.a_matrix_.start_.resize(num_vec + 1);
+  lp.a_matrix_.start_[num_vec] = num_nz;
+  if (integrality != nullptr && num_col > 0) {
+    lp.integrality_.resize(num_col);
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      lp.integrality_[iCol] = (HighsVarType)integrality[iCol];
+  }
+  return ((HighsBatchSolver*)batch)->addModel(std::move(lp));
+}
+
+HighsInt Highs_batchAddDelta(
+    void* batch, const HighsInt base_id, const HighsInt num_cost,
+    const HighsInt* cost_index, const double* cost_value,
+    const HighsInt num_col_bound, const HighsInt* col_index,
+    const double* col_lower, const double* col_upper,
+    const HighsInt num_row_bound, const HighsInt* row_index,
+    const double* row_lower, const double* row_upper) {
+  HighsBatchDelta delta;
+  if (num_cost > 0) {
+    delta.cost_index.assign(cost_index, cost_index + num_cost);
+    delta.cost_value.assign(cost_value, cost_value + num_cost);
+  }
+  if (num_col_bound > 0) {
+    delta.col_index.assign(col_index, col_index + num_col_bound);
+    delta.col_lower.assign(col_lower, col_lower + num_col_bound);
+    delta.col_upper.assign(col_upper, col_upper + num_col_bound);
+  }
+  if (num_row_bound > 0) {
+    delta.row_index.assign(row_index, row_index + num_row_bound);
+    delta.row_lower.assign(row_lower, row_lower + num_row_bound);
+    delta.row_upper.assign(row_upper, row_upper + num_row_bound);
+  }
+  return ((HighsBatchSolver*)batch)->addModelDelta(base_id, std::move(delta));
+}
+
+HighsInt Highs_batchRun(void* batch, HighsCBatchCallbackType callback,
+                        void* user_data) {
+  HighsBatchCallback batch_callback = nullptr;
+  if (callback != nullptr)
+    batch_callback = [callback, user_data](const HighsBatchResult& result) {
+      const HighsSolution& solution = result.solution;
+      const bool have_values = solution.value_valid;
+      callback(result.id, (HighsInt)result.run_status,
+               (HighsInt)result.model_status,
+               result.info.objective_function_value,
+               have_values ? (HighsInt)solution.col_value.size() : 0,
+               have_values ? solution.col_value.data() : nullptr,
+               have_values ? (HighsInt)solution.row_value.size() : 0,
+               have_values ? solution.row_value.data() : nullptr, user_data);
+    };
+  return (HighsInt)((HighsBatchSolver*)batch)->run(batch_callback);
+}
+
+HighsInt Highs_generate(void* highs, HighsCGenerationCallbackType callback,
+                        void* user_data, const HighsInt max_round) {
+  HighsGenerationCallback generation_callback = nullptr;
+  if (callback != nullptr)
+    generation_callback = [callback, user_data](
+                              const HighsSolution& solution,
+                              HighsGeneration& generation) {
+      callback((HighsInt)solution.col_value.size(), solution.col_value.data(),
+               solution.col_dual.data(), (HighsInt)solution.row_value.size(),
+               solution.row_value.data(), solution.row_dual.data(),
+               &generation, user_data);
+    };
+  return (HighsInt)((Highs*)highs)->generate(generation_callback, max_round);
+}
+
+HighsInt Highs_generationAddCol(void* generation, const double cost,
+                                const double lower, const double upper,
+                                const HighsInt num_new_nz,
+                                const HighsInt* index, const double* value) {
+  ((HighsGeneration*)generation)
+      ->addCol(cost, lower, upper, num_new_nz, index, value);
+  return kHighsStatusOk;
+}
+
+HighsInt Highs_generationAddRow(void* generation, const double lower,
+                                const double upper, const HighsInt num_new_nz,
+                                const HighsInt* index, const double* value) {
+  ((HighsGeneration*)generation)
+      ->addRow(lower, upper, num_new_nz, index, value);
+  return kHighsStatusOk;
+}
+
+HighsInt Highs_getNumGenerationRound(const void* highs) {
+  return (HighsInt)((Highs*)highs)->getGenerationRounds().size();
+}
+
+HighsInt Highs_getGenerationRound(
+    const void* highs, const HighsInt round, HighsInt* model_status,
+    double* objective_function_value, HighsInt* simplex_iteration_count,
+    HighsInt* num_new_col, HighsInt* num_new_row, double* solve_time,
+    double* generate_time, double* add_time) {
+  const std::vector<HighsGenerationRound>& generation_round =
+      ((Highs*)highs)->getGenerationRounds();
+  if (round < 0 || round >= (HighsInt)generation_round.size())
+    return kHighsStatusError;
+  const HighsGenerationRound& record = generation_round[round];
+  *model_status = (HighsInt)record.model_status;
+  *objective_function_value = record.objective_function_value;
+  *simplex_iteration_count = record.simplex_iteration_count;
+  *num_new_col = record.num_new_col;
+  *num_new_row = record.num_new_row;
+  *solve_time = record.solve_time;
+  *generate_time = record.generate_time;
+  *add_time = record.add_time;
+  return kHighsStatusOk;
+}
+
 // *********************
 // * Deprecated methods*
 // *********************
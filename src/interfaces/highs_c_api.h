@@ -108,6 +108,7 @@ const HighsInt kHighsCallbackMipLogging = 5;
 const HighsInt kHighsCallbackMipInterrupt = 6;
 const HighsInt kHighsCallbackMipGetCutPool = 7;
 const HighsInt kHighsCallbackMipDefineLazyConstraints = 8;
+const HighsInt kHighsCallbackPdlpInterrupt = 9;
 
 const char* const kHighsCallbackDataOutLogTypeName = "log_type";
 const char* const kHighsCallbackDataOutRunningTimeName = "running_time";
@@ -881,6 +882,24 @@ HighsInt Highs_getSolution(const void* highs, double* col_value,
 HighsInt Highs_getBasis(const void* highs, HighsInt* col_status,
                         HighsInt* row_status);
 
+/**
+ * Get the blocks of columns and rows of the model. Rows that link
+ * otherwise independent blocks have block -1.
+ *
+ * @param highs           A pointer to the Highs instance.
+ * @param num_block       The number of blocks.
+ * @param num_linking_row The number of linking rows.
+ * @param col_block       An array of length [num_col], to be filled with
+ *                        the block of each column. May be NULL.
+ * @param row_block       An array of length [num_row], to be filled with
+ *                        the block of each row. May be NULL.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_getBlockStructure(void* highs, HighsInt* num_block,
+                                 HighsInt* num_linking_row, HighsInt* col_block,
+                                 HighsInt* row_block);
+
 /**
  * Return the optimization status of the model in the form of a
  * `kHighsModelStatus` constant.
@@ -2188,6 +2207,221 @@ void Highs_resetGlobalScheduler(const HighsInt blocking);
 const void* Highs_getCallbackDataOutItem(const HighsCallbackDataOut* data_out,
                                          const char* item_name);
 
+/**
+ * Callback for the result of solving a model in a batch
+ *
+ * @param id                       The identifier of the model.
+ * @param run_status               The `kHighsStatus` from solving the model.
+ * @param model_status             The `kHighsModelStatus` of the model.
+ * @param objective_function_value The objective function value.
+ * @param num_col                  The number of column values.
+ * @param col_value                The column values, or NULL if there is no
+ *                                 solution.
+ * @param num_row                  The number of row values.
+ * @param row_value                The row values, or NULL if there is no
+ *                                 solution.
+ * @param user_data                The user data passed to Highs_batchRun.
+ */
+typedef void (*HighsCBatchCallbackType)(
+    HighsInt id, HighsInt run_status, HighsInt model_status,
+    double objective_function_value, HighsInt num_col, const double* col_value,
+    HighsInt num_row, const double* row_value, void* user_data);
+
+/**
+ * Create a batch solver, which solves queued models with a pool of
+ * reusable Highs instances, one for each thread.
+ *
+ * Call `Highs_batchDestroy` on the returned reference to clean up allocated
+ * memory.
+ *
+ * @returns A pointer to the batch solver.
+ */
+void* Highs_batchCreate(void);
+
+/**
+ * Destroy a batch solver.
+ *
+ * @param batch     A pointer to the batch solver.
+ */
+void Highs_batchDestroy(void* batch);
+
+/**
+ * Set option values for every model solved by a batch solver. See
+ * `Highs_setBoolOptionValue` and its counterparts.
+ *
+ * @param batch     A pointer to the batch solver.
+ * @param option    The name of the option.
+ * @param value     The new value of the option.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_batchSetBoolOptionValue(void* batch, const char* option,
+                                       const HighsInt value);
+HighsInt Highs_batchSetIntOptionValue(void* batch, const char* option,
+                                      const HighsInt value);
+HighsInt Highs_batchSetDoubleOptionValue(void* batch, const char* option,
+                                         const double value);
+HighsInt Highs_batchSetStringOptionValue(void* batch, const char* option,
+                                         const char* value);
+
+/**
+ * Queue a MIP to be solved by a batch solver. The arguments are as for
+ * `Highs_passMip`, and `integrality` may be NULL for an LP.
+ *
+ * @returns The identifier of the model, or -1 if the model is not valid.
+ */
+HighsInt Highs_batchAddMip(void* batch, const HighsInt num_col,
+                           const HighsInt num_row, const HighsInt num_nz,
+                           const HighsInt a_format, const HighsInt sense,
+                           const double offset, const double* col_cost,
+                           const double* col_lower, const double* col_upper,
+                           const double* row_lower, const double* row_upper,
+                           const HighsInt* a_start, const HighsInt* a_index,
+                           const double* a_value, const HighsInt* integrality);
+
+/**
+ * Queue a model defined by changes to the costs and bounds of a model
+ * previously queued by `Highs_batchAddMip`.
+ *
+ * @param batch         A pointer to the batch solver.
+ * @param base_id       The identifier of the model that is changed.
+ * @param num_cost      The number of costs to change.
+ * @param cost_index    An array of length [num_cost] with the column indices.
+ * @param cost_value    An array of length [num_cost] with the new costs.
+ * @param num_col_bound The number of column bounds to change.
+ * @param col_index     An array of length [num_col_bound] with the column
+ *                      indices.
+ * @param col_lower     An array of length [num_col_bound] with the new lower
+ *                      bounds.
+ * @param col_upper     An array of length [num_col_bound] with the new upper
+ *                      bounds.
+ * @param num_row_bound The number of row bounds to change.
+ * @param row_index     An array of length [num_row_bound] with the row
+ *                      indices.
+ * @param row_lower     An array of length [num_row_bound] with the new lower
+ *                      bounds.
+ * @param row_upper     An array of length [num_row_bound] with the new upper
+ *                      bounds.
+ *
+ * @returns The identifier of the model, or -1 if the changes are not valid.
+ */
+HighsInt Highs_batchAddDelta(
+    void* batch, const HighsInt base_id, const HighsInt num_cost,
+    const HighsInt* cost_index, const double* cost_value,
+    const HighsInt num_col_bound, const HighsInt* col_index,
+    const double* col_lower, const double* col_upper,
+    const HighsInt num_row_bound, const HighsInt* row_index,
+    const double* row_lower, const double* row_upper);
+
+/**
+ * Solve the models queued in a batch solver, calling `callback` with the
+ * result of each. Calls are serialized, but may be made from any thread.
+ *
+ * @param batch     A pointer to the batch solver.
+ * @param callback  The callback.
+ * @param user_data A pointer to user data passed to the callback.
+ *
+ * @returns The worst `kHighsStatus` from solving the models.
+ */
+HighsInt Highs_batchRun(void* batch, HighsCBatchCallbackType callback,
+                        void* user_data);
+
+/**
+ * Callback for generating columns and rows from a solution of an LP
+ *
+ * @param num_col    The number of columns.
+ * @param col_value  An array of length [num_col] with the column values.
+ * @param col_dual   An array of length [num_col] with the column duals.
+ * @param num_row    The number of rows.
+ * @param row_value  An array of length [num_row] with the row values.
+ * @param row_dual   An array of length [num_row] with the row duals.
+ * @param generation A pointer to the columns and rows generated, to be
+ *                   passed to `Highs_generationAddCol` and
+ *                   `Highs_generationAddRow`.
+ * @param user_data  The user data passed to Highs_generate.
+ */
+typedef void (*HighsCGenerationCallbackType)(
+    HighsInt num_col, const double* col_value, const double* col_dual,
+    HighsInt num_row, const double* row_value, const double* row_dual,
+    void* generation, void* user_data);
+
+/**
+ * Solve the incumbent LP repeatedly, adding the columns and rows
+ * generated by `callback` from each optimal solution, until none are
+ * generated or they have been added `max_round` times. The callback may
+ * be called with the primal feasible solution before simplex cleanup,
+ * concurrently with it. Calls are serialized, but may be made from any
+ * thread.
+ *
+ * @param highs     A pointer to the Highs instance.
+ * @param callback  The callback.
+ * @param user_data A pointer to user data passed to the callback.
+ * @param max_round The maximum number of times that columns and rows are
+ *                  added.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_generate(void* highs, HighsCGenerationCallbackType callback,
+                        void* user_data, const HighsInt max_round);
+
+/**
+ * Add a column to those generated in a call to the callback of
+ * `Highs_generate`. The arguments are as for `Highs_addCol`.
+ *
+ * @param generation A pointer to the columns and rows generated.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_generationAddCol(void* generation, const double cost,
+                                const double lower, const double upper,
+                                const HighsInt num_new_nz,
+                                const HighsInt* index, const double* value);
+
+/**
+ * Add a row to those generated in a call to the callback of
+ * `Highs_generate`. The arguments are as for `Highs_addRow`. Rows may
+ * have entries in columns generated in the same call.
+ *
+ * @param generation A pointer to the columns and rows generated.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_generationAddRow(void* generation, const double lower,
+                                const double upper, const HighsInt num_new_nz,
+                                const HighsInt* index, const double* value);
+
+/**
+ * Get the number of rounds in the last call to `Highs_generate`.
+ *
+ * @param highs     A pointer to the Highs instance.
+ *
+ * @returns The number of rounds.
+ */
+HighsInt Highs_getNumGenerationRound(const void* highs);
+
+/**
+ * Get the record of a round in the last call to `Highs_generate`.
+ *
+ * @param highs                    A pointer to the Highs instance.
+ * @param round                    The index of the round.
+ * @param model_status             The `kHighsModelStatus` of the LP.
+ * @param objective_function_value The objective function value.
+ * @param simplex_iteration_count  The number of simplex iterations.
+ * @param num_new_col              The number of columns added.
+ * @param num_new_row              The number of rows added.
+ * @param solve_time               The time to solve the LP.
+ * @param generate_time            The time to generate from the optimal
+ *                                 solution.
+ * @param add_time                 The time to add the columns and rows.
+ *
+ * @returns A `kHighsStatus` constant indicating whether the call succeeded.
+ */
+HighsInt Highs_getGenerationRound(
+    const void* highs, const HighsInt round, HighsInt* model_status,
+    double* objective_function_value, HighsInt* simplex_iteration_count,
+    HighsInt* num_new_col, HighsInt* num_new_row, double* solve_time,
+    double* generate_time, double* add_time);
+
 // *********************
 // * Deprecated methods*
 // *********************
@@ -13,6 +13,7 @@
 
 #include <cctype>
 
+#include "io/FilereaderBinary.h"
 #include "io/FilereaderEms.h"
 #include "io/FilereaderLp.h"
 #include "io/FilereaderMps.h"
@@ -67,6 +68,8 @@ Filereader* Filereader::getFilereader(const HighsLogOptions& log_options,
     reader = new FilereaderLp();
   } else if (lower_case_extension.compare("ems") == 0) {
     reader = new FilereaderEms();
+  } else if (lower_case_extension.compare("hbin") == 0) {
+    reader = new FilereaderBinary();
   } else {
     reader = NULL;
   }
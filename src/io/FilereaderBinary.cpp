@@ -0,0 +1,717 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderBinary.cpp
+ * @brief Reader and writer for the native binary (.hbin) model format
+ *
+ * A file consists of a 16-byte header - the string "HiGHSbin"
+ * followed by the format version and (reserved) flags as 32-bit
+ * integers - and then a sequence of sections terminated by an end
+ * section. Each section has a 24-byte header giving its tag, the
+ * type of its entries, the number of entries and a checksum of its
+ * data, which follows, padded to a multiple of 8 bytes. All values
+ * are little-endian, and the checksum is computed from the bytes of
+ * the file.
+ *
+ * Sections with unknown tags are skipped, so that sections added in
+ * later versions of the format can be ignored. Files are read by
+ * mapping them into memory, and each array is copied directly into
+ * the corresponding vector of the model.
+ */
+#include "io/FilereaderBinary.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include "io/HighsMappedFile.h"
+
+namespace {
+
+const char kHbinMagic[8] = {'H', 'i', 'G', 'H', 'S', 'b', 'i', 'n'};
+const uint32_t kHbinVersion = 1;
+const size_t kHbinFileHeaderSize = 16;
+const size_t kHbinSectionHeaderSize = 24;
+
+// Section tags: values must not change, and new tags are appended
+enum HbinTag : uint32_t {
+  kHbinTagEnd = 0,
+  kHbinTagDimensions = 1,
+  kHbinTagOffset = 2,
+  kHbinTagModelName = 3,
+  kHbinTagObjectiveName = 4,
+  kHbinTagColCost = 5,
+  kHbinTagColLower = 6,
+  kHbinTagColUpper = 7,
+  kHbinTagRowLower = 8,
+  kHbinTagRowUpper = 9,
+  kHbinTagAStart = 10,
+  kHbinTagAIndex = 11,
+  kHbinTagAValue = 12,
+  kHbinTagIntegrality = 13,
+  kHbinTagHessianStart = 14,
+  kHbinTagHessianIndex = 15,
+  kHbinTagHessianValue = 16,
+  kHbinTagColNames = 17,
+  kHbinTagRowNames = 18,
+  kHbinTagScale = 19,
+  kHbinTagScaleCol = 20,
+  kHbinTagScaleRow = 21,
+  kHbinTagColValue = 22,
+  kHbinTagRowValue = 23,
+  kHbinTagColDual = 24,
+  kHbinTagRowDual = 25,
+  kHbinTagColStatus = 26,
+  kHbinTagRowStatus = 27,
+  kHbinTagCount
+};
+
+enum HbinType : uint32_t {
+  kHbinTypeByte = 1,
+  kHbinTypeInt32 = 2,
+  kHbinTypeInt64 = 3,
+  kHbinTypeDouble = 4
+};
+
+// Entries of the dimensions section
+enum HbinDimension {
+  kHbinNumCol = 0,
+  kHbinNumRow,
+  kHbinNumNz,
+  kHbinSense,
+  kHbinHessianDim,
+  kHbinHessianFormat,
+  kHbinUserBoundScale,
+  kHbinUserCostScale,
+  kHbinDimensionCount
+};
+
+// Entries of the scale section
+enum HbinScale { kHbinScaleStrategy = 0, kHbinScaleCost, kHbinScaleCount };
+
+const uint32_t kHbinTypeHighsInt =
+    sizeof(HighsInt) == 4 ? kHbinTypeInt32 : kHbinTypeInt64;
+
+size_t hbinTypeWidth(const uint32_t type) {
+  switch (type) {
+    case kHbinTypeByte:
+      return 1;
+    case kHbinTypeInt32:
+      return 4;
+    case kHbinTypeInt64:
+    case kHbinTypeDouble:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+size_t hbinPadding(const size_t size) { return (8 - size % 8) % 8; }
+
+bool hostIsLittleEndian() {
+  const uint16_t one = 1;
+  unsigned char byte;
+  std::memcpy(&byte, &one, 1);
+  return byte == 1;
+}
+
+// Reverses the byte order of each of count entries of the given width
+void swapBytes(char* data, const size_t count, const size_t width) {
+  if (width <= 1) return;
+  for (size_t i = 0; i < count; i++)
+    std::reverse(data + i * width, data + (i + 1) * width);
+}
+
+uint64_t loadLe(const char* data, const size_t width) {
+  uint64_t value = 0;
+  for (size_t k = width; k > 0; k--)
+    value = (value << 8) | static_cast<unsigned char>(data[k - 1]);
+  return value;
+}
+
+inline uint64_t loadWord(const char* data, const bool little_endian) {
+  if (!little_endian) return loadLe(data, 8);
+  uint64_t word;
+  std::memcpy(&word, data, 8);
+  return word;
+}
+
+const uint64_t kChecksumPrime1 = 0x9e3779b185ebca87ull;
+const uint64_t kChecksumPrime2 = 0xc2b2ae3d27d4eb4full;
+
+inline uint64_t checksumRound(uint64_t acc, const uint64_t word) {
+  acc += word * kChecksumPrime2;
+  acc = (acc << 31) | (acc >> 33);
+  return acc * kChecksumPrime1;
+}
+
+// Checksum of the little-endian 64-bit words of the data, accumulated
+// in four independent lanes so that it runs at close to memory speed
+uint64_t hbinChecksum(const char* data, const size_t size) {
+  const bool little_endian = hostIsLittleEndian();
+  uint64_t lane[4] = {kChecksumPrime1, kChecksumPrime2, ~kChecksumPrime1,
+                      ~kChecksumPrime2};
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32)
+    for (int k = 0; k < 4; k++)
+      lane[k] =
+          checksumRound(lane[k], loadWord(data + i + 8 * k, little_endian));
+  uint64_t checksum = size;
+  for (int k = 0; k < 4; k++) checksum = checksumRound(checksum, lane[k]);
+  for (; i + 8 <= size; i += 8)
+    checksum = checksumRound(checksum, loadWord(data + i, little_endian));
+  if (i < size) {
+    char tail[8] = {0};
+    std::memcpy(tail, data + i, size - i);
+    checksum = checksumRound(checksum, loadWord(tail, little_endian));
+  }
+  return checksum;
+}
+
+bool isCompressed(const std::string& filename) {
+  return filename.size() >= 3 &&
+         filename.compare(filename.size() - 3, 3, ".gz") == 0;
+}
+
+class HbinWriter {
+ public:
+  explicit HbinWriter(FILE* file)
+      : file_(file), little_endian_(hostIsLittleEndian()) {}
+
+  bool ok() const { return ok_; }
+
+  void writeHeader() {
+    put(kHbinMagic, sizeof(kHbinMagic));
+    putLe(kHbinVersion, 4);
+    putLe(0, 4);
+  }
+
+  void writeSection(const uint32_t tag, const uint32_t type, const void* data,
+                    const size_t count) {
+    const size_t width = hbinTypeWidth(type);
+    const size_t size = count * width;
+    const char* bytes = static_cast<const char*>(data);
+    std::vector<char> swapped;
+    if (!little_endian_ && width > 1) {
+      swapped.assign(bytes, bytes + size);
+      swapBytes(swapped.data(), count, width);
+      bytes = swapped.data();
+    }
+    putLe(tag, 4);
+    putLe(type, 4);
+    putLe(count, 8);
+    putLe(hbinChecksum(bytes, size), 8);
+    put(bytes, size);
+    const char zeros[8] = {0};
+    put(zeros, hbinPadding(size));
+  }
+
+  void writeInts(const uint32_t tag, const HighsInt* data, const size_t count) {
+    writeSection(tag, kHbinTypeHighsInt, data, count);
+  }
+
+  void writeDoubles(const uint32_t tag, const std::vector<double>& data) {
+    writeSection(tag, kHbinTypeDouble, data.data(), data.size());
+  }
+
+  void writeString(const uint32_t tag, const std::string& data) {
+    writeSection(tag, kHbinTypeByte, data.data(), data.size());
+  }
+
+  // Names are written consecutively, each terminated by a null
+  void writeNames(const uint32_t tag, const std::vector<std::string>& names) {
+    size_t size = 0;
+    for (const std::string& name : names) size += name.size() + 1;
+    std::string data;
+    data.reserve(size);
+    for (const std::string& name : names) {
+      data += name;
+      data += '\0';
+    }
+    writeString(tag, data);
+  }
+
+ private:
+  void put(const void* data, const size_t size) {
+    if (ok_ && size > 0 && fwrite(data, 1, size, file_) != size) ok_ = false;
+  }
+
+  void putLe(uint64_t value, const size_t width) {
+    char bytes[8];
+    for (size_t k = 0; k < width; k++) {
+      bytes[k] = static_cast<char>(value & 0xff);
+      value >>= 8;
+    }
+    put(bytes, width);
+  }
+
+  FILE* file_;
+  bool little_endian_;
+  bool ok_ = true;
+};
+
+struct HbinSection {
+  bool found = false;
+  uint32_t type = 0;
+  size_t count = 0;
+  const char* data = nullptr;
+};
+
+class HbinReader {
+ public:
+  HbinReader(const HighsLogOptions& log_options, const std::string& filename)
+      : log_options_(log_options),
+        filename_(filename),
+        little_endian_(hostIsLittleEndian()),
+        section_(kHbinTagCount) {}
+
+  // Locates the known sections of the file, checking its header and
+  // the checksum of every section
+  bool parse(const char* data, const size_t size) {
+    if (size < kHbinFileHeaderSize ||
+        std::memcmp(data, kHbinMagic, sizeof(kHbinMagic)) != 0)
+      return fail("not a HiGHS binary model file");
+    const uint32_t version = uint32_t(loadLe(data + 8, 4));
+    if (version > kHbinVersion)
+      return fail("format version " + std::to_string(version) +
+                  " is not supported");
+    const char* end = data + size;
+    const char* p = data + kHbinFileHeaderSize;
+    while (size_t(end - p) >= kHbinSectionHeaderSize) {
+      const uint32_t tag = uint32_t(loadLe(p, 4));
+      const uint32_t type = uint32_t(loadLe(p + 4, 4));
+      const uint64_t count = loadLe(p + 8, 8);
+      const uint64_t checksum = loadLe(p + 16, 8);
+      p += kHbinSectionHeaderSize;
+      if (tag == kHbinTagEnd) return true;
+      const size_t width = hbinTypeWidth(type);
+      if (width == 0) return fail("section has unknown type");
+      const size_t available = end - p;
+      if (count > available / width) return fail("file is truncated");
+      const size_t bytes = count * width;
+      if (hbinPadding(bytes) > available - bytes)
+        return fail("file is truncated");
+      if (hbinChecksum(p, bytes) != checksum)
+        return fail("checksum error in section " + std::to_string(tag));
+      if (tag < kHbinTagCount) {
+        HbinSection& section = section_[tag];
+        if (section.found)
+          return fail("repeated section " + std::to_string(tag));
+        section.found = true;
+        section.type = type;
+        section.count = count;
+        section.data = p;
+      }
+      p += bytes + hbinPadding(bytes);
+    }
+    return fail("file is truncated");
+  }
+
+  bool has(const uint32_t tag) const { return section_[tag].found; }
+
+  bool getInt64s(const uint32_t tag, std::vector<int64_t>& values) {
+    const HbinSection* section = find(tag, kHbinTypeInt64);
+    if (section == nullptr) return false;
+    values.resize(section->count);
+    for (size_t i = 0; i < section->count; i++)
+      values[i] = static_cast<int64_t>(loadLe(section->data + 8 * i, 8));
+    return true;
+  }
+
+  bool getDoubles(const uint32_t tag, const size_t count,
+                  std::vector<double>& values) {
+    const HbinSection* section = find(tag, kHbinTypeDouble, count);
+    if (section == nullptr) return false;
+    if (little_endian_) {
+      // Sections are 8-byte aligned, so the data can be copied
+      // directly from the mapped file
+      const double* data = reinterpret_cast<const double*>(section->data);
+      values.assign(data, data + count);
+    } else {
+      values.resize(count);
+      if (count == 0) return true;
+      std::memcpy(values.data(), section->data, 8 * count);
+      swapBytes(reinterpret_cast<char*>(values.data()), count, 8);
+    }
+    return true;
+  }
+
+  // Integers may have been written with a different width from that
+  // of HighsInt
+  bool getInts(const uint32_t tag, const size_t count,
+               std::vector<HighsInt>& values) {
+    const HbinSection* section = find(tag, 0, count);
+    if (section == nullptr) return false;
+    const size_t width = hbinTypeWidth(section->type);
+    if (section->type != kHbinTypeInt32 && section->type != kHbinTypeInt64)
+      return fail("section " + std::to_string(tag) + " has the wrong type");
+    if (little_endian_ && width == sizeof(HighsInt)) {
+      const HighsInt* data = reinterpret_cast<const HighsInt*>(section->data);
+      values.assign(data, data + count);
+      return true;
+    }
+    values.resize(count);
+    const int64_t max_value = std::numeric_limits<HighsInt>::max();
+    const int64_t min_value = std::numeric_limits<HighsInt>::min();
+    for (size_t i = 0; i < count; i++) {
+      const uint64_t bits = loadLe(section->data + width * i, width);
+      const int64_t value = width == 4
+                                ? int64_t(int32_t(uint32_t(bits)))
+                                : static_cast<int64_t>(bits);
+      if (value < min_value || value > max_value)
+        return fail("integer out of range in section " + std::to_string(tag));
+      values[i] = HighsInt(value);
+    }
+    return true;
+  }
+
+  // Reads count bytes, each of which must be no more than max_value,
+  // into an array of an enum class with underlying type uint8_t
+  template <typename T>
+  bool getBytes(const uint32_t tag, const size_t count, const uint8_t max_value,
+                std::vector<T>& values) {
+    static_assert(sizeof(T) == 1, "getBytes reads single-byte entries");
+    const HbinSection* section = find(tag, kHbinTypeByte, count);
+    if (section == nullptr) return false;
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(section->data);
+    for (size_t i = 0; i < count; i++)
+      if (data[i] > max_value)
+        return fail("illegal value in section " + std::to_string(tag));
+    values.resize(count);
+    if (count > 0) std::memcpy(values.data(), data, count);
+    return true;
+  }
+
+  bool getString(const uint32_t tag, std::string& value) {
+    const HbinSection* section = find(tag, kHbinTypeByte);
+    if (section == nullptr) return false;
+    value.assign(section->data, section->count);
+    return true;
+  }
+
+  bool getNames(const uint32_t tag, const size_t count,
+                std::vector<std::string>& names) {
+    const HbinSection* section = find(tag, kHbinTypeByte);
+    if (section == nullptr) return false;
+    names.resize(count);
+    const char* p = section->data;
+    const char* end = p + section->count;
+    size_t num_name = 0;
+    for (; num_name < count; num_name++) {
+      const char* name_end =
+          static_cast<const char*>(std::memchr(p, '\0', end - p));
+      if (name_end == nullptr) break;
+      names[num_name].assign(p, name_end);
+      p = name_end + 1;
+    }
+    if (num_name < count || p != end)
+      return fail("section " + std::to_string(tag) +
+                  " has the wrong number of names");
+    return true;
+  }
+
+  bool fail(const std::string& message) {
+    highsLogUser(log_options_, HighsLogType::kError,
+                 "Binary model file %s: %s\n", filename_.c_str(),
+                 message.c_str());
+    return false;
+  }
+
+ private:
+  // Returns the section with the given tag, checking its type (unless
+  // zero) and its number of entries (unless unspecified)
+  const HbinSection* find(const uint32_t tag, const uint32_t type,
+                          const size_t count = kAnyCount) {
+    const HbinSection& section = section_[tag];
+    if (!section.found) {
+      fail("section " + std::to_string(tag) + " is missing");
+      return nullptr;
+    }
+    if (type && section.type != type) {
+      fail("section " + std::to_string(tag) + " has the wrong type");
+      return nullptr;
+    }
+    if (count != kAnyCount && section.count != count) {
+      fail("section " + std::to_string(tag) + " has the wrong size");
+      return nullptr;
+    }
+    return &section;
+  }
+
+  static const size_t kAnyCount = std::numeric_limits<size_t>::max();
+
+  const HighsLogOptions& log_options_;
+  std::string filename_;
+  bool little_endian_;
+  std::vector<HbinSection> section_;
+};
+
+bool readHbinModel(HbinReader& reader, HighsModel& model) {
+  std::vector<int64_t> dimension;
+  if (!reader.getInt64s(kHbinTagDimensions, dimension)) return false;
+  if (dimension.size() < kHbinDimensionCount)
+    return reader.fail("dimensions section is too short");
+  const int64_t max_dimension = std::numeric_limits<HighsInt>::max();
+  const int64_t num_col = dimension[kHbinNumCol];
+  const int64_t num_row = dimension[kHbinNumRow];
+  const int64_t num_nz = dimension[kHbinNumNz];
+  const int64_t hessian_dim = dimension[kHbinHessianDim];
+  if (num_col < 0 || num_col > max_dimension || num_row < 0 ||
+      num_row > max_dimension || num_nz < 0 || num_nz > max_dimension ||
+      hessian_dim < 0 || hessian_dim > num_col)
+    return reader.fail("illegal dimensions");
+  const int64_t sense = dimension[kHbinSense];
+  const int64_t hessian_format = dimension[kHbinHessianFormat];
+  if ((sense != (int64_t)ObjSense::kMinimize &&
+       sense != (int64_t)ObjSense::kMaximize) ||
+      (hessian_format != (int64_t)HessianFormat::kTriangular &&
+       hessian_format != (int64_t)HessianFormat::kSquare))
+    return reader.fail("illegal objective sense or Hessian format");
+
+  HighsLp& lp = model.lp_;
+  lp.num_col_ = HighsInt(num_col);
+  lp.num_row_ = HighsInt(num_row);
+  lp.sense_ = ObjSense(sense);
+  lp.user_bound_scale_ = HighsInt(dimension[kHbinUserBoundScale]);
+  lp.user_cost_scale_ = HighsInt(dimension[kHbinUserCostScale]);
+  std::vector<double> offset;
+  if (!reader.getDoubles(kHbinTagOffset, 1, offset)) return false;
+  lp.offset_ = offset[0];
+  if (reader.has(kHbinTagModelName) &&
+      !reader.getString(kHbinTagModelName, lp.model_name_))
+    return false;
+  if (reader.has(kHbinTagObjectiveName) &&
+      !reader.getString(kHbinTagObjectiveName, lp.objective_name_))
+    return false;
+  if (!reader.getDoubles(kHbinTagColCost, num_col, lp.col_cost_) ||
+      !reader.getDoubles(kHbinTagColLower, num_col, lp.col_lower_) ||
+      !reader.getDoubles(kHbinTagColUpper, num_col, lp.col_upper_) ||
+      !reader.getDoubles(kHbinTagRowLower, num_row, lp.row_lower_) ||
+      !reader.getDoubles(kHbinTagRowUpper, num_row, lp.row_upper_))
+    return false;
+
+  HighsSparseMatrix& a_matrix = lp.a_matrix_;
+  a_matrix.format_ = MatrixFormat::kColwise;
+  a_matrix.num_col_ = lp.num_col_;
+  a_matrix.num_row_ = lp.num_row_;
+  if (!reader.getInts(kHbinTagAStart, num_col + 1, a_matrix.start_) ||
+      !reader.getInts(kHbinTagAIndex, num_nz, a_matrix.index_) ||
+      !reader.getDoubles(kHbinTagAValue, num_nz, a_matrix.value_))
+    return false;
+  if (a_matrix.start_[0] != 0 || a_matrix.start_[num_col] != num_nz)
+    return reader.fail("inconsistent constraint matrix starts");
+
+  if (reader.has(kHbinTagIntegrality) &&
+      !reader.getBytes(kHbinTagIntegrality, num_col,
+                       (uint8_t)HighsVarType::kImplicitInteger,
+                       lp.integrality_))
+    return false;
+  if (reader.has(kHbinTagColNames) &&
+      !reader.getNames(kHbinTagColNames, num_col, lp.col_names_))
+    return false;
+  if (reader.has(kHbinTagRowNames) &&
+      !reader.getNames(kHbinTagRowNames, num_row, lp.row_names_))
+    return false;
+
+  if (reader.has(kHbinTagScale)) {
+    std::vector<double> scale;
+    if (!reader.getDoubles(kHbinTagScale, kHbinScaleCount, scale) ||
+        !reader.getDoubles(kHbinTagScaleCol, num_col, lp.scale_.col) ||
+        !reader.getDoubles(kHbinTagScaleRow, num_row, lp.scale_.row))
+      return false;
+    lp.scale_.strategy = HighsInt(scale[kHbinScaleStrategy]);
+    lp.scale_.has_scaling = true;
+    lp.scale_.num_col = lp.num_col_;
+    lp.scale_.num_row = lp.num_row_;
+    lp.scale_.cost = scale[kHbinScaleCost];
+  }
+
+  if (hessian_dim > 0) {
+    HighsHessian& hessian = model.hessian_;
+    hessian.dim_ = HighsInt(hessian_dim);
+    hessian.format_ = HessianFormat(hessian_format);
+    if (!reader.getInts(kHbinTagHessianStart, hessian_dim + 1, hessian.start_))
+      return false;
+    const HighsInt hessian_num_nz = hessian.start_[hessian_dim];
+    if (hessian.start_[0] != 0 || hessian_num_nz < 0)
+      return reader.fail("inconsistent Hessian starts");
+    if (!reader.getInts(kHbinTagHessianIndex, hessian_num_nz, hessian.index_) ||
+        !reader.getDoubles(kHbinTagHessianValue, hessian_num_nz,
+                           hessian.value_))
+      return false;
+  }
+  return true;
+}
+
+// The solution and basis sections are optional, and their presence
+// determines whether the solution and basis are valid
+bool readHbinSolution(HbinReader& reader, const HighsLp& lp,
+                      HighsSolution& solution, HighsBasis& basis) {
+  solution.clear();
+  basis.clear();
+  if (reader.has(kHbinTagColValue)) {
+    if (!reader.getDoubles(kHbinTagColValue, lp.num_col_, solution.col_value) ||
+        !reader.getDoubles(kHbinTagRowValue, lp.num_row_, solution.row_value))
+      return false;
+    solution.value_valid = true;
+  }
+  if (reader.has(kHbinTagColDual)) {
+    if (!reader.getDoubles(kHbinTagColDual, lp.num_col_, solution.col_dual) ||
+        !reader.getDoubles(kHbinTagRowDual, lp.num_row_, solution.row_dual))
+      return false;
+    solution.dual_valid = true;
+  }
+  if (reader.has(kHbinTagColStatus)) {
+    const uint8_t max_status = (uint8_t)HighsBasisStatus::kNonbasic;
+    if (!reader.getBytes(kHbinTagColStatus, lp.num_col_, max_status,
+                         basis.col_status) ||
+        !reader.getBytes(kHbinTagRowStatus, lp.num_row_, max_status,
+                         basis.row_status))
+      return false;
+    basis.valid = true;
+    basis.alien = false;
+    basis.was_alien = false;
+  }
+  return true;
+}
+
+}  // namespace
+
+FilereaderRetcode FilereaderBinary::readModelFromFile(
+    const HighsOptions& options, const std::string filename,
+    HighsModel& model) {
+  if (isCompressed(filename)) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Compressed binary model files are not supported\n");
+    return FilereaderRetcode::kNotImplemented;
+  }
+  HighsMappedFile file;
+  if (!file.open(filename, true)) return FilereaderRetcode::kFileNotFound;
+  HbinReader reader(options.log_options, filename);
+  if (!reader.parse(file.data(), file.size()) ||
+      !readHbinModel(reader, model) ||
+      !readHbinSolution(reader, model.lp_, solution, basis))
+    return FilereaderRetcode::kParserError;
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderBinary::writeModelToFile(const HighsOptions& options,
+                                               const std::string filename,
+                                               const HighsModel& model) {
+  if (isCompressed(filename)) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Compressed binary model files are not supported\n");
+    return HighsStatus::kError;
+  }
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  // The constraint matrix is written column-wise
+  HighsSparseMatrix colwise_matrix;
+  const HighsSparseMatrix* a_matrix = &lp.a_matrix_;
+  if (!lp.a_matrix_.isColwise()) {
+    colwise_matrix = lp.a_matrix_;
+    colwise_matrix.ensureColwise();
+    a_matrix = &colwise_matrix;
+  }
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsInt num_nz = num_col > 0 ? a_matrix->start_[num_col] : 0;
+  const HighsInt hessian_dim = hessian.dim_;
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open binary model file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  HbinWriter writer(file);
+  writer.writeHeader();
+  std::vector<int64_t> dimension(kHbinDimensionCount);
+  dimension[kHbinNumCol] = num_col;
+  dimension[kHbinNumRow] = num_row;
+  dimension[kHbinNumNz] = num_nz;
+  dimension[kHbinSense] = (int64_t)lp.sense_;
+  dimension[kHbinHessianDim] = hessian_dim;
+  dimension[kHbinHessianFormat] = (int64_t)hessian.format_;
+  dimension[kHbinUserBoundScale] = lp.user_bound_scale_;
+  dimension[kHbinUserCostScale] = lp.user_cost_scale_;
+  writer.writeSection(kHbinTagDimensions, kHbinTypeInt64, dimension.data(),
+                      dimension.size());
+  writer.writeDoubles(kHbinTagOffset, std::vector<double>{lp.offset_});
+  writer.writeString(kHbinTagModelName, lp.model_name_);
+  writer.writeString(kHbinTagObjectiveName, lp.objective_name_);
+  writer.writeDoubles(kHbinTagColCost, lp.col_cost_);
+  writer.writeDoubles(kHbinTagColLower, lp.col_lower_);
+  writer.writeDoubles(kHbinTagColUpper, lp.col_upper_);
+  writer.writeDoubles(kHbinTagRowLower, lp.row_lower_);
+  writer.writeDoubles(kHbinTagRowUpper, lp.row_upper_);
+  if (num_col > 0) {
+    writer.writeInts(kHbinTagAStart, a_matrix->start_.data(), num_col + 1);
+  } else {
+    const HighsInt zero = 0;
+    writer.writeInts(kHbinTagAStart, &zero, 1);
+  }
+  writer.writeInts(kHbinTagAIndex, a_matrix->index_.data(), num_nz);
+  writer.writeSection(kHbinTagAValue, kHbinTypeDouble, a_matrix->value_.data(),
+                      num_nz);
+  if (lp.integrality_.size() == size_t(num_col))
+    writer.writeSection(kHbinTagIntegrality, kHbinTypeByte,
+                        lp.integrality_.data(), num_col);
+  if (hessian_dim > 0) {
+    const HighsInt hessian_num_nz = hessian.start_[hessian_dim];
+    writer.writeInts(kHbinTagHessianStart, hessian.start_.data(),
+                     hessian_dim + 1);
+    writer.writeInts(kHbinTagHessianIndex, hessian.index_.data(),
+                     hessian_num_nz);
+    writer.writeSection(kHbinTagHessianValue, kHbinTypeDouble,
+                        hessian.value_.data(), hessian_num_nz);
+  }
+  if (lp.col_names_.size() == size_t(num_col))
+    writer.writeNames(kHbinTagColNames, lp.col_names_);
+  if (lp.row_names_.size() == size_t(num_row))
+    writer.writeNames(kHbinTagRowNames, lp.row_names_);
+  const HighsScale& scale = lp.scale_;
+  if (scale.has_scaling && scale.col.size() == size_t(num_col) &&
+      scale.row.size() == size_t(num_row)) {
+    std::vector<double> scale_data(kHbinScaleCount);
+    scale_data[kHbinScaleStrategy] = scale.strategy;
+    scale_data[kHbinScaleCost] = scale.cost;
+    writer.writeDoubles(kHbinTagScale, scale_data);
+    writer.writeDoubles(kHbinTagScaleCol, scale.col);
+    writer.writeDoubles(kHbinTagScaleRow, scale.row);
+  }
+  const HighsSolution* solution = write_solution;
+  if (solution != nullptr && solution->value_valid) {
+    writer.writeDoubles(kHbinTagColValue, solution->col_value);
+    writer.writeDoubles(kHbinTagRowValue, solution->row_value);
+  }
+  if (solution != nullptr && solution->dual_valid) {
+    writer.writeDoubles(kHbinTagColDual, solution->col_dual);
+    writer.writeDoubles(kHbinTagRowDual, solution->row_dual);
+  }
+  if (write_basis != nullptr && write_basis->valid) {
+    writer.writeSection(kHbinTagColStatus, kHbinTypeByte,
+                        write_basis->col_status.data(),
+                        write_basis->col_status.size());
+    writer.writeSection(kHbinTagRowStatus, kHbinTypeByte,
+                        write_basis->row_status.data(),
+                        write_basis->row_status.size());
+  }
+  writer.writeSection(kHbinTagEnd, kHbinTypeByte, nullptr, 0);
+  const bool write_ok = writer.ok();
+  if (fclose(file) != 0 || !write_ok) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing binary model file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,40 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderBinary.h
+ * @brief Reader and writer for the native binary (.hbin) model format
+ */
+
+#ifndef IO_FILEREADER_BINARY_H_
+#define IO_FILEREADER_BINARY_H_
+
+#include "io/Filereader.h"
+#include "lp_data/HStruct.h"
+
+class FilereaderBinary : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+
+  // Optional sections of the file. When writing, any solution and
+  // basis pointed to are written with the model. When reading, the
+  // solution and basis are set from the file, and are otherwise
+  // invalid
+  const HighsSolution* write_solution = nullptr;
+  const HighsBasis* write_basis = nullptr;
+  HighsSolution solution;
+  HighsBasis basis;
+};
+
+#endif
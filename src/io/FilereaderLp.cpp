@@ -28,6 +28,11 @@ const bool allow_model_names = true;
 FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
                                                   const std::string filename,
                                                   HighsModel& model) {
+  if (options.lp_parser_streaming &&
+      readModelStreaming(options, filename, model)) {
+    model.lp_.ensureColwise();
+    return FilereaderRetcode::kOk;
+  }
   HighsLp& lp = model.lp_;
   HighsHessian& hessian = model.hessian_;
   try {
@@ -150,30 +155,7 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
       }
     }
 
-    // Check for empty row names, giving them a special name if possible
-    bool highs_prefix_ok = true;
-    bool used_highs_prefix = false;
-    std::string highs_prefix = "HiGHS_R";
-    for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
-      // Look to see whether the name begins HiGHS_R
-      if (strncmp(lp.row_names_[iRow].c_str(), highs_prefix.c_str(), 7) == 0) {
-        printf("Name %s begins with \"HiGHS_R\"\n",
-               lp.row_names_[iRow].c_str());
-        highs_prefix_ok = false;
-      } else if (lp.row_names_[iRow] == "") {
-        // Make up a name beginning HiGHS_R
-        lp.row_names_[iRow] = highs_prefix + std::to_string(iRow);
-        used_highs_prefix = true;
-      }
-    }
-    if (used_highs_prefix && !highs_prefix_ok) {
-      // Have made up a name beginning HiGHS_R, but this occurs with
-      // other "natural" rows, so abandon the row names
-      lp.row_names_.clear();
-      highsLogUser(options.log_options, HighsLogType::kWarning,
-                   "Cannot create row name beginning \"HiGHS_R\" due to others "
-                   "with same prefix: row names cleared\n");
-    }
+    nameUnnamedRows(options.log_options, lp);
 
     HighsInt nz = 0;
     // lp.a_matrix_ is initialised with start_[0] for fictitious
@@ -213,6 +195,33 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
   return FilereaderRetcode::kOk;
 }
 
+void FilereaderLp::nameUnnamedRows(const HighsLogOptions& log_options,
+                                   HighsLp& lp) {
+  // Check for empty row names, giving them a special name if possible
+  bool highs_prefix_ok = true;
+  bool used_highs_prefix = false;
+  std::string highs_prefix = "HiGHS_R";
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+    // Look to see whether the name begins HiGHS_R
+    if (strncmp(lp.row_names_[iRow].c_str(), highs_prefix.c_str(), 7) == 0) {
+      printf("Name %s begins with \"HiGHS_R\"\n", lp.row_names_[iRow].c_str());
+      highs_prefix_ok = false;
+    } else if (lp.row_names_[iRow] == "") {
+      // Make up a name beginning HiGHS_R
+      lp.row_names_[iRow] = highs_prefix + std::to_string(iRow);
+      used_highs_prefix = true;
+    }
+  }
+  if (used_highs_prefix && !highs_prefix_ok) {
+    // Have made up a name beginning HiGHS_R, but this occurs with
+    // other "natural" rows, so abandon the row names
+    lp.row_names_.clear();
+    highsLogUser(log_options, HighsLogType::kWarning,
+                 "Cannot create row name beginning \"HiGHS_R\" due to others "
+                 "with same prefix: row names cleared\n");
+  }
+}
+
 void FilereaderLp::writeToFile(FILE* file, const char* format, ...) {
   va_list argptr;
   va_start(argptr, format);
@@ -37,6 +37,14 @@ class FilereaderLp : public Filereader {
                                const HighsModel& model);
 
  private:
+  // Reads the file in a single pass, returning false if the original
+  // reader must be used
+  bool readModelStreaming(const HighsOptions& options,
+                          const std::string& filename, HighsModel& model);
+  // Names any unnamed rows, as HiGHS_R<index>
+  static void nameUnnamedRows(const HighsLogOptions& log_options,
+                              HighsLp& lp);
+
   // functions to write files
   HighsInt linelength;
   void writeToFile(FILE* file, const char* format, ...);
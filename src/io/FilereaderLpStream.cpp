@@ -0,0 +1,1151 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderLpStream.cpp
+ * @brief Single pass reader of LP files
+ *
+ * The file is read line by line and its tokens are classified as by
+ * the reader in extern/filereaderlp, but only the few tokens needed
+ * for look-ahead are held at any time. Each section is parsed as its
+ * tokens are produced, with columns, rows, matrix entries and
+ * Hessian terms written straight into arrays for the HighsModel, and
+ * column names interned in a single character arena. Hence peak
+ * memory is about the size of the model, rather than a multiple of
+ * the size of the file.
+ *
+ * Only files with sections in the order objective, constraints,
+ * bounds, and then any of general, binary and semi-continuous, are
+ * handled, and the model is identical to that obtained by the
+ * original reader. Anything else - SOS, quadratic constraints,
+ * repeated or out-of-order sections, and all syntax errors - leads to
+ * FilereaderLp::readModelStreaming() returning false, so that the
+ * original reader reads the file and reports any error.
+ */
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "HConfig.h"  // for ZLIB_FOUND
+#include "io/FilereaderLp.h"
+#include "util/HighsHash.h"
+#ifdef ZLIB_FOUND
+#include "../extern/zstr/zstr.hpp"
+#endif
+
+namespace {
+
+// Thrown when the streaming reader cannot handle the file
+struct LpStreamFallback {};
+
+inline void lpStreamAssert(const bool condition) {
+  if (!condition) throw LpStreamFallback();
+}
+
+enum class LpRawTokenType {
+  kNone,
+  kStr,
+  kCons,
+  kLess,
+  kGreater,
+  kEqual,
+  kColon,
+  kFileEnd,
+  kBracketOpen,
+  kBracketClose,
+  kPlus,
+  kMinus,
+  kHat,
+  kSlash,
+  kAsterisk
+};
+
+struct LpRawToken {
+  LpRawTokenType type = LpRawTokenType::kNone;
+  std::string svalue;
+  double dvalue = 0.0;
+
+  bool is(const LpRawTokenType t) const { return type == t; }
+};
+
+enum class LpSection {
+  kNone,
+  kObjMin,
+  kObjMax,
+  kCon,
+  kBounds,
+  kGen,
+  kBin,
+  kSemi,
+  kSos,
+  kEnd
+};
+
+struct LpSectionKeyword {
+  const char* word;
+  LpSection section;
+};
+
+const LpSectionKeyword kLpSectionKeywords[] = {
+    {"minimize", LpSection::kObjMin},
+    {"min", LpSection::kObjMin},
+    {"minimum", LpSection::kObjMin},
+    {"maximize", LpSection::kObjMax},
+    {"max", LpSection::kObjMax},
+    {"maximum", LpSection::kObjMax},
+    {"subject to", LpSection::kCon},
+    {"such that", LpSection::kCon},
+    {"st", LpSection::kCon},
+    {"s.t.", LpSection::kCon},
+    {"bounds", LpSection::kBounds},
+    {"bound", LpSection::kBounds},
+    {"binary", LpSection::kBin},
+    {"binaries", LpSection::kBin},
+    {"bin", LpSection::kBin},
+    {"general", LpSection::kGen},
+    {"generals", LpSection::kGen},
+    {"gen", LpSection::kGen},
+    {"integer", LpSection::kGen},
+    {"integers", LpSection::kGen},
+    {"semi-continuous", LpSection::kSemi},
+    {"semi", LpSection::kSemi},
+    {"semis", LpSection::kSemi},
+    {"sos", LpSection::kSos},
+    {"end", LpSection::kEnd}};
+
+// Length of the longest section keyword
+const size_t kLpMaxKeywordLength = 15;
+
+// Returns the section introduced by the keyword formed by first and,
+// if separator is nonzero, separator and second, ignoring case
+LpSection lpSectionKeyword(const std::string& first, const char separator = 0,
+                           const std::string* second = nullptr) {
+  size_t length = first.size();
+  if (separator) length += 1 + second->size();
+  if (length > kLpMaxKeywordLength) return LpSection::kNone;
+  // All section keywords start with one of these letters
+  if (!std::strchr("begims", std::tolower((unsigned char)first[0])))
+    return LpSection::kNone;
+  char word[kLpMaxKeywordLength + 1];
+  size_t k = 0;
+  for (const char c : first) word[k++] = std::tolower((unsigned char)c);
+  if (separator) {
+    word[k++] = separator;
+    for (const char c : *second) word[k++] = std::tolower((unsigned char)c);
+  }
+  word[k] = '\0';
+  for (const LpSectionKeyword& keyword : kLpSectionKeywords)
+    if (std::strcmp(word, keyword.word) == 0) return keyword.section;
+  return LpSection::kNone;
+}
+
+// Whether str is the (lower case) keyword, ignoring case
+bool lpIsKeyword(const std::string& str, const char* keyword) {
+  const size_t length = std::strlen(keyword);
+  if (str.size() != length) return false;
+  for (size_t k = 0; k < length; k++)
+    if (std::tolower((unsigned char)str[k]) != keyword[k]) return false;
+  return true;
+}
+
+// Whether c ends an identifier
+bool lpEndsIdentifier(const char c) {
+  switch (c) {
+    case '\t':
+    case '\n':
+    case '\\':
+    case ':':
+    case '+':
+    case '<':
+    case '>':
+    case '^':
+    case '=':
+    case ' ':
+    case '/':
+    case '-':
+    case '*':
+    case '[':
+    case ']':
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether strtod may read a number starting with the character c
+bool lpMayStartNumber(const char c) {
+  return std::isdigit((unsigned char)c) || std::isspace((unsigned char)c) ||
+         c == '.' || c == 'i' || c == 'I' || c == 'n' || c == 'N';
+}
+
+enum class LpTokenType {
+  kSection,
+  kVar,
+  kCon,
+  kConst,
+  kFree,
+  kBracketOpen,
+  kBracketClose,
+  kComp,
+  kSlash,
+  kAsterisk,
+  kHat,
+  kSosType,
+  kFileEnd
+};
+
+enum class LpComparison { kLeq, kLess, kEq, kGreater, kGeq };
+
+struct LpToken {
+  LpTokenType type = LpTokenType::kFileEnd;
+  LpSection section = LpSection::kNone;
+  LpComparison dir = LpComparison::kEq;
+  double value = 0.0;
+  std::string name;
+};
+
+const double kLpInf = std::numeric_limits<double>::infinity();
+
+// Number of raw tokens held, being the look-ahead needed to classify
+// a token
+const size_t kLpNumRawToken = 3;
+// Capacity of the queue of classified tokens, being a power of two
+// exceeding the look-ahead needed by the parser
+const size_t kLpTokenQueueSize = 8;
+
+// Produces the tokens of an LP file, classified as by
+// Reader::processtokens() in extern/filereaderlp. Raw and classified
+// tokens are held in rings, and names are swapped rather than copied
+// between them, so no memory is allocated once the strings have grown
+// to the longest name in the file.
+class LpTokenStream {
+ public:
+  bool open(const std::string& filename) {
+#ifdef ZLIB_FOUND
+    try {
+      file_.open(filename);
+    } catch (const strict_fstream::Exception& e) {
+      return false;
+    }
+#else
+    file_.open(filename);
+#endif
+    if (!file_.is_open()) return false;
+    for (LpRawToken& token : raw_)
+      while (!readRawToken(token))
+        ;
+    return true;
+  }
+
+  // The token k places ahead of the current one
+  LpToken& peek(const size_t k) {
+    assert(k < kLpTokenQueueSize);
+    while (size_ <= k) produceToken();
+    return queue_[(head_ + k) & (kLpTokenQueueSize - 1)];
+  }
+
+  void pop(const size_t count = 1) {
+    assert(count <= size_);
+    head_ = (head_ + count) & (kLpTokenQueueSize - 1);
+    size_ -= count;
+  }
+
+ private:
+  LpToken& emit(const LpTokenType type) {
+    assert(size_ < kLpTokenQueueSize);
+    LpToken& token = queue_[(head_ + size_) & (kLpTokenQueueSize - 1)];
+    size_++;
+    token.type = type;
+    return token;
+  }
+  void emitConst(const double value) { emit(LpTokenType::kConst).value = value; }
+  void emitComp(const LpComparison dir) { emit(LpTokenType::kComp).dir = dir; }
+  void emitName(const LpTokenType type) {
+    std::swap(emit(type).name, raw(0).svalue);
+  }
+
+  // The raw token k places ahead of the current one
+  LpRawToken& raw(const size_t k) {
+    return raw_[(raw_head_ + k) % kLpNumRawToken];
+  }
+  void nextRawToken(const size_t count = 1);
+  bool readRawToken(LpRawToken& t);
+  void produceToken();
+
+#ifdef ZLIB_FOUND
+  zstr::ifstream file_;
+#else
+  std::ifstream file_;
+#endif
+  std::string line_;
+  size_t line_pos_ = 0;
+  std::array<LpRawToken, kLpNumRawToken> raw_;
+  size_t raw_head_ = 0;
+  std::array<LpToken, kLpTokenQueueSize> queue_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+void LpTokenStream::nextRawToken(const size_t count) {
+  assert(count > 0 && count <= kLpNumRawToken);
+  raw_head_ = (raw_head_ + count) % kLpNumRawToken;
+  // Read new tokens in place of those discarded
+  for (size_t k = kLpNumRawToken - count; k < kLpNumRawToken; k++)
+    while (!readRawToken(raw(k)))
+      ;
+}
+
+// Returns true if t has been set, and false if only whitespace or a
+// comment has been skipped
+bool LpTokenStream::readRawToken(LpRawToken& t) {
+  if (line_pos_ == line_.size()) {
+    if (file_.eof()) {
+      t.type = LpRawTokenType::kFileEnd;
+      return true;
+    }
+    std::getline(file_, line_);
+    if (!line_.empty() && line_.back() == '\r') line_.pop_back();
+    line_pos_ = 0;
+  }
+
+  const char next_char = line_[line_pos_];
+  LpRawTokenType type = LpRawTokenType::kNone;
+  switch (next_char) {
+    case '\\':
+      line_pos_ = line_.size();
+      return false;
+    case '[':
+      type = LpRawTokenType::kBracketOpen;
+      break;
+    case ']':
+      type = LpRawTokenType::kBracketClose;
+      break;
+    case '<':
+      type = LpRawTokenType::kLess;
+      break;
+    case '>':
+      type = LpRawTokenType::kGreater;
+      break;
+    case '=':
+      type = LpRawTokenType::kEqual;
+      break;
+    case ':':
+      type = LpRawTokenType::kColon;
+      break;
+    case '+':
+      type = LpRawTokenType::kPlus;
+      break;
+    case '^':
+      type = LpRawTokenType::kHat;
+      break;
+    case '/':
+      type = LpRawTokenType::kSlash;
+      break;
+    case '*':
+      type = LpRawTokenType::kAsterisk;
+      break;
+    case '-':
+      type = LpRawTokenType::kMinus;
+      break;
+    case ' ':
+    case '\t':
+      line_pos_++;
+      return false;
+    case ';':
+    case '\n':
+      line_pos_ = line_.size();
+      return false;
+    case '\0':
+      lpStreamAssert(line_pos_ == line_.size());
+      return false;
+  }
+  if (type != LpRawTokenType::kNone) {
+    t.type = type;
+    line_pos_++;
+    return true;
+  }
+
+  const char* start = line_.data() + line_pos_;
+  if (lpMayStartNumber(next_char)) {
+    char* end;
+    const double constant = std::strtod(start, &end);
+    if (end != start) {
+      t.type = LpRawTokenType::kCons;
+      t.dvalue = constant;
+      line_pos_ += end - start;
+      return true;
+    }
+  }
+
+  // Assume that it's a (section, variable or constraint) identifier
+  size_t end_pos = line_pos_;
+  while (end_pos < line_.size() && !lpEndsIdentifier(line_[end_pos]))
+    end_pos++;
+  lpStreamAssert(end_pos > line_pos_);
+  t.type = LpRawTokenType::kStr;
+  t.svalue.assign(line_, line_pos_, end_pos - line_pos_);
+  line_pos_ = end_pos;
+  return true;
+}
+
+void LpTokenStream::produceToken() {
+  for (;;) {
+    if (raw(0).is(LpRawTokenType::kFileEnd)) {
+      emit(LpTokenType::kFileEnd);
+      return;
+    }
+
+    // Slash and asterisk start a comment that ends with asterisk and
+    // slash
+    if (raw(0).is(LpRawTokenType::kSlash) &&
+        raw(1).is(LpRawTokenType::kAsterisk)) {
+      do {
+        nextRawToken(2);
+      } while (!(raw(0).is(LpRawTokenType::kAsterisk) &&
+                 raw(1).is(LpRawTokenType::kSlash)) &&
+               !raw(0).is(LpRawTokenType::kFileEnd));
+      nextRawToken(2);
+      continue;
+    }
+
+    if (raw(0).is(LpRawTokenType::kStr)) {
+      // Long section keyword semi-continuous
+      if (raw(1).is(LpRawTokenType::kMinus) &&
+          raw(2).is(LpRawTokenType::kStr)) {
+        const LpSection section =
+            lpSectionKeyword(raw(0).svalue, '-', &raw(2).svalue);
+        if (section != LpSection::kNone) {
+          emit(LpTokenType::kSection).section = section;
+          nextRawToken(3);
+          return;
+        }
+      }
+      // Long section keyword subject to or such that
+      if (raw(1).is(LpRawTokenType::kStr)) {
+        const LpSection section =
+            lpSectionKeyword(raw(0).svalue, ' ', &raw(1).svalue);
+        if (section != LpSection::kNone) {
+          emit(LpTokenType::kSection).section = section;
+          nextRawToken(2);
+          return;
+        }
+      }
+      // Other section keyword
+      const LpSection section = lpSectionKeyword(raw(0).svalue);
+      if (section != LpSection::kNone) {
+        emit(LpTokenType::kSection).section = section;
+        nextRawToken();
+        return;
+      }
+      // SOS type identifier "S1 ::" or "S2 ::"
+      if (raw(1).is(LpRawTokenType::kColon) &&
+          raw(2).is(LpRawTokenType::kColon)) {
+        const std::string& sos = raw(0).svalue;
+        lpStreamAssert(sos.size() == 2 && (sos[0] == 'S' || sos[0] == 's') &&
+                       (sos[1] == '1' || sos[1] == '2'));
+        emit(LpTokenType::kSosType);
+        nextRawToken(3);
+        return;
+      }
+      // Constraint identifier
+      if (raw(1).is(LpRawTokenType::kColon)) {
+        emitName(LpTokenType::kCon);
+        nextRawToken(2);
+        return;
+      }
+      if (lpIsKeyword(raw(0).svalue, "free")) {
+        emit(LpTokenType::kFree);
+      } else if (lpIsKeyword(raw(0).svalue, "infinity") ||
+                 lpIsKeyword(raw(0).svalue, "inf")) {
+        emitConst(kLpInf);
+      } else {
+        // Assume that it's a variable identifier
+        emitName(LpTokenType::kVar);
+      }
+      nextRawToken();
+      return;
+    }
+
+    if (raw(0).is(LpRawTokenType::kPlus) ||
+        raw(0).is(LpRawTokenType::kMinus)) {
+      double sign = raw(0).is(LpRawTokenType::kPlus) ? 1.0 : -1.0;
+      nextRawToken();
+      // Another + or - (#948, #950)
+      if (raw(0).is(LpRawTokenType::kPlus) ||
+          raw(0).is(LpRawTokenType::kMinus)) {
+        sign *= raw(0).is(LpRawTokenType::kPlus) ? 1.0 : -1.0;
+        nextRawToken();
+      }
+      if (raw(0).is(LpRawTokenType::kCons)) {
+        emitConst(sign * raw(0).dvalue);
+        nextRawToken();
+        return;
+      }
+      if (raw(0).is(LpRawTokenType::kBracketOpen) && sign == 1.0) {
+        emit(LpTokenType::kBracketOpen);
+        nextRawToken();
+        return;
+      }
+      // A sign before a variable name is a coefficient, and the name
+      // is classified next
+      lpStreamAssert(raw(0).is(LpRawTokenType::kStr));
+      emitConst(sign);
+      return;
+    }
+
+    switch (raw(0).type) {
+      case LpRawTokenType::kCons:
+        lpStreamAssert(!raw(1).is(LpRawTokenType::kBracketOpen));
+        emitConst(raw(0).dvalue);
+        break;
+      case LpRawTokenType::kBracketOpen:
+        emit(LpTokenType::kBracketOpen);
+        break;
+      case LpRawTokenType::kBracketClose:
+        emit(LpTokenType::kBracketClose);
+        break;
+      case LpRawTokenType::kSlash:
+        emit(LpTokenType::kSlash);
+        break;
+      case LpRawTokenType::kAsterisk:
+        emit(LpTokenType::kAsterisk);
+        break;
+      case LpRawTokenType::kHat:
+        emit(LpTokenType::kHat);
+        break;
+      case LpRawTokenType::kLess:
+        if (raw(1).is(LpRawTokenType::kEqual)) {
+          emitComp(LpComparison::kLeq);
+          nextRawToken(2);
+          return;
+        }
+        emitComp(LpComparison::kLess);
+        break;
+      case LpRawTokenType::kGreater:
+        if (raw(1).is(LpRawTokenType::kEqual)) {
+          emitComp(LpComparison::kGeq);
+          nextRawToken(2);
+          return;
+        }
+        emitComp(LpComparison::kGreater);
+        break;
+      case LpRawTokenType::kEqual:
+        emitComp(LpComparison::kEq);
+        break;
+      default:
+        // Unknown symbol
+        throw LpStreamFallback();
+    }
+    nextRawToken();
+    return;
+  }
+}
+
+enum class LpVarType : uint8_t {
+  kContinuous,
+  kBinary,
+  kGeneral,
+  kSemiContinuous,
+  kSemiInteger
+};
+
+struct LpQuadTerm {
+  HighsInt col1;
+  HighsInt col2;
+  double coef;
+};
+
+// Parses an LP file section by section, building the data for the
+// HighsModel as FilereaderLp::readModelFromFile() does from the Model
+// of the original reader
+class LpStreamReader {
+ public:
+  bool open(const std::string& filename) { return tokens_.open(filename); }
+  void read();
+  void build(HighsModel& model);
+
+ private:
+  bool inSection(const size_t k) {
+    const LpTokenType type = tokens_.peek(k).type;
+    return type != LpTokenType::kSection && type != LpTokenType::kFileEnd;
+  }
+  bool isType(const size_t k, const LpTokenType type) {
+    return tokens_.peek(k).type == type;
+  }
+
+  HighsInt findColumn(const std::string& name,
+                      const HighsHashHelpers::u64 hash) const;
+  HighsInt column(const std::string& name);
+  size_t slotIndex(const HighsHashHelpers::u64 hash) const {
+    return size_t((hash * HighsHashHelpers::u64{0x9e3779b97f4a7c15}) >>
+                  name_shift_);
+  }
+  void rehashColumns(const size_t capacity);
+  void insertColumn(const HighsHashHelpers::u64 hash, const HighsInt iCol);
+
+  void readExpression(const bool objective);
+  void readQuadraticTerms();
+  void readConstraints();
+  void readBounds();
+  void readIntegrality(const LpSection section, std::vector<HighsInt>& entry);
+  void applyIntegrality(const LpSection section,
+                        const std::vector<HighsInt>& entry);
+
+  LpTokenStream tokens_;
+
+  // Column names, held consecutively in the arena, and an open
+  // addressing hash table of column indices. The slots hold the hash
+  // of the name so that the arena is only accessed for a likely match
+  struct NameSlot {
+    HighsHashHelpers::u64 hash;
+    HighsInt col;
+  };
+  std::vector<char> name_arena_;
+  std::vector<size_t> name_start_ = {0};
+  std::vector<NameSlot> name_slot_;
+  size_t num_name_ = 0;
+  int name_shift_ = 64;
+
+  std::vector<double> col_cost_;
+  std::vector<double> col_lower_;
+  std::vector<double> col_upper_;
+  std::vector<LpVarType> col_type_;
+
+  ObjSense sense_ = ObjSense::kMinimize;
+  std::string objective_name_;
+  double offset_ = 0.0;
+  std::vector<LpQuadTerm> quad_term_;
+
+  std::vector<double> row_lower_;
+  std::vector<double> row_upper_;
+  std::vector<std::string> row_names_;
+  std::vector<HighsInt> ar_start_ = {0};
+  std::vector<HighsInt> ar_index_;
+  std::vector<double> ar_value_;
+
+  // Entries of the general, binary and semi-continuous sections,
+  // applied in that order once the file has been read. Names not yet
+  // known are held in the pending arena, and referred to by the
+  // negative values -1, -2, ...
+  std::vector<HighsInt> gen_entry_;
+  std::vector<HighsInt> bin_entry_;
+  std::vector<HighsInt> semi_entry_;
+  std::vector<char> pending_arena_;
+  std::vector<size_t> pending_start_ = {0};
+};
+
+HighsInt LpStreamReader::findColumn(const std::string& name,
+                                    const HighsHashHelpers::u64 hash) const {
+  if (name_slot_.empty()) return -1;
+  const size_t mask = name_slot_.size() - 1;
+  size_t pos = slotIndex(hash);
+  for (;; pos = (pos + 1) & mask) {
+    const NameSlot& slot = name_slot_[pos];
+    if (slot.col < 0) return -1;
+    if (slot.hash != hash) continue;
+    const HighsInt iCol = slot.col;
+    const size_t length = name_start_[iCol + 1] - name_start_[iCol];
+    if (length == name.size() &&
+        std::memcmp(&name_arena_[name_start_[iCol]], name.data(), length) ==
+            0)
+      return iCol;
+  }
+}
+
+void LpStreamReader::rehashColumns(const size_t capacity) {
+  std::vector<NameSlot> slots(capacity, NameSlot{0, -1});
+  std::swap(slots, name_slot_);
+  name_shift_ = 64;
+  for (size_t c = capacity; c > 1; c /= 2) name_shift_--;
+  for (const NameSlot& slot : slots)
+    if (slot.col >= 0) insertColumn(slot.hash, slot.col);
+}
+
+void LpStreamReader::insertColumn(const HighsHashHelpers::u64 hash,
+                                  const HighsInt iCol) {
+  const size_t mask = name_slot_.size() - 1;
+  size_t pos = slotIndex(hash);
+  while (name_slot_[pos].col >= 0) pos = (pos + 1) & mask;
+  name_slot_[pos] = NameSlot{hash, iCol};
+}
+
+HighsInt LpStreamReader::column(const std::string& name) {
+  const HighsHashHelpers::u64 hash =
+      HighsHashHelpers::vector_hash(name.data(), name.size());
+  HighsInt iCol = findColumn(name, hash);
+  if (iCol >= 0) return iCol;
+  iCol = (HighsInt)col_cost_.size();
+  name_arena_.insert(name_arena_.end(), name.begin(), name.end());
+  name_start_.push_back(name_arena_.size());
+  col_cost_.push_back(0.0);
+  col_lower_.push_back(0.0);
+  col_upper_.push_back(kLpInf);
+  col_type_.push_back(LpVarType::kContinuous);
+  if (2 * ++num_name_ > name_slot_.size())
+    rehashColumns(std::max(size_t{16}, 2 * name_slot_.size()));
+  insertColumn(hash, iCol);
+  return iCol;
+}
+
+void LpStreamReader::readExpression(const bool objective) {
+  for (;;) {
+    if (!inSection(0)) return;
+    const LpToken& token = tokens_.peek(0);
+    HighsInt iCol;
+    double coef;
+    if (token.type == LpTokenType::kConst) {
+      if (!isType(1, LpTokenType::kVar)) {
+        // The offset of a constraint is ignored, as by the original
+        // reader
+        if (objective) offset_ += token.value;
+        tokens_.pop();
+        continue;
+      }
+      coef = token.value;
+      iCol = column(tokens_.peek(1).name);
+      tokens_.pop(2);
+    } else if (token.type == LpTokenType::kVar) {
+      coef = 1.0;
+      iCol = column(token.name);
+      tokens_.pop();
+    } else if (token.type == LpTokenType::kBracketOpen && inSection(1)) {
+      // Quadratic constraints are not supported, so are left to the
+      // original reader to report
+      lpStreamAssert(objective);
+      tokens_.pop();
+      readQuadraticTerms();
+      continue;
+    } else {
+      return;
+    }
+    if (objective) {
+      col_cost_[iCol] = coef;
+    } else if (coef) {
+      ar_index_.push_back(iCol);
+      ar_value_.push_back(coef);
+    }
+  }
+}
+
+void LpStreamReader::readQuadraticTerms() {
+  // Since the token types checked are within a section, there is no
+  // need to check for the end of the section
+  while (inSection(0) && !isType(0, LpTokenType::kBracketClose)) {
+    // const var hat const
+    if (isType(0, LpTokenType::kConst) && isType(1, LpTokenType::kVar) &&
+        isType(2, LpTokenType::kHat) && isType(3, LpTokenType::kConst)) {
+      lpStreamAssert(tokens_.peek(3).value == 2.0);
+      const HighsInt iCol = column(tokens_.peek(1).name);
+      quad_term_.push_back(LpQuadTerm{iCol, iCol, tokens_.peek(0).value});
+      tokens_.pop(4);
+      continue;
+    }
+    // var hat const
+    if (isType(0, LpTokenType::kVar) && isType(1, LpTokenType::kHat) &&
+        isType(2, LpTokenType::kConst)) {
+      lpStreamAssert(tokens_.peek(2).value == 2.0);
+      const HighsInt iCol = column(tokens_.peek(0).name);
+      quad_term_.push_back(LpQuadTerm{iCol, iCol, 1.0});
+      tokens_.pop(3);
+      continue;
+    }
+    // const var asterisk var
+    if (isType(0, LpTokenType::kConst) && isType(1, LpTokenType::kVar) &&
+        isType(2, LpTokenType::kAsterisk) && isType(3, LpTokenType::kVar)) {
+      const HighsInt iCol1 = column(tokens_.peek(1).name);
+      const HighsInt iCol2 = column(tokens_.peek(3).name);
+      quad_term_.push_back(LpQuadTerm{iCol1, iCol2, tokens_.peek(0).value});
+      tokens_.pop(4);
+      continue;
+    }
+    // var asterisk var
+    if (isType(0, LpTokenType::kVar) && isType(1, LpTokenType::kAsterisk) &&
+        isType(2, LpTokenType::kVar)) {
+      const HighsInt iCol1 = column(tokens_.peek(0).name);
+      const HighsInt iCol2 = column(tokens_.peek(2).name);
+      quad_term_.push_back(LpQuadTerm{iCol1, iCol2, 1.0});
+      tokens_.pop(3);
+      continue;
+    }
+    break;
+  }
+  // In the objective, the quadratic terms are followed by "]/2"
+  lpStreamAssert(isType(0, LpTokenType::kBracketClose) &&
+                 isType(1, LpTokenType::kSlash) &&
+                 isType(2, LpTokenType::kConst) &&
+                 tokens_.peek(2).value == 2.0);
+  tokens_.pop(3);
+}
+
+void LpStreamReader::readConstraints() {
+  while (inSection(0)) {
+    if (isType(0, LpTokenType::kCon)) {
+      row_names_.push_back(tokens_.peek(0).name);
+      tokens_.pop();
+    } else {
+      row_names_.emplace_back();
+    }
+    readExpression(false);
+    lpStreamAssert(isType(0, LpTokenType::kComp) &&
+                   isType(1, LpTokenType::kConst));
+    const LpComparison dir = tokens_.peek(0).dir;
+    const double value = tokens_.peek(1).value;
+    tokens_.pop(2);
+    double lower = -kLpInf;
+    double upper = kLpInf;
+    switch (dir) {
+      case LpComparison::kEq:
+        lower = value;
+        upper = value;
+        break;
+      case LpComparison::kLeq:
+        upper = value;
+        break;
+      case LpComparison::kGeq:
+        lower = value;
+        break;
+      default:
+        throw LpStreamFallback();
+    }
+    row_lower_.push_back(lower);
+    row_upper_.push_back(upper);
+    ar_start_.push_back((HighsInt)ar_index_.size());
+  }
+}
+
+void LpStreamReader::readBounds() {
+  while (inSection(0)) {
+    // var free
+    if (isType(0, LpTokenType::kVar) && isType(1, LpTokenType::kFree)) {
+      const HighsInt iCol = column(tokens_.peek(0).name);
+      col_lower_[iCol] = -kLpInf;
+      col_upper_[iCol] = kLpInf;
+      tokens_.pop(2);
+      continue;
+    }
+    // const comp var comp const
+    if (isType(0, LpTokenType::kConst) && isType(1, LpTokenType::kComp) &&
+        isType(2, LpTokenType::kVar) && isType(3, LpTokenType::kComp) &&
+        isType(4, LpTokenType::kConst)) {
+      lpStreamAssert(tokens_.peek(1).dir == LpComparison::kLeq &&
+                     tokens_.peek(3).dir == LpComparison::kLeq);
+      const HighsInt iCol = column(tokens_.peek(2).name);
+      col_lower_[iCol] = tokens_.peek(0).value;
+      col_upper_[iCol] = tokens_.peek(4).value;
+      tokens_.pop(5);
+      continue;
+    }
+    // const comp var, or var comp const
+    const bool const_first = isType(0, LpTokenType::kConst) &&
+                             isType(1, LpTokenType::kComp) &&
+                             isType(2, LpTokenType::kVar);
+    lpStreamAssert(const_first || (isType(0, LpTokenType::kVar) &&
+                                   isType(1, LpTokenType::kComp) &&
+                                   isType(2, LpTokenType::kConst)));
+    const double value = tokens_.peek(const_first ? 0 : 2).value;
+    const HighsInt iCol = column(tokens_.peek(const_first ? 2 : 0).name);
+    switch (tokens_.peek(1).dir) {
+      case LpComparison::kEq:
+        col_lower_[iCol] = value;
+        col_upper_[iCol] = value;
+        break;
+      case LpComparison::kLeq:
+        if (const_first)
+          col_lower_[iCol] = value;
+        else
+          col_upper_[iCol] = value;
+        break;
+      case LpComparison::kGeq:
+        if (const_first)
+          col_upper_[iCol] = value;
+        else
+          col_lower_[iCol] = value;
+        break;
+      default:
+        throw LpStreamFallback();
+    }
+    tokens_.pop(3);
+  }
+}
+
+void LpStreamReader::readIntegrality(const LpSection section,
+                                     std::vector<HighsInt>& entry) {
+  for (;;) {
+    const LpToken& token = tokens_.peek(0);
+    // The section keyword may be repeated
+    if (token.type == LpTokenType::kSection && token.section == section) {
+      tokens_.pop();
+      continue;
+    }
+    if (!inSection(0)) return;
+    lpStreamAssert(token.type == LpTokenType::kVar);
+    const std::string& name = token.name;
+    HighsInt iCol = findColumn(
+        name, HighsHashHelpers::vector_hash(name.data(), name.size()));
+    if (iCol < 0) {
+      pending_arena_.insert(pending_arena_.end(), name.begin(), name.end());
+      pending_start_.push_back(pending_arena_.size());
+      iCol = -(HighsInt)(pending_start_.size() - 1);
+    }
+    entry.push_back(iCol);
+    tokens_.pop();
+  }
+}
+
+void LpStreamReader::applyIntegrality(const LpSection section,
+                                      const std::vector<HighsInt>& entry) {
+  std::string name;
+  for (HighsInt iCol : entry) {
+    if (iCol < 0) {
+      const size_t k = -iCol - 1;
+      name.assign(pending_arena_.data() + pending_start_[k],
+                  pending_start_[k + 1] - pending_start_[k]);
+      iCol = column(name);
+    }
+    LpVarType& type = col_type_[iCol];
+    switch (section) {
+      case LpSection::kGen:
+        type = type == LpVarType::kSemiContinuous ? LpVarType::kSemiInteger
+                                                  : LpVarType::kGeneral;
+        break;
+      case LpSection::kBin:
+        type = LpVarType::kBinary;
+        // Respect any bounds already declared
+        if (col_upper_[iCol] == kLpInf) col_upper_[iCol] = 1.0;
+        break;
+      default:
+        assert(section == LpSection::kSemi);
+        type = type == LpVarType::kGeneral ? LpVarType::kSemiInteger
+                                           : LpVarType::kSemiContinuous;
+    }
+  }
+}
+
+void LpStreamReader::read() {
+  // Tokens before the first section keyword are left to the original
+  // reader
+  lpStreamAssert(isType(0, LpTokenType::kSection));
+  // Rank of the latest section: sections must start with the
+  // objective, with ranks increasing, other than for the general,
+  // binary and semi-continuous sections, which are of equal rank
+  HighsInt rank = 0;
+  const HighsInt kIntegralityRank = 4;
+  auto enterSection = [&](const HighsInt section_rank) {
+    lpStreamAssert(rank > 0 && rank <= section_rank &&
+                   (rank < section_rank || rank == kIntegralityRank));
+    rank = section_rank;
+  };
+  bool have_section[3] = {false, false, false};
+  // The original reader fails unless the last section keyword is
+  // followed by the end of the file
+  bool last_section_empty = false;
+  while (!isType(0, LpTokenType::kFileEnd)) {
+    assert(isType(0, LpTokenType::kSection));
+    const LpSection section = tokens_.peek(0).section;
+    tokens_.pop();
+    last_section_empty = isType(0, LpTokenType::kFileEnd);
+    switch (section) {
+      case LpSection::kObjMin:
+      case LpSection::kObjMax:
+        lpStreamAssert(rank == 0);
+        rank = 1;
+        sense_ = section == LpSection::kObjMin ? ObjSense::kMinimize
+                                               : ObjSense::kMaximize;
+        // The original reader fails if the objective section is empty
+        lpStreamAssert(inSection(0));
+        if (isType(0, LpTokenType::kCon)) {
+          objective_name_ = tokens_.peek(0).name;
+          tokens_.pop();
+        }
+        readExpression(true);
+        lpStreamAssert(!inSection(0));
+        break;
+      case LpSection::kCon:
+        enterSection(2);
+        readConstraints();
+        break;
+      case LpSection::kBounds:
+        enterSection(3);
+        readBounds();
+        break;
+      case LpSection::kGen:
+      case LpSection::kBin:
+      case LpSection::kSemi: {
+        enterSection(kIntegralityRank);
+        const HighsInt k = section == LpSection::kGen   ? 0
+                           : section == LpSection::kBin ? 1
+                                                        : 2;
+        lpStreamAssert(!have_section[k]);
+        have_section[k] = true;
+        readIntegrality(section, k == 0   ? gen_entry_
+                                 : k == 1 ? bin_entry_
+                                          : semi_entry_);
+        break;
+      }
+      case LpSection::kEnd:
+        enterSection(kIntegralityRank + 1);
+        lpStreamAssert(isType(0, LpTokenType::kFileEnd));
+        break;
+      default:
+        // SOS are not supported, so are left to the original reader
+        // to report
+        throw LpStreamFallback();
+    }
+  }
+  lpStreamAssert(rank > 0 && last_section_empty);
+  // Apply the integrality sections in the order of the original
+  // reader, so that any new columns are added in the same order
+  applyIntegrality(LpSection::kGen, gen_entry_);
+  applyIntegrality(LpSection::kBin, bin_entry_);
+  applyIntegrality(LpSection::kSemi, semi_entry_);
+}
+
+void LpStreamReader::build(HighsModel& model) {
+  HighsLp& lp = model.lp_;
+  HighsHessian& hessian = model.hessian_;
+  const HighsInt num_col = (HighsInt)col_cost_.size();
+  const HighsInt num_row = (HighsInt)row_lower_.size();
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+
+  lp.col_names_.reserve(num_col);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    lp.col_names_.emplace_back(name_arena_.data() + name_start_[iCol],
+                               name_start_[iCol + 1] - name_start_[iCol]);
+  std::vector<char>().swap(name_arena_);
+  std::vector<size_t>().swap(name_start_);
+  std::vector<NameSlot>().swap(name_slot_);
+
+  lp.integrality_.assign(num_col, HighsVarType::kContinuous);
+  HighsInt num_continuous = 0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    switch (col_type_[iCol]) {
+      case LpVarType::kBinary:
+      case LpVarType::kGeneral:
+        lp.integrality_[iCol] = HighsVarType::kInteger;
+        break;
+      case LpVarType::kSemiContinuous:
+        lp.integrality_[iCol] = HighsVarType::kSemiContinuous;
+        break;
+      case LpVarType::kSemiInteger:
+        lp.integrality_[iCol] = HighsVarType::kSemiInteger;
+        break;
+      default:
+        num_continuous++;
+    }
+  }
+  if (num_continuous == num_col) lp.integrality_.clear();
+  lp.col_cost_ = std::move(col_cost_);
+  lp.col_lower_ = std::move(col_lower_);
+  lp.col_upper_ = std::move(col_upper_);
+  lp.objective_name_ = objective_name_;
+  lp.offset_ = offset_;
+  lp.sense_ = sense_;
+
+  // Form the square Hessian, with the entries of each column in the
+  // order of the quadratic terms that define them, and without zeros
+  std::vector<HighsInt> q_start(num_col + 1, 0);
+  for (const LpQuadTerm& term : quad_term_) {
+    if (term.col1 != term.col2) {
+      if (term.coef / 2) {
+        q_start[term.col1 + 1]++;
+        q_start[term.col2 + 1]++;
+      }
+    } else if (term.coef) {
+      q_start[term.col1 + 1]++;
+    }
+  }
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    q_start[iCol + 1] += q_start[iCol];
+  const HighsInt q_num_nz = q_start[num_col];
+  if (q_num_nz) {
+    hessian.dim_ = num_col;
+    hessian.index_.resize(q_num_nz);
+    hessian.value_.resize(q_num_nz);
+    std::vector<HighsInt> q_next(q_start.begin(), q_start.end() - 1);
+    auto addEntry = [&](const HighsInt iCol, const HighsInt index,
+                        const double value) {
+      const HighsInt iEl = q_next[iCol]++;
+      hessian.index_[iEl] = index;
+      hessian.value_[iEl] = value;
+    };
+    for (const LpQuadTerm& term : quad_term_) {
+      if (term.col1 != term.col2) {
+        if (term.coef / 2) {
+          addEntry(term.col1, term.col2, term.coef / 2);
+          addEntry(term.col2, term.col1, term.coef / 2);
+        }
+      } else if (term.coef) {
+        addEntry(term.col1, term.col1, term.coef);
+      }
+    }
+    hessian.start_ = std::move(q_start);
+    hessian.format_ = HessianFormat::kSquare;
+  }
+  std::vector<LpQuadTerm>().swap(quad_term_);
+
+  lp.row_lower_ = std::move(row_lower_);
+  lp.row_upper_ = std::move(row_upper_);
+  lp.row_names_ = std::move(row_names_);
+
+  // Transpose the row-wise matrix, freeing it once done
+  HighsSparseMatrix& matrix = lp.a_matrix_;
+  const HighsInt num_nz = (HighsInt)ar_index_.size();
+  matrix.start_.assign(num_col + 1, 0);
+  for (HighsInt iEl = 0; iEl < num_nz; iEl++)
+    matrix.start_[ar_index_[iEl] + 1]++;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    matrix.start_[iCol + 1] += matrix.start_[iCol];
+  matrix.index_.resize(num_nz);
+  matrix.value_.resize(num_nz);
+  std::vector<HighsInt> a_next(matrix.start_.begin(), matrix.start_.end() - 1);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    for (HighsInt iEl = ar_start_[iRow]; iEl < ar_start_[iRow + 1]; iEl++) {
+      const HighsInt iPut = a_next[ar_index_[iEl]]++;
+      matrix.index_[iPut] = iRow;
+      matrix.value_[iPut] = ar_value_[iEl];
+    }
+  }
+  std::vector<HighsInt>().swap(ar_start_);
+  std::vector<HighsInt>().swap(ar_index_);
+  std::vector<double>().swap(ar_value_);
+  matrix.format_ = MatrixFormat::kColwise;
+}
+
+}  // namespace
+
+bool FilereaderLp::readModelStreaming(const HighsOptions& options,
+                                      const std::string& filename,
+                                      HighsModel& model) {
+  LpStreamReader reader;
+  if (!reader.open(filename)) return false;
+  bool fallback = false;
+  try {
+    reader.read();
+  } catch (const LpStreamFallback&) {
+    fallback = true;
+  } catch (const std::exception&) {
+    // Such as a corrupt compressed file
+    fallback = true;
+  }
+  if (fallback) {
+    highsLogDev(options.log_options, HighsLogType::kInfo,
+                "Streaming LP file reader cannot read %s, so using the "
+                "original reader\n",
+                filename.c_str());
+    return false;
+  }
+  reader.build(model);
+  nameUnnamedRows(options.log_options, model.lp_);
+  return true;
+}
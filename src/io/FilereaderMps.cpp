@@ -32,6 +32,7 @@ FilereaderRetcode FilereaderMps::readModelFromFile(const HighsOptions& options,
     HMpsFF parser{};
     if (options.time_limit < kHighsInf && options.time_limit > 0)
       parser.time_limit = options.time_limit;
+    parser.use_mapped_file = options.mps_parser_mapped;
 
     FreeFormatParserReturnCode result =
         parser.loadProblem(options.log_options, filename, model);
@@ -74,7 +74,7 @@ FreeFormatParserReturnCode HMpsFF::loadProblem(
   }
   col_cost.assign(num_col, 0);
   for (auto i : coeffobj) col_cost[i.first] = i.second;
-  HighsInt status = fillMatrix(log_options);
+  HighsInt status = a_matrix_assembled_ ? 0 : fillMatrix(log_options);
   if (status) return FreeFormatParserReturnCode::kParserError;
   status = fillHessian(log_options);
   if (status) return FreeFormatParserReturnCode::kParserError;
@@ -214,6 +214,11 @@ FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
                                          const std::string& filename) {
   HMpsFF::Parsekey keyword = HMpsFF::Parsekey::kNone;
 
+  if (use_mapped_file) {
+    FreeFormatParserReturnCode result;
+    if (parseMapped(log_options, filename, result)) return result;
+  }
+
   highsLogDev(log_options, HighsLogType::kInfo,
               "readMPS: Trying to open file %s\n", filename.c_str());
 #ifdef ZLIB_FOUND
@@ -63,6 +63,12 @@ class HMpsFF {
 
   double time_limit = kHighsInf;
 
+  // Whether to try reading the file through a memory map, splitting
+  // the sections into chunks that may be parsed in parallel
+  bool use_mapped_file = true;
+  // Target size in bytes of the chunks of a mapped file
+  size_t mapped_chunk_size = size_t{1} << 22;
+
  private:
   double start_time;
 
@@ -88,6 +94,10 @@ class HMpsFF {
 
   std::vector<HighsVarType> col_integrality;
 
+  // Set when the mapped file parser has assembled the constraint
+  // matrix directly, rather than as the triplets in entries
+  bool a_matrix_assembled_ = false;
+
   HighsInt q_dim;
   std::vector<HighsInt> q_start;
   std::vector<HighsInt> q_index;
@@ -191,6 +201,13 @@ class HMpsFF {
 
   FreeFormatParserReturnCode parse(const HighsLogOptions& log_options,
                                    const std::string& filename);
+  // Parses the file through a memory map, returning false if the file
+  // cannot be mapped or contains anything that the mapped file parser
+  // does not handle identically to parse(). In that case, nothing is
+  // changed, so parse() can read the file line by line
+  bool parseMapped(const HighsLogOptions& log_options,
+                   const std::string& filename,
+                   FreeFormatParserReturnCode& result);
   // Checks first word of strline and wraps it by it_begin and it_end
   HMpsFF::Parsekey checkFirstWord(std::string& strline, size_t& start,
                                   size_t& end, std::string& word) const;
@@ -0,0 +1,1112 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HMpsFFMapped.cpp
+ * @brief Free format MPS parser for memory-mapped files
+ *
+ * The file is mapped into memory and scanned for section headers. The
+ * ROWS, COLUMNS, RHS, RANGES and BOUNDS sections are then split into
+ * chunks of whole lines that are tokenized in parallel, with names
+ * referring directly to the mapped file, and the results of the
+ * chunks are combined in file order. The column-wise constraint
+ * matrix is assembled directly from the chunks.
+ *
+ * Only files whose interpretation by HMpsFF::parse() is free of
+ * warnings are handled, so that the model is identical to that
+ * obtained by parse(). Anything else - compressed files, other
+ * sections, unknown or duplicate names, duplicate entries and so on -
+ * leads to HMpsFF::parseMapped() returning false, so that parse()
+ * reads the file and reports any anomaly.
+ */
+#include <cstdlib>
+
+#include "io/HMpsFF.h"
+#include "io/HighsMappedFile.h"
+#include "parallel/HighsParallel.h"
+#include "util/HighsHash.h"
+
+namespace free_format_parser {
+
+namespace {
+
+// A word in the mapped file
+struct MpsToken {
+  const char* data;
+  HighsInt size;
+
+  bool operator==(const MpsToken& other) const {
+    return size == other.size && std::memcmp(data, other.data, size) == 0;
+  }
+  bool operator!=(const MpsToken& other) const { return !(*this == other); }
+  bool equals(const char* word) const {
+    return std::strlen(word) == size_t(size) &&
+           std::memcmp(data, word, size) == 0;
+  }
+  std::string str() const { return std::string(data, size); }
+  HighsHashHelpers::u64 hash() const {
+    return HighsHashHelpers::vector_hash(data, size);
+  }
+};
+
+// The set of characters that separate words, as in util/stringutil
+inline bool isMpsSpace(const char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' ||
+         c == '\r';
+}
+
+// No data line that is handled has more words than this
+const HighsInt kMaxLineTokens = 6;
+
+// Splits [begin, end) into words, storing at most kMaxLineTokens of
+// them, and returns the number of words
+HighsInt tokenizeLine(const char* begin, const char* end, MpsToken* tokens) {
+  HighsInt num_tokens = 0;
+  const char* p = begin;
+  for (;;) {
+    while (p < end && isMpsSpace(*p)) p++;
+    if (p == end) break;
+    const char* word = p;
+    while (p < end && !isMpsSpace(*p)) p++;
+    if (num_tokens < kMaxLineTokens)
+      tokens[num_tokens] = MpsToken{word, HighsInt(p - word)};
+    num_tokens++;
+  }
+  return num_tokens;
+}
+
+// Calls f(line_begin, line_end) for the lines of [begin, end) until
+// it returns false, returning false in that case
+template <typename F>
+bool forEachLine(const char* begin, const char* end, F&& f) {
+  while (begin < end) {
+    const char* eol =
+        static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    const char* line_end = eol ? eol : end;
+    if (!f(begin, line_end)) return false;
+    begin = eol ? eol + 1 : end;
+  }
+  return true;
+}
+
+// Converts a word to a double as HMpsFF::getValue() does, replacing
+// the first D (or, if there is none, the first d) by E
+double mpsValue(const MpsToken& token) {
+  char buffer[64];
+  std::string long_word;
+  char* word = buffer;
+  if (token.size < HighsInt(sizeof(buffer))) {
+    std::memcpy(buffer, token.data, token.size);
+    buffer[token.size] = '\0';
+  } else {
+    long_word = token.str();
+    word = &long_word[0];
+  }
+  char* d = std::strchr(word, 'D');
+  if (d == nullptr) d = std::strchr(word, 'd');
+  if (d != nullptr) *d = 'E';
+  return std::strtod(word, nullptr);
+}
+
+// The section keywords recognised by HMpsFF::checkFirstWord()
+enum class MpsKeyword {
+  kNone,
+  kName,
+  kObjsense,
+  kMax,
+  kMin,
+  kRows,
+  kCols,
+  kRhs,
+  kRanges,
+  kBounds,
+  kEnd,
+  kOther
+};
+
+MpsKeyword mpsKeyword(const MpsToken& word) {
+  if (word.size < 3 || word.size > 11 || word.data[0] < 'A' ||
+      word.data[0] > 'Z')
+    return MpsKeyword::kNone;
+  if (word.equals("NAME")) return MpsKeyword::kName;
+  if (word.equals("OBJSENSE")) return MpsKeyword::kObjsense;
+  if (word.equals("MAX")) return MpsKeyword::kMax;
+  if (word.equals("MIN")) return MpsKeyword::kMin;
+  if (word.equals("ROWS")) return MpsKeyword::kRows;
+  if (word.equals("COLUMNS")) return MpsKeyword::kCols;
+  if (word.equals("RHS")) return MpsKeyword::kRhs;
+  if (word.equals("RANGES")) return MpsKeyword::kRanges;
+  if (word.equals("BOUNDS")) return MpsKeyword::kBounds;
+  if (word.equals("ENDATA")) return MpsKeyword::kEnd;
+  static const char* const other_keywords[] = {
+      "QSECTION", "QMATRIX", "QUADOBJ", "QCMATRIX", "CSECTION",
+      "DELAYEDROWS", "MODELCUTS", "INDICATORS", "SETS", "SOS",
+      "GENCONS", "PWLOBJ", "PWLNAM", "PWLCON"};
+  for (const char* keyword : other_keywords)
+    if (word.equals(keyword)) return MpsKeyword::kOther;
+  return MpsKeyword::kNone;
+}
+
+// A line whose first word is a keyword
+struct MpsHeader {
+  const char* begin;
+  const char* end;
+  MpsKeyword keyword;
+  // Whether the keyword is preceded by whitespace other than spaces,
+  // which HMpsFF::checkFirstWord() does not skip in some sections
+  bool other_leading_space;
+};
+
+// Value of names that are not in an MpsNameTable. Row names have
+// values -1 for the objective and -2 for free rows
+const HighsInt kMpsNameNotFound = -3;
+
+// Hash table from names to indices, with the names referring to the
+// mapped file
+class MpsNameTable {
+ public:
+  void reserve(size_t num_names) {
+    size_t capacity = 16;
+    while (capacity < 2 * num_names) capacity *= 2;
+    if (capacity > slots_.size()) rehash(capacity);
+  }
+
+  // Adds the name unless it is present, returning whether it was added
+  bool insert(const MpsToken& name, HighsHashHelpers::u64 hash,
+              HighsInt value) {
+    if (2 * (count_ + 1) > slots_.size()) rehash(2 * slots_.size());
+    size_t pos = slotIndex(hash);
+    while (slots_[pos].name.data != nullptr) {
+      if (slots_[pos].hash == hash && slots_[pos].name == name) return false;
+      pos = (pos + 1) & mask_;
+    }
+    slots_[pos] = Slot{name, hash, value};
+    count_++;
+    return true;
+  }
+
+  HighsInt find(const MpsToken& name, HighsHashHelpers::u64 hash) const {
+    if (slots_.empty()) return kMpsNameNotFound;
+    size_t pos = slotIndex(hash);
+    while (slots_[pos].name.data != nullptr) {
+      if (slots_[pos].hash == hash && slots_[pos].name == name)
+        return slots_[pos].value;
+      pos = (pos + 1) & mask_;
+    }
+    return kMpsNameNotFound;
+  }
+
+ private:
+  struct Slot {
+    MpsToken name;
+    HighsHashHelpers::u64 hash;
+    HighsInt value;
+  };
+
+  size_t slotIndex(HighsHashHelpers::u64 hash) const {
+    return size_t((hash * HighsHashHelpers::u64{0x9e3779b97f4a7c15}) >>
+                  shift_);
+  }
+
+  void rehash(size_t capacity) {
+    if (capacity < 16) capacity = 16;
+    std::vector<Slot> slots(capacity, Slot{MpsToken{nullptr, 0}, 0, 0});
+    std::swap(slots, slots_);
+    mask_ = capacity - 1;
+    shift_ = 64;
+    for (size_t c = capacity; c > 1; c /= 2) shift_--;
+    count_ = 0;
+    for (const Slot& slot : slots)
+      if (slot.name.data != nullptr) insert(slot.name, slot.hash, slot.value);
+  }
+
+  std::vector<Slot> slots_;
+  size_t mask_ = 0;
+  int shift_ = 64;
+  size_t count_ = 0;
+};
+
+// Splits [begin, end) into chunks of about chunk_size bytes of whole
+// lines, returning the boundaries of the chunks
+std::vector<const char*> splitIntoChunks(const char* begin, const char* end,
+                                         const size_t chunk_size) {
+  std::vector<const char*> bounds{begin};
+  const char* chunk_begin = begin;
+  while (size_t(end - chunk_begin) > chunk_size) {
+    const char* eol = static_cast<const char*>(std::memchr(
+        chunk_begin + chunk_size, '\n', end - (chunk_begin + chunk_size)));
+    if (eol == nullptr || eol + 1 >= end) break;
+    chunk_begin = eol + 1;
+    bounds.push_back(chunk_begin);
+  }
+  bounds.push_back(end);
+  return bounds;
+}
+
+// Calls f(chunk) for each chunk, in parallel if the global scheduler
+// has been initialized with more than one thread. The chunks and
+// their results do not depend on the number of threads
+template <typename F>
+void forEachChunk(const HighsInt num_chunks, F&& f) {
+  if (num_chunks > 1 && HighsTaskExecutor::getThisWorkerDeque() != nullptr &&
+      highs::parallel::num_threads() > 1) {
+    highs::parallel::for_each(
+        0, num_chunks,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt chunk = start; chunk < end; chunk++) f(chunk);
+        },
+        1);
+  } else {
+    for (HighsInt chunk = 0; chunk < num_chunks; chunk++) f(chunk);
+  }
+}
+
+// Calls f(chunk, begin, end) for the chunks with the given boundaries
+template <typename F>
+void forEachChunk(const std::vector<const char*>& bounds, F&& f) {
+  forEachChunk(bounds.size() - 1, [&](HighsInt chunk) {
+    f(chunk, bounds[chunk], bounds[chunk + 1]);
+  });
+}
+
+bool isCommentOrEmpty(const char* begin, const char* end) {
+  if (begin < end && *begin == '*') return true;
+  for (const char* p = begin; p < end; p++)
+    if (!isMpsSpace(*p)) return false;
+  return true;
+}
+
+// Data read from one chunk of the COLUMNS section, as segments of
+// consecutive lines for the same column
+struct ColumnsChunk {
+  std::vector<MpsToken> name;
+  std::vector<HighsHashHelpers::u64> hash;
+  // Number of markers in the chunk before the segment
+  std::vector<HighsInt> num_marker;
+  // Start of the segment's entries in index and value
+  std::vector<HighsInt> start;
+  std::vector<double> cost;
+  std::vector<HighsInt> num_cost;
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  // Whether each marker is INTORG, rather than INTEND
+  std::vector<bool> marker_is_intorg;
+  // Index of each segment's column, and position of its entries in
+  // the matrix
+  std::vector<HighsInt> col;
+  std::vector<HighsInt> destination;
+  bool ok = true;
+};
+
+struct RowValue {
+  HighsInt row;
+  double value;
+};
+
+enum class BoundType : uint8_t {
+  kUp,
+  kLo,
+  kFx,
+  kMi,
+  kPl,
+  kBv,
+  kLi,
+  kUi,
+  kFr,
+  kSi,
+  kSc
+};
+
+struct BoundEntry {
+  BoundType type;
+  HighsInt col;
+  double value;
+};
+
+bool boundType(const MpsToken& word, BoundType& type) {
+  if (word.size != 2) return false;
+  static const char* const names[] = {"UP", "LO", "FX", "MI", "PL", "BV",
+                                      "LI", "UI", "FR", "SI", "SC"};
+  for (uint8_t k = 0; k < 11; k++) {
+    if (word.equals(names[k])) {
+      type = BoundType(k);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+bool HMpsFF::parseMapped(const HighsLogOptions& log_options,
+                         const std::string& filename,
+                         FreeFormatParserReturnCode& result) {
+  HighsMappedFile file;
+  if (!file.open(filename)) return false;
+  const char* file_begin = file.data();
+  const char* file_end = file_begin + file.size();
+  // Leave compressed files to the stream parser
+  if (file.size() >= 2 && (unsigned char)file_begin[0] == 0x1f &&
+      (unsigned char)file_begin[1] == 0x8b)
+    return false;
+  highsLogDev(log_options, HighsLogType::kInfo,
+              "readMPS: Trying to read mapped file %s\n", filename.c_str());
+  start_time = getWallTime();
+  auto timedOut = [&]() {
+    return time_limit > 0 && getWallTime() - start_time > time_limit;
+  };
+  const size_t chunk_size = std::max(mapped_chunk_size, size_t{1});
+
+  // Find the section headers
+  std::vector<MpsHeader> headers;
+  {
+    std::vector<const char*> bounds =
+        splitIntoChunks(file_begin, file_end, chunk_size);
+    const HighsInt num_chunk = bounds.size() - 1;
+    std::vector<std::vector<MpsHeader>> chunk_headers(num_chunk);
+    forEachChunk(num_chunk, [&](HighsInt chunk) {
+      forEachLine(bounds[chunk], bounds[chunk + 1],
+                  [&](const char* begin, const char* end) {
+                    if (begin == end || *begin == '*') return true;
+                    const char* word = begin;
+                    bool other_leading_space = false;
+                    while (word < end && isMpsSpace(*word)) {
+                      if (*word != ' ') other_leading_space = true;
+                      word++;
+                    }
+                    const char* word_end = word;
+                    while (word_end < end && !isMpsSpace(*word_end))
+                      word_end++;
+                    MpsKeyword keyword = mpsKeyword(
+                        MpsToken{word, HighsInt(word_end - word)});
+                    if (keyword != MpsKeyword::kNone)
+                      chunk_headers[chunk].push_back(
+                          MpsHeader{begin, end, keyword, other_leading_space});
+                    return true;
+                  });
+    });
+    for (auto& chunk : chunk_headers) {
+      for (const MpsHeader& header : chunk) {
+        headers.push_back(header);
+        if (header.keyword == MpsKeyword::kEnd) break;
+      }
+      if (!headers.empty() && headers.back().keyword == MpsKeyword::kEnd)
+        break;
+    }
+  }
+  if (headers.empty() || headers.back().keyword != MpsKeyword::kEnd)
+    return false;
+
+  // Identify the sections, which must be in the order NAME, OBJSENSE,
+  // ROWS, COLUMNS, RHS, RANGES and BOUNDS, with only ROWS and COLUMNS
+  // required
+  std::string name = "";
+  ObjSense sense = ObjSense::kMinimize;
+  MpsToken tokens[kMaxLineTokens];
+  const char* section_begin[int(MpsKeyword::kOther)] = {};
+  const char* section_end[int(MpsKeyword::kOther)] = {};
+  MpsKeyword section = MpsKeyword::kNone;
+  for (const MpsHeader& header : headers) {
+    const MpsKeyword keyword = header.keyword;
+    // Within the RHS section, the RHS keyword starts data lines
+    if (section == MpsKeyword::kRhs && keyword == MpsKeyword::kRhs) continue;
+    if (header.other_leading_space) return false;
+    const HighsInt num_tokens = tokenizeLine(header.begin, header.end, tokens);
+    if (section == MpsKeyword::kNone || section == MpsKeyword::kObjsense) {
+      if (keyword == MpsKeyword::kName) {
+        // The NAME line only defines the name if it precedes OBJSENSE
+        if (section == MpsKeyword::kObjsense) return false;
+        if (num_tokens > 1) name = tokens[1].str();
+        continue;
+      } else if (keyword == MpsKeyword::kObjsense) {
+        if (section == MpsKeyword::kNone && num_tokens > 1) {
+          if (tokens[1].equals("MAX")) sense = ObjSense::kMaximize;
+          if (tokens[1].equals("MIN")) sense = ObjSense::kMinimize;
+        }
+        section = MpsKeyword::kObjsense;
+        continue;
+      } else if (keyword == MpsKeyword::kMax ||
+                 keyword == MpsKeyword::kMin) {
+        // MAX and MIN lines are ignored outside the OBJSENSE section
+        if (section == MpsKeyword::kObjsense)
+          sense = keyword == MpsKeyword::kMax ? ObjSense::kMaximize
+                                              : ObjSense::kMinimize;
+        continue;
+      } else if (keyword != MpsKeyword::kRows) {
+        return false;
+      }
+    } else {
+      // Only the sections that follow the current section are allowed
+      bool allowed = false;
+      switch (keyword) {
+        case MpsKeyword::kCols:
+          allowed = section == MpsKeyword::kRows;
+          break;
+        case MpsKeyword::kRhs:
+          allowed = section == MpsKeyword::kCols;
+          break;
+        case MpsKeyword::kRanges:
+          allowed = section == MpsKeyword::kCols || section == MpsKeyword::kRhs;
+          break;
+        case MpsKeyword::kBounds:
+          allowed = section == MpsKeyword::kCols ||
+                    section == MpsKeyword::kRhs ||
+                    section == MpsKeyword::kRanges;
+          break;
+        case MpsKeyword::kEnd:
+          allowed = section != MpsKeyword::kRows;
+          break;
+        default:
+          break;
+      }
+      if (!allowed) return false;
+      section_end[int(section)] = header.begin;
+    }
+    if (keyword == MpsKeyword::kEnd) break;
+    section = keyword;
+    section_begin[int(section)] =
+        header.end < file_end ? header.end + 1 : file_end;
+  }
+  if (section_begin[int(MpsKeyword::kCols)] == nullptr) return false;
+  if (timedOut()) {
+    result = FreeFormatParserReturnCode::kTimeout;
+    return true;
+  }
+
+  auto sectionChunks = [&](const MpsKeyword section) {
+    return splitIntoChunks(section_begin[int(section)],
+                           section_end[int(section)], chunk_size);
+  };
+  std::vector<const char*> bounds;
+
+  // ROWS
+  struct RowEntry {
+    char type;
+    MpsToken name;
+    HighsHashHelpers::u64 hash;
+  };
+  bounds = sectionChunks(MpsKeyword::kRows);
+  std::vector<std::vector<RowEntry>> chunk_rows(bounds.size() - 1);
+  std::vector<char> chunk_ok(chunk_rows.size(), 1);
+  forEachChunk(
+      bounds,
+      [&](HighsInt chunk, const char* begin, const char* end) {
+        MpsToken line_tokens[kMaxLineTokens];
+        chunk_ok[chunk] = forEachLine(
+            begin, end, [&](const char* line_begin, const char* line_end) {
+              if (isCommentOrEmpty(line_begin, line_end)) return true;
+              // Rows lines are not trimmed, so only spaces can precede
+              // the row type
+              for (const char* p = line_begin; p < line_end && isMpsSpace(*p);
+                   p++)
+                if (*p != ' ') return false;
+              if (tokenizeLine(line_begin, line_end, line_tokens) != 2 ||
+                  line_tokens[0].size != 1)
+                return false;
+              const char type = line_tokens[0].data[0];
+              if (type != 'N' && type != 'E' && type != 'L' && type != 'G')
+                return false;
+              chunk_rows[chunk].push_back(
+                  RowEntry{type, line_tokens[1], line_tokens[1].hash()});
+              return true;
+            });
+      });
+  size_t num_row_entry = 0;
+  for (size_t chunk = 0; chunk < chunk_rows.size(); chunk++) {
+    if (!chunk_ok[chunk]) return false;
+    num_row_entry += chunk_rows[chunk].size();
+  }
+  MpsNameTable rows;
+  rows.reserve(num_row_entry);
+  HighsInt mapped_num_row = 0;
+  HighsInt mapped_cost_row_location = -1;
+  MpsToken objective_token{nullptr, 0};
+  std::vector<MpsToken> row_name_token;
+  std::vector<Boundtype> mapped_row_type;
+  std::vector<double> mapped_row_lower;
+  std::vector<double> mapped_row_upper;
+  row_name_token.reserve(num_row_entry);
+  mapped_row_type.reserve(num_row_entry);
+  mapped_row_lower.reserve(num_row_entry);
+  mapped_row_upper.reserve(num_row_entry);
+  for (const auto& chunk : chunk_rows) {
+    for (const RowEntry& entry : chunk) {
+      if (entry.type == 'N') {
+        if (objective_token.data == nullptr) {
+          // The first N row is the objective, and any others are free
+          // rows that are ignored
+          objective_token = entry.name;
+          mapped_cost_row_location = mapped_num_row;
+          if (!rows.insert(entry.name, entry.hash, -1)) return false;
+        } else {
+          rows.insert(entry.name, entry.hash, -2);
+        }
+        continue;
+      }
+      if (!rows.insert(entry.name, entry.hash, mapped_num_row)) return false;
+      row_name_token.push_back(entry.name);
+      if (entry.type == 'G') {
+        mapped_row_lower.push_back(0.0);
+        mapped_row_upper.push_back(kHighsInf);
+        mapped_row_type.push_back(Boundtype::kGe);
+      } else if (entry.type == 'E') {
+        mapped_row_lower.push_back(0.0);
+        mapped_row_upper.push_back(0.0);
+        mapped_row_type.push_back(Boundtype::kEq);
+      } else {
+        mapped_row_lower.push_back(-kHighsInf);
+        mapped_row_upper.push_back(0.0);
+        mapped_row_type.push_back(Boundtype::kLe);
+      }
+      mapped_num_row++;
+    }
+  }
+  // Without an objective row, parse() reports a warning
+  if (objective_token.data == nullptr) return false;
+  chunk_rows.clear();
+  if (timedOut()) {
+    result = FreeFormatParserReturnCode::kTimeout;
+    return true;
+  }
+
+  // COLUMNS
+  bounds = sectionChunks(MpsKeyword::kCols);
+  std::vector<ColumnsChunk> chunk_cols(bounds.size() - 1);
+  forEachChunk(
+      bounds,
+      [&](HighsInt chunk, const char* begin, const char* end) {
+        ColumnsChunk& data = chunk_cols[chunk];
+        MpsToken line_tokens[kMaxLineTokens];
+        data.ok = forEachLine(begin, end, [&](const char* line_begin,
+                                              const char* line_end) {
+          if (isCommentOrEmpty(line_begin, line_end)) return true;
+          const HighsInt num_tokens =
+              tokenizeLine(line_begin, line_end, line_tokens);
+          if (num_tokens >= 2 && line_tokens[1].equals("'MARKER'")) {
+            if (num_tokens < 3) return false;
+            if (line_tokens[2].equals("'INTORG'"))
+              data.marker_is_intorg.push_back(true);
+            else if (line_tokens[2].equals("'INTEND'"))
+              data.marker_is_intorg.push_back(false);
+            else
+              return false;
+            return true;
+          }
+          if (num_tokens != 3 && num_tokens != 5) return false;
+          if (data.name.empty() || data.name.back() != line_tokens[0]) {
+            data.name.push_back(line_tokens[0]);
+            data.hash.push_back(line_tokens[0].hash());
+            data.num_marker.push_back(data.marker_is_intorg.size());
+            data.start.push_back(data.index.size());
+            data.cost.push_back(0);
+            data.num_cost.push_back(0);
+          }
+          for (HighsInt iToken = 1; iToken < num_tokens; iToken += 2) {
+            const HighsInt row =
+                rows.find(line_tokens[iToken], line_tokens[iToken].hash());
+            if (row == kMpsNameNotFound) return false;
+            const double value = mpsValue(line_tokens[iToken + 1]);
+            if (!value) continue;
+            if (row >= 0) {
+              data.index.push_back(row);
+              data.value.push_back(value);
+            } else if (row == -1) {
+              if (data.num_cost.back()) return false;
+              data.cost.back() = value;
+              data.num_cost.back() = 1;
+            }
+          }
+          return true;
+        });
+        data.start.push_back(data.index.size());
+      });
+  // Combine the segments in file order, checking the integrality
+  // markers and identifying the columns
+  HighsInt mapped_num_col = 0;
+  size_t num_segment = 0;
+  for (const ColumnsChunk& data : chunk_cols) {
+    if (!data.ok) return false;
+    num_segment += data.name.size();
+  }
+  MpsNameTable cols;
+  cols.reserve(num_segment);
+  std::vector<MpsToken> col_name_token;
+  std::vector<HighsVarType> mapped_col_integrality;
+  std::vector<HighsInt> col_count;
+  std::vector<double> col_cost_value;
+  std::vector<HighsInt> col_num_cost;
+  bool integral_cols = false;
+  for (ColumnsChunk& data : chunk_cols) {
+    const bool chunk_integral_cols = integral_cols;
+    for (const bool is_intorg : data.marker_is_intorg) {
+      if (is_intorg == integral_cols) return false;
+      integral_cols = !integral_cols;
+    }
+    const HighsInt num_chunk_segment = data.name.size();
+    data.col.resize(num_chunk_segment);
+    for (HighsInt iSeg = 0; iSeg < num_chunk_segment; iSeg++) {
+      HighsInt col;
+      if (iSeg == 0 && mapped_num_col > 0 &&
+          col_name_token.back() == data.name[iSeg]) {
+        // The column continues from the previous chunk
+        col = mapped_num_col - 1;
+      } else {
+        col = mapped_num_col++;
+        if (!cols.insert(data.name[iSeg], data.hash[iSeg], col)) return false;
+        col_name_token.push_back(data.name[iSeg]);
+        const bool integral =
+            chunk_integral_cols != bool(data.num_marker[iSeg] & 1);
+        mapped_col_integrality.push_back(integral ? HighsVarType::kInteger
+                                                  : HighsVarType::kContinuous);
+        col_count.push_back(0);
+        col_cost_value.push_back(0);
+        col_num_cost.push_back(0);
+      }
+      data.col[iSeg] = col;
+      col_count[col] += data.start[iSeg + 1] - data.start[iSeg];
+      if (data.num_cost[iSeg]) {
+        if (col_num_cost[col]) return false;
+        col_num_cost[col] = 1;
+        col_cost_value[col] = data.cost[iSeg];
+      }
+    }
+  }
+  // Assemble the matrix
+  std::vector<HighsInt> mapped_a_start(mapped_num_col + 1);
+  mapped_a_start[0] = 0;
+  for (HighsInt iCol = 0; iCol < mapped_num_col; iCol++)
+    mapped_a_start[iCol + 1] = mapped_a_start[iCol] + col_count[iCol];
+  const HighsInt mapped_num_nz = mapped_a_start[mapped_num_col];
+  for (HighsInt iCol = 0; iCol < mapped_num_col; iCol++)
+    col_count[iCol] = mapped_a_start[iCol];
+  for (ColumnsChunk& data : chunk_cols) {
+    const HighsInt num_chunk_segment = data.name.size();
+    data.destination.resize(num_chunk_segment);
+    for (HighsInt iSeg = 0; iSeg < num_chunk_segment; iSeg++) {
+      const HighsInt col = data.col[iSeg];
+      data.destination[iSeg] = col_count[col];
+      col_count[col] += data.start[iSeg + 1] - data.start[iSeg];
+    }
+  }
+  std::vector<HighsInt> mapped_a_index(mapped_num_nz);
+  std::vector<double> mapped_a_value(mapped_num_nz);
+  forEachChunk(chunk_cols.size(), [&](HighsInt chunk) {
+    ColumnsChunk& data = chunk_cols[chunk];
+    const HighsInt num_chunk_segment = data.name.size();
+    for (HighsInt iSeg = 0; iSeg < num_chunk_segment; iSeg++) {
+      const HighsInt from = data.start[iSeg];
+      const HighsInt count = data.start[iSeg + 1] - from;
+      std::copy(data.index.begin() + from, data.index.begin() + from + count,
+                mapped_a_index.begin() + data.destination[iSeg]);
+      std::copy(data.value.begin() + from, data.value.begin() + from + count,
+                mapped_a_value.begin() + data.destination[iSeg]);
+    }
+    std::vector<HighsInt>().swap(data.index);
+    std::vector<double>().swap(data.value);
+  });
+  chunk_cols.clear();
+  // parse() warns about duplicate entries in a column, so check for
+  // them, avoiding sorting columns whose indices are increasing
+  {
+    std::vector<char> column_block_ok;
+    const HighsInt kColumnBlockSize = 4096;
+    const HighsInt num_block =
+        (mapped_num_col + kColumnBlockSize - 1) / kColumnBlockSize;
+    column_block_ok.assign(num_block, 1);
+    forEachChunk(num_block, [&](HighsInt block) {
+      std::vector<HighsInt> sorted;
+      const HighsInt block_end =
+          std::min(mapped_num_col, (block + 1) * kColumnBlockSize);
+      for (HighsInt iCol = block * kColumnBlockSize; iCol < block_end;
+           iCol++) {
+        const HighsInt from = mapped_a_start[iCol];
+        const HighsInt to = mapped_a_start[iCol + 1];
+        bool increasing = true;
+        for (HighsInt iEl = from + 1; iEl < to; iEl++) {
+          if (mapped_a_index[iEl] <= mapped_a_index[iEl - 1]) {
+            increasing = false;
+            break;
+          }
+        }
+        if (increasing) continue;
+        sorted.assign(mapped_a_index.begin() + from,
+                      mapped_a_index.begin() + to);
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+          column_block_ok[block] = 0;
+          return;
+        }
+      }
+    });
+    for (const char ok : column_block_ok)
+      if (!ok) return false;
+  }
+  if (timedOut()) {
+    result = FreeFormatParserReturnCode::kTimeout;
+    return true;
+  }
+
+  // RHS
+  double mapped_obj_offset = 0;
+  if (section_begin[int(MpsKeyword::kRhs)] != nullptr) {
+    bounds = sectionChunks(MpsKeyword::kRhs);
+    std::vector<std::vector<RowValue>> chunk_rhs(bounds.size() - 1);
+    chunk_ok.assign(chunk_rhs.size(), 1);
+    forEachChunk(
+        bounds,
+        [&](HighsInt chunk, const char* begin, const char* end) {
+          MpsToken line_tokens[kMaxLineTokens];
+          chunk_ok[chunk] = forEachLine(begin, end, [&](const char* line_begin,
+                                                        const char* line_end) {
+            if (isCommentOrEmpty(line_begin, line_end)) return true;
+            const HighsInt num_tokens =
+                tokenizeLine(line_begin, line_end, line_tokens);
+            // The RHS vector name is optional, so the first word is a
+            // row name if it is not RHS and is in the ROWS section
+            HighsInt first = 1;
+            if (num_tokens > 0 && !line_tokens[0].equals("RHS") &&
+                rows.find(line_tokens[0], line_tokens[0].hash()) !=
+                    kMpsNameNotFound)
+              first = 0;
+            if (num_tokens - first != 2 && num_tokens - first != 4)
+              return false;
+            for (HighsInt iToken = first; iToken < num_tokens; iToken += 2) {
+              const HighsInt row =
+                  rows.find(line_tokens[iToken], line_tokens[iToken].hash());
+              if (row == kMpsNameNotFound || row == -2) return false;
+              chunk_rhs[chunk].push_back(
+                  RowValue{row, mpsValue(line_tokens[iToken + 1])});
+            }
+            return true;
+          });
+        });
+    std::vector<bool> has_entry(mapped_num_row, false);
+    bool has_obj_entry = false;
+    for (size_t chunk = 0; chunk < chunk_rhs.size(); chunk++) {
+      if (!chunk_ok[chunk]) return false;
+      for (const RowValue& entry : chunk_rhs[chunk]) {
+        const HighsInt row = entry.row;
+        if (row == -1) {
+          if (has_obj_entry) return false;
+          has_obj_entry = true;
+          mapped_obj_offset = -entry.value;
+          continue;
+        }
+        if (has_entry[row]) return false;
+        has_entry[row] = true;
+        if (mapped_row_type[row] == Boundtype::kEq ||
+            mapped_row_type[row] == Boundtype::kLe)
+          mapped_row_upper[row] = entry.value;
+        if (mapped_row_type[row] == Boundtype::kEq ||
+            mapped_row_type[row] == Boundtype::kGe)
+          mapped_row_lower[row] = entry.value;
+      }
+    }
+  }
+
+  // RANGES
+  if (section_begin[int(MpsKeyword::kRanges)] != nullptr) {
+    bounds = sectionChunks(MpsKeyword::kRanges);
+    std::vector<std::vector<RowValue>> chunk_ranges(bounds.size() - 1);
+    chunk_ok.assign(chunk_ranges.size(), 1);
+    forEachChunk(
+        bounds,
+        [&](HighsInt chunk, const char* begin, const char* end) {
+          MpsToken line_tokens[kMaxLineTokens];
+          chunk_ok[chunk] = forEachLine(begin, end, [&](const char* line_begin,
+                                                        const char* line_end) {
+            if (isCommentOrEmpty(line_begin, line_end)) return true;
+            const HighsInt num_tokens =
+                tokenizeLine(line_begin, line_end, line_tokens);
+            if (num_tokens != 3 && num_tokens != 5) return false;
+            for (HighsInt iToken = 1; iToken < num_tokens; iToken += 2) {
+              const HighsInt row =
+                  rows.find(line_tokens[iToken], line_tokens[iToken].hash());
+              if (row == kMpsNameNotFound || row < 0) return false;
+              chunk_ranges[chunk].push_back(
+                  RowValue{row, mpsValue(line_tokens[iToken + 1])});
+            }
+            return true;
+          });
+        });
+    std::vector<bool> has_entry(mapped_num_row, false);
+    for (size_t chunk = 0; chunk < chunk_ranges.size(); chunk++) {
+      if (!chunk_ok[chunk]) return false;
+      for (const RowValue& entry : chunk_ranges[chunk]) {
+        const HighsInt row = entry.row;
+        const double val = entry.value;
+        if (has_entry[row]) return false;
+        has_entry[row] = true;
+        if ((mapped_row_type[row] == Boundtype::kEq && val < 0) ||
+            mapped_row_type[row] == Boundtype::kLe) {
+          mapped_row_lower[row] = mapped_row_upper[row] - fabs(val);
+        } else if ((mapped_row_type[row] == Boundtype::kEq && val > 0) ||
+                   mapped_row_type[row] == Boundtype::kGe) {
+          mapped_row_upper[row] = mapped_row_lower[row] + fabs(val);
+        }
+      }
+    }
+  }
+
+  // BOUNDS
+  std::vector<double> mapped_col_lower(mapped_num_col, 0.0);
+  std::vector<double> mapped_col_upper(mapped_num_col, kHighsInf);
+  std::vector<bool> mapped_col_binary(mapped_num_col, false);
+  if (kintegerVarsInColumnsAreBinary)
+    for (HighsInt iCol = 0; iCol < mapped_num_col; iCol++)
+      mapped_col_binary[iCol] =
+          mapped_col_integrality[iCol] == HighsVarType::kInteger;
+  HighsInt num_mi = 0;
+  HighsInt num_pl = 0;
+  HighsInt num_bv = 0;
+  HighsInt num_li = 0;
+  HighsInt num_ui = 0;
+  HighsInt num_si = 0;
+  HighsInt num_sc = 0;
+  if (section_begin[int(MpsKeyword::kBounds)] != nullptr) {
+    bounds = sectionChunks(MpsKeyword::kBounds);
+    std::vector<std::vector<BoundEntry>> chunk_bounds(bounds.size() - 1);
+    chunk_ok.assign(chunk_bounds.size(), 1);
+    forEachChunk(
+        bounds,
+        [&](HighsInt chunk, const char* begin, const char* end) {
+          MpsToken line_tokens[kMaxLineTokens];
+          chunk_ok[chunk] = forEachLine(begin, end, [&](const char* line_begin,
+                                                        const char* line_end) {
+            if (isCommentOrEmpty(line_begin, line_end)) return true;
+            const HighsInt num_tokens =
+                tokenizeLine(line_begin, line_end, line_tokens);
+            BoundType type;
+            if (!boundType(line_tokens[0], type) || num_tokens < 2)
+              return false;
+            // The bound vector name is optional, so the second word is
+            // the column name if it is in the COLUMNS section
+            HighsInt marker = 1;
+            HighsInt col = cols.find(line_tokens[1], line_tokens[1].hash());
+            if (col == kMpsNameNotFound) {
+              if (num_tokens < 3) return false;
+              marker = 2;
+              col = cols.find(line_tokens[2], line_tokens[2].hash());
+              if (col == kMpsNameNotFound) return false;
+            }
+            double value = 0;
+            if (type != BoundType::kMi && type != BoundType::kPl &&
+                type != BoundType::kBv && type != BoundType::kFr) {
+              if (num_tokens <= marker + 1) return false;
+              value = mpsValue(line_tokens[marker + 1]);
+            }
+            chunk_bounds[chunk].push_back(BoundEntry{type, col, value});
+            return true;
+          });
+        });
+    std::vector<bool> has_lower(mapped_num_col, false);
+    std::vector<bool> has_upper(mapped_num_col, false);
+    for (size_t chunk = 0; chunk < chunk_bounds.size(); chunk++) {
+      if (!chunk_ok[chunk]) return false;
+      for (const BoundEntry& entry : chunk_bounds[chunk]) {
+        const HighsInt col = entry.col;
+        const double value = entry.value;
+        bool is_lb = false;
+        bool is_ub = false;
+        bool is_integral = false;
+        bool is_semi = false;
+        bool is_defaultbound = false;
+        switch (entry.type) {
+          case BoundType::kUp:
+            is_ub = true;
+            break;
+          case BoundType::kLo:
+            is_lb = true;
+            break;
+          case BoundType::kFx:
+            is_lb = true;
+            is_ub = true;
+            break;
+          case BoundType::kMi:
+            is_lb = true;
+            is_defaultbound = true;
+            num_mi++;
+            break;
+          case BoundType::kPl:
+            is_ub = true;
+            is_defaultbound = true;
+            num_pl++;
+            break;
+          case BoundType::kBv:
+            is_lb = true;
+            is_ub = true;
+            is_integral = true;
+            is_defaultbound = true;
+            num_bv++;
+            break;
+          case BoundType::kLi:
+            is_lb = true;
+            is_integral = true;
+            num_li++;
+            break;
+          case BoundType::kUi:
+            is_ub = true;
+            is_integral = true;
+            num_ui++;
+            break;
+          case BoundType::kFr:
+            is_lb = true;
+            is_ub = true;
+            is_defaultbound = true;
+            break;
+          case BoundType::kSi:
+            is_ub = true;
+            is_integral = true;
+            is_semi = true;
+            num_si++;
+            break;
+          case BoundType::kSc:
+            is_ub = true;
+            is_semi = true;
+            num_sc++;
+            break;
+        }
+        if ((is_lb && has_lower[col]) || (is_ub && has_upper[col]))
+          return false;
+        if (is_defaultbound) {
+          if (is_integral) {
+            mapped_col_integrality[col] = HighsVarType::kInteger;
+            mapped_col_binary[col] = true;
+            mapped_col_upper[col] = 1.0;
+          } else {
+            mapped_col_binary[col] = false;
+            if (is_lb) mapped_col_lower[col] = -kHighsInf;
+            if (is_ub) mapped_col_upper[col] = kHighsInf;
+          }
+          if (is_lb) has_lower[col] = true;
+          if (is_ub) has_upper[col] = true;
+          continue;
+        }
+        if (is_integral) {
+          // parse() warns about non-integer bounds
+          HighsInt i_value = static_cast<HighsInt>(value);
+          double dl = value - i_value;
+          if (dl) return false;
+          mapped_col_integrality[col] = is_semi ? HighsVarType::kSemiInteger
+                                                : HighsVarType::kInteger;
+        } else if (is_semi) {
+          mapped_col_integrality[col] = HighsVarType::kSemiContinuous;
+        }
+        if (is_lb) {
+          mapped_col_lower[col] = value;
+          has_lower[col] = true;
+        }
+        if (is_ub) {
+          mapped_col_upper[col] = value;
+          has_upper[col] = true;
+        }
+        mapped_col_binary[col] = false;
+      }
+    }
+  }
+  // Assign bounds to columns that remain binary by default
+  for (HighsInt iCol = 0; iCol < mapped_num_col; iCol++) {
+    if (mapped_col_binary[iCol]) {
+      mapped_col_lower[iCol] = 0.0;
+      mapped_col_upper[iCol] = 1.0;
+    }
+  }
+  if (timedOut()) {
+    result = FreeFormatParserReturnCode::kTimeout;
+    return true;
+  }
+
+  // The file has been parsed successfully, so set up the data that
+  // parse() would have set up
+  if (num_mi)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of MI entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_mi);
+  if (num_pl)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of PL entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_pl);
+  if (num_bv)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of BV entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_bv);
+  if (num_li)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of LI entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_li);
+  if (num_ui)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of UI entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_ui);
+  if (num_si)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of SI entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_si);
+  if (num_sc)
+    highsLogUser(
+        log_options, HighsLogType::kInfo,
+        "Number of SC entries in BOUNDS section is %" HIGHSINT_FORMAT "\n",
+        num_sc);
+
+  num_row = mapped_num_row;
+  num_col = mapped_num_col;
+  num_nz = mapped_num_nz;
+  mps_name = name;
+  obj_sense = sense;
+  obj_offset = mapped_obj_offset;
+  objective_name = objective_token.str();
+  cost_row_location = mapped_cost_row_location;
+  has_duplicate_row_name_ = false;
+  has_duplicate_col_name_ = false;
+  row_type = std::move(mapped_row_type);
+  row_lower = std::move(mapped_row_lower);
+  row_upper = std::move(mapped_row_upper);
+  col_lower = std::move(mapped_col_lower);
+  col_upper = std::move(mapped_col_upper);
+  col_integrality = std::move(mapped_col_integrality);
+  col_binary = std::move(mapped_col_binary);
+  for (HighsInt iCol = 0; iCol < mapped_num_col; iCol++)
+    if (col_cost_value[iCol])
+      coeffobj.push_back(std::make_pair(iCol, col_cost_value[iCol]));
+  a_start = std::move(mapped_a_start);
+  a_index = std::move(mapped_a_index);
+  a_value = std::move(mapped_a_value);
+  a_matrix_assembled_ = true;
+  row_names.resize(mapped_num_row);
+  col_names.resize(mapped_num_col);
+  const HighsInt kNameBlockSize = 65536;
+  forEachChunk(
+      (mapped_num_row + kNameBlockSize - 1) / kNameBlockSize,
+      [&](HighsInt block) {
+        const HighsInt end =
+            std::min(mapped_num_row, (block + 1) * kNameBlockSize);
+        for (HighsInt iRow = block * kNameBlockSize; iRow < end; iRow++)
+          row_names[iRow] = row_name_token[iRow].str();
+      });
+  forEachChunk(
+      (mapped_num_col + kNameBlockSize - 1) / kNameBlockSize,
+      [&](HighsInt block) {
+        const HighsInt end =
+            std::min(mapped_num_col, (block + 1) * kNameBlockSize);
+        for (HighsInt iCol = block * kNameBlockSize; iCol < end; iCol++)
+          col_names[iCol] = col_name_token[iCol].str();
+      });
+  highsLogDev(log_options, HighsLogType::kInfo,
+              "readMPS: Read mapped file OK\n");
+  result = FreeFormatParserReturnCode::kSuccess;
+  return true;
+}
+
+}  // namespace free_format_parser
@@ -0,0 +1,87 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsMappedFile.h
+ * @brief Read-only view of a file's contents, mapped into memory where
+ * this is supported, and read into a buffer otherwise
+ */
+#ifndef IO_HIGHS_MAPPED_FILE_H_
+#define IO_HIGHS_MAPPED_FILE_H_
+
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+class HighsMappedFile {
+ public:
+  HighsMappedFile() = default;
+  HighsMappedFile(const HighsMappedFile&) = delete;
+  HighsMappedFile& operator=(const HighsMappedFile&) = delete;
+  ~HighsMappedFile() {
+#ifndef _WIN32
+    if (data_ != nullptr) munmap(const_cast<char*>(data_), size_);
+#endif
+  }
+
+  // Returns false if the file cannot be opened, or is empty
+  bool open(const std::string& filename, const bool sequential = false) {
+#ifdef _WIN32
+    std::ifstream f(filename, std::ios::in | std::ios::binary);
+    if (!f.is_open()) return false;
+    f.seekg(0, std::ios::end);
+    const std::streamoff size = f.tellg();
+    if (size <= 0) return false;
+    buffer_.resize(size_t(size));
+    f.seekg(0, std::ios::beg);
+    if (!f.read(buffer_.data(), size)) return false;
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+#else
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+      ::close(fd);
+      return false;
+    }
+    const size_t size = size_t(st.st_size);
+    void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) return false;
+    // Hint that the pages will be read in order, so should be read
+    // ahead aggressively
+    if (sequential) madvise(map, size, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(map);
+    size_ = size;
+    return true;
+#endif
+  }
+
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+#ifdef _WIN32
+  std::vector<char> buffer_;
+#endif
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+#endif
@@ -114,6 +114,7 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                                        options.dual_feasibility_tolerance);
 
   parameters.ipm_optimality_tol = options.ipm_optimality_tolerance;
+  parameters.kkt_solver = options.ipx_kkt_solver;
   parameters.start_crossover_tol = options.start_crossover_tolerance;
   parameters.analyse_basis_data =
       kHighsAnalysisLevelNlaData & options.highs_analysis_level;
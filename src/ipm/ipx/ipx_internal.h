@@ -32,6 +32,7 @@ struct Parameters : public ipx_parameters {
     ipm_drop_primal = 1e-9;
     ipm_drop_dual = 1e-9;
     kkt_tol = 0.3;
+    kkt_solver = 0;
     crash_basis = 1;
     dependency_tol = 1e-6;
     volume_tol = 2.0;
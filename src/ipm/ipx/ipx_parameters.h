@@ -29,6 +29,7 @@ struct ipx_parameters {
 
     /* Linear solver */
     double kkt_tol;
+    ipxint kkt_solver;
 
     /* Basis construction in IPM */
     ipxint crash_basis;
@@ -0,0 +1,165 @@
+#include "ipm/ipx/kkt_solver_chol.h"
+#include <cassert>
+#include <cmath>
+#include "ipm/ipx/conjugate_residuals.h"
+#include "parallel/HighsParallel.h"
+
+namespace ipx {
+
+KKTSolverChol::KKTSolverChol(const Control& control, const Model& model) :
+    control_(control), model_(model), normal_matrix_(model) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    W_.resize(n+m);
+    resscale_.resize(m);
+
+    for (Int j = 0; j < n; j++)
+        if (!model_.IsDenseColumn(j))
+            sparse_cols_.push_back(j);
+    AS_ = CopyColumns(model_.AI(), sparse_cols_);
+    ASt_ = Transpose(AS_);
+
+    // Pattern of the lower triangle of AS*AS' + I. Column i holds the
+    // diagonal entry and all rows r > i that share a column of AS with row i.
+    std::vector<Int> mark(m, -1);
+    lower_.resize(m, 0);
+    for (Int i = 0; i < m; i++) {
+        mark[i] = i;
+        lower_.push_back(i, 0.0);
+        for (Int p = ASt_.begin(i); p < ASt_.end(i); p++) {
+            Int j = ASt_.index(p);
+            for (Int q = AS_.begin(j); q < AS_.end(j); q++) {
+                Int r = AS_.index(q);
+                if (r > i && mark[r] != i) {
+                    mark[r] = i;
+                    lower_.push_back(r, 0.0);
+                }
+            }
+        }
+        lower_.add_column();
+    }
+    cholesky_.Analyse(lower_);
+}
+
+void KKTSolverChol::_Factorize(Iterate* pt, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    iter_ = 0;
+    factorized_ = false;
+
+    if (pt) {
+        const Vector& xl = pt->xl();
+        const Vector& xu = pt->xu();
+        const Vector& zl = pt->zl();
+        const Vector& zu = pt->zu();
+
+        // Build matrix W for AI*W*AI' as in KKTSolverDiag. For free variables
+        // set W[j] to 1.0/regval, where regval is the minimum of mu and the
+        // smallest nonzero diagonal entry of the (1,1) block.
+        double regval = pt->mu();
+        for (Int j = 0; j < n+m; j++) {
+            assert(xl[j] > 0.0);
+            assert(xu[j] > 0.0);
+            double g = zl[j]/xl[j] + zu[j]/xu[j];
+            assert(std::isfinite(g));
+            if (g != 0.0 && g < regval)
+                regval = g;
+            W_[j] = 1.0 / g;        // infinity if g is zero
+        }
+        for (Int j = 0; j < n+m; j++) {
+            if (std::isinf(W_[j]))
+                W_[j] = 1.0 / regval;
+            assert(std::isfinite(W_[j]));
+            assert(W_[j] > 0.0);
+        }
+    } else {
+        W_ = 1.0;
+    }
+
+    // Residual scaling factors for termination test of CR method.
+    for (Int i = 0; i < m; i++)
+        resscale_[i] = 1.0 / std::sqrt(W_[n+i]);
+
+    normal_matrix_.Prepare(&W_[0]);
+    BuildNormalMatrix();
+    Int dropped = cholesky_.Factorize(lower_);
+    if (dropped > 0)
+        control_.Debug(3) << " sparse Cholesky replaced " << dropped
+                          << " pivots\n";
+    factorized_ = true;
+}
+
+// Computes the entries of AS*W[S]*AS' + W[slack] column by column, each
+// column by scattering the columns of AS that have an entry in its row into a
+// dense work vector. Columns are split into blocks processed in parallel, each
+// with its own work vector.
+void KKTSolverChol::BuildNormalMatrix() {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    highs::parallel::for_each(0, m, [&](HighsInt start, HighsInt end) {
+        std::vector<double> work(m, 0.0);
+        for (Int i = start; i < end; i++) {
+            for (Int p = ASt_.begin(i); p < ASt_.end(i); p++) {
+                Int j = ASt_.index(p);
+                double wa = W_[sparse_cols_[j]] * ASt_.value(p);
+                for (Int q = AS_.begin(j); q < AS_.end(j); q++) {
+                    Int r = AS_.index(q);
+                    if (r >= i)
+                        work[r] += wa * AS_.value(q);
+                }
+            }
+            work[i] += W_[n+i];
+            for (Int p = lower_.begin(i); p < lower_.end(i); p++) {
+                Int r = lower_.index(p);
+                lower_.value(p) = work[r];
+                work[r] = 0.0;
+            }
+        }
+    }, 256);
+}
+
+// Solves the normal equations
+//
+//   (AI*W*AI') * y = -b + AI*W*a
+//
+// by the CR method with the Cholesky factorization as preconditioner and
+// recovers the solution to the KKT system as in KKTSolverDiag.
+void KKTSolverChol::_Solve(const Vector& a, const Vector& b, double tol,
+                           Vector& x, Vector& y, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    assert(factorized_);
+
+    // Compose right-hand side AI*W*a-b.
+    Vector rhs = -b;
+    for (Int j = 0; j < n+m; j++)
+        ScatterColumn(AI, j, W_[j]*a[j], rhs);
+
+    // Solve normal equations.
+    y = 0.0;
+    normal_matrix_.reset_time();
+    cholesky_.reset_time();
+    ConjugateResiduals cr(control_);
+    cr.Solve(normal_matrix_, cholesky_, rhs, tol, &resscale_[0], maxiter_, y);
+    info->errflag = cr.errflag();
+    info->kktiter1 += cr.iter();
+    info->time_cr1 += cr.time();
+    info->time_cr1_AAt += normal_matrix_.time();
+    info->time_cr1_pre += cholesky_.time();
+    iter_ += cr.iter();
+
+    // Recover solution to KKT system.
+    for (Int i = 0; i < m; i++)
+        x[n+i] = b[i];
+    for (Int j = 0; j < n; j++) {
+        double aty = DotColumn(AI, j, y);
+        x[j] = W_[j] * (a[j]-aty);
+        for (Int p = AI.begin(j); p < AI.end(j); p++) {
+            Int i = AI.index(p);
+            x[n+i] -= x[j] * AI.value(p);
+        }
+    }
+}
+
+}  // namespace ipx
@@ -0,0 +1,66 @@
+#ifndef IPX_KKT_SOLVER_CHOL_H_
+#define IPX_KKT_SOLVER_CHOL_H_
+
+#include <vector>
+#include "ipm/ipx/control.h"
+#include "ipm/ipx/kkt_solver.h"
+#include "ipm/ipx/model.h"
+#include "ipm/ipx/normal_matrix.h"
+#include "ipm/ipx/sparse_cholesky.h"
+
+namespace ipx {
+
+// KKTSolverChol implements a KKT solver that applies the Conjugate Residuals
+// method to the normal equations, preconditioned by a sparse Cholesky
+// factorization of
+//
+//   AS*W[S]*AS' + W[slack],
+//
+// where AS are the columns of A that are not classified dense. If there are no
+// dense columns, the preconditioner is the inverse of the normal matrix and CR
+// terminates after one or two iterations; otherwise the dense columns are
+// accounted for by the CR iterations. The symbolic factorization is computed
+// once in the constructor and reused in each call to Factorize().
+//
+// In the call to Factorize() @iterate is allowed to be NULL, in which case the
+// (1,1) block of the KKT matrix is the identity matrix.
+
+class KKTSolverChol : public KKTSolver {
+public:
+    KKTSolverChol(const Control& control, const Model& model);
+
+    Int maxiter() const { return maxiter_; }
+    void maxiter(Int new_maxiter) { maxiter_ = new_maxiter; }
+
+    // Returns the # nonzeros in the Cholesky factor.
+    Int factor_nnz() const { return cholesky_.nnz(); }
+
+private:
+    void _Factorize(Iterate* iterate, Info* info) override;
+    void _Solve(const Vector& a, const Vector& b, double tol,
+                Vector& x, Vector& y, Info* info) override;
+    Int _iter() const override { return iter_; };
+
+    // Computes the entries of lower_ from W_.
+    void BuildNormalMatrix();
+
+    const Control& control_;
+    const Model& model_;
+    NormalMatrix normal_matrix_;
+    SparseCholesky cholesky_;
+
+    std::vector<Int> sparse_cols_; // structural columns in the factorization
+    SparseMatrix AS_;              // AI[:,sparse_cols_]
+    SparseMatrix ASt_;             // transpose of AS_
+    SparseMatrix lower_;           // lower triangle of AS*W[S]*AS' + W[slack]
+
+    Vector W_;               // diagonal matrix in AI*W*AI'
+    Vector resscale_;        // residual scaling factors for CR termination test
+    bool factorized_{false}; // KKT matrix factorized?
+    Int maxiter_{-1};
+    Int iter_{0};            // # CR iterations since last Factorize()
+};
+
+}  // namespace ipx
+
+#endif  // IPX_KKT_SOLVER_CHOL_H_
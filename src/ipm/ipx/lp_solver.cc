@@ -6,6 +6,7 @@
 #include "ipm/ipx/crossover.h"
 #include "ipm/ipx/info.h"
 #include "ipm/ipx/kkt_solver_basis.h"
+#include "ipm/ipx/kkt_solver_chol.h"
 #include "ipm/ipx/kkt_solver_diag.h"
 #include "ipm/ipx/starting_basis.h"
 #include "ipm/ipx/utils.h"
@@ -397,7 +398,10 @@ void LpSolver::RunIPM() {
         ComputeStartingPoint(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
-        RunInitialIPM(ipm);
+        if (control_.kkt_solver() == 1)
+            RunCholeskyIPM(ipm);
+        else
+            RunInitialIPM(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
     }
@@ -512,6 +516,35 @@ void LpSolver::RunInitialIPM(IPM& ipm) {
     info_.time_ipm1 += timer.Elapsed();
 }
 
+void LpSolver::RunCholeskyIPM(IPM& ipm) {
+    Timer timer;
+    KKTSolverChol kkt(control_, model_);
+    std::stringstream h_logging_stream;
+    h_logging_stream << " Sparse Cholesky factor: " << kkt.factor_nnz()
+                     << " nonzeros, " << model_.num_dense_cols()
+                     << " dense columns\n";
+    control_.hLog(h_logging_stream);
+
+    // Run the IPM until it terminates or the normal equations become too
+    // ill-conditioned for the CR method to reach the required accuracy. As
+    // in RunInitialIPM(), the IPM then continues with basis preconditioning,
+    // which also fixes variables at their bounds and provides a starting
+    // basis for crossover.
+    ipm.maxiter(control_.ipm_maxiter());
+    ipm.Driver(&kkt, iterate_.get(), &info_);
+    switch (info_.status_ipm) {
+    case IPX_STATUS_optimal:
+    case IPX_STATUS_no_progress:
+        info_.status_ipm = IPX_STATUS_not_run;
+        break;
+    case IPX_STATUS_failed:
+        info_.status_ipm = IPX_STATUS_not_run;
+        info_.errflag = 0;
+        break;
+    }
+    info_.time_ipm1 += timer.Elapsed();
+}
+
 void LpSolver::BuildStartingBasis() {
     if (control_.stop_at_switch() < 0) {
         info_.status_ipm = IPX_STATUS_debug;
@@ -170,6 +170,7 @@ private:
     void MakeIPMStartingPointValid();
     void ComputeStartingPoint(IPM& ipm);
     void RunInitialIPM(IPM& ipm);
+    void RunCholeskyIPM(IPM& ipm);
     void BuildStartingBasis();
     void RunMainIPM(IPM& ipm);
     void BuildCrossoverStartingPoint();
@@ -0,0 +1,753 @@
+#include "ipm/ipx/sparse_cholesky.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include "ipm/ipx/timer.h"
+#include "ipm/ipx/utils.h"
+#include "parallel/HighsParallel.h"
+
+namespace ipx {
+
+namespace {
+
+// A pivot is accepted if it is larger than kPivotTolerance times the diagonal
+// entry of the unfactorized matrix. Otherwise it is replaced by kHugePivot.
+constexpr double kPivotTolerance = 1e-14;
+constexpr double kHugePivot = 1e128;
+
+// Supernodes near the root of the elimination tree with more than
+// kParallelRows rows are updated and solved in parallel row blocks of size
+// kBlockRows.
+constexpr Int kParallelRows = 256;
+constexpr Int kBlockRows = 64;
+
+inline double DenseDot(const double* x, const double* y, Int n) {
+    double d = 0.0;
+    for (Int i = 0; i < n; i++)
+        d += x[i] * y[i];
+    return d;
+}
+
+// Returns the pattern of the strict upper triangle of P*N*P', where N is given
+// by its lower triangle and row/column i of N becomes row/column iperm[i].
+SparseMatrix PermutedUpper(const SparseMatrix& lower,
+                           const std::vector<Int>& iperm) {
+    const Int n = lower.cols();
+    std::vector<Int> work(n, 0);
+    Int nz = 0;
+    for (Int j = 0; j < n; j++) {
+        for (Int p = lower.begin(j); p < lower.end(j); p++) {
+            Int i = lower.index(p);
+            if (i != j) {
+                work[std::max(iperm[i], iperm[j])]++;
+                nz++;
+            }
+        }
+    }
+    SparseMatrix upper(n, n, nz);
+    Int* Up = upper.colptr();
+    Int* Ui = upper.rowidx();
+    Up[0] = 0;
+    for (Int j = 0; j < n; j++) {
+        Up[j+1] = Up[j] + work[j];
+        work[j] = Up[j];
+    }
+    for (Int j = 0; j < n; j++) {
+        for (Int p = lower.begin(j); p < lower.end(j); p++) {
+            Int i = lower.index(p);
+            if (i != j) {
+                Int a = iperm[i];
+                Int b = iperm[j];
+                Ui[work[std::max(a,b)]++] = std::min(a,b);
+            }
+        }
+    }
+    return upper;
+}
+
+// Returns a postorder of the forest given by @parent.
+std::vector<Int> Postorder(const std::vector<Int>& parent) {
+    const Int n = parent.size();
+    std::vector<Int> head(n, -1), next(n, -1), stack, post;
+    post.reserve(n);
+    for (Int j = n-1; j >= 0; j--) {
+        if (parent[j] >= 0) {
+            next[j] = head[parent[j]];
+            head[parent[j]] = j;
+        }
+    }
+    for (Int j = 0; j < n; j++) {
+        if (parent[j] >= 0)
+            continue;
+        stack.push_back(j);
+        while (!stack.empty()) {
+            Int top = stack.back();
+            Int child = head[top];
+            if (child == -1) {
+                stack.pop_back();
+                post.push_back(top);
+            } else {
+                head[top] = next[child];
+                stack.push_back(child);
+            }
+        }
+    }
+    assert((Int) post.size() == n);
+    return post;
+}
+
+}  // namespace
+
+void SparseCholesky::Analyse(const SparseMatrix& lower) {
+    const Int n = lower.cols();
+    dim_ = n;
+    analysed_ = false;
+    factorized_ = false;
+    scheduled_threads_ = 0;
+
+    // Fill-reducing ordering.
+    {
+        std::vector<std::vector<Int>> adj(n);
+        for (Int j = 0; j < n; j++) {
+            for (Int p = lower.begin(j); p < lower.end(j); p++) {
+                Int i = lower.index(p);
+                if (i != j) {
+                    adj[i].push_back(j);
+                    adj[j].push_back(i);
+                }
+            }
+        }
+        MinimumDegree(adj);
+    }
+
+    // Postorder the elimination tree and combine with the ordering, so that
+    // each subtree consists of consecutive columns.
+    std::vector<Int> iperm(n);
+    for (Int k = 0; k < n; k++)
+        iperm[perm_[k]] = k;
+    SparseMatrix upper = PermutedUpper(lower, iperm);
+    std::vector<Int> parent;
+    EliminationTree(upper, parent);
+    {
+        std::vector<Int> post = Postorder(parent);
+        std::vector<Int> perm(n);
+        for (Int k = 0; k < n; k++)
+            perm[k] = perm_[post[k]];
+        perm_ = std::move(perm);
+        for (Int k = 0; k < n; k++)
+            iperm[perm_[k]] = k;
+    }
+    upper = PermutedUpper(lower, iperm);
+    EliminationTree(upper, parent);
+
+    // Column counts of L from traversing the row subtrees.
+    std::vector<Int> colcount(n, 1), mark(n, -1);
+    for (Int k = 0; k < n; k++) {
+        mark[k] = k;
+        for (Int p = upper.begin(k); p < upper.end(k); p++) {
+            for (Int i = upper.index(p); mark[i] != k; i = parent[i]) {
+                colcount[i]++;
+                mark[i] = k;
+            }
+        }
+    }
+    nnz_ = 0;
+    for (Int j = 0; j < n; j++)
+        nnz_ += colcount[j];
+
+    // Fundamental supernodes: column j-1 is merged with column j if j is its
+    // only child in the elimination tree and their patterns agree.
+    std::vector<Int> nchild(n, 0);
+    for (Int j = 0; j < n; j++)
+        if (parent[j] >= 0)
+            nchild[parent[j]]++;
+    sn_start_.assign(1, 0);
+    for (Int j = 1; j < n; j++) {
+        if (parent[j-1] != j || nchild[j] != 1 ||
+            colcount[j-1] != colcount[j]+1)
+            sn_start_.push_back(j);
+    }
+    if (n > 0)
+        sn_start_.push_back(n);
+    const Int nsn = sn_start_.size()-1;
+    std::vector<Int> sn_of(n);
+    for (Int s = 0; s < nsn; s++)
+        for (Int j = sn_start_[s]; j < sn_start_[s+1]; j++)
+            sn_of[j] = s;
+
+    // Row structure of each supernode: the columns of the diagonal block
+    // followed by the row indices below the diagonal block of its last column.
+    sn_rowptr_.assign(nsn+1, 0);
+    sn_valptr_.assign(nsn+1, 0);
+    for (Int s = 0; s < nsn; s++) {
+        Int ncol = sn_start_[s+1]-sn_start_[s];
+        Int nrow = ncol + colcount[sn_start_[s+1]-1]-1;
+        sn_rowptr_[s+1] = sn_rowptr_[s] + nrow;
+        sn_valptr_[s+1] = sn_valptr_[s] + nrow*ncol;
+    }
+    sn_rows_.resize(sn_rowptr_[nsn]);
+    std::vector<Int> fill(nsn);
+    for (Int s = 0; s < nsn; s++) {
+        fill[s] = sn_rowptr_[s];
+        for (Int j = sn_start_[s]; j < sn_start_[s+1]; j++)
+            sn_rows_[fill[s]++] = j;
+    }
+    std::fill(mark.begin(), mark.end(), -1);
+    for (Int k = 0; k < n; k++) {
+        mark[k] = k;
+        for (Int p = upper.begin(k); p < upper.end(k); p++) {
+            for (Int i = upper.index(p); mark[i] != k; i = parent[i]) {
+                mark[i] = k;
+                Int s = sn_of[i];
+                if (i == sn_start_[s+1]-1)
+                    sn_rows_[fill[s]++] = k;
+            }
+        }
+    }
+    for (Int s = 0; s < nsn; s++)
+        assert(fill[s] == sn_rowptr_[s+1]);
+
+    // Supernodal elimination tree. Because the columns are in postorder, the
+    // subtree rooted at s consists of the supernodes sn_first_desc_[s] to s.
+    sn_parent_.assign(nsn, -1);
+    sn_first_desc_.resize(nsn);
+    for (Int s = 0; s < nsn; s++)
+        sn_first_desc_[s] = s;
+    for (Int s = 0; s < nsn; s++) {
+        Int j = parent[sn_start_[s+1]-1];
+        if (j >= 0) {
+            Int t = sn_of[j];
+            sn_parent_[s] = t;
+            sn_first_desc_[t] = std::min(sn_first_desc_[t], sn_first_desc_[s]);
+        }
+    }
+
+    // Update lists. Each supernode d updates the supernodes that contain the
+    // rows of d below its diagonal block. These rows are sorted, so the rows
+    // that fall into the same target supernode are consecutive.
+    upd_ptr_.assign(nsn+1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        for (Int d = 0; d < nsn; d++) {
+            Int ncol = sn_start_[d+1]-sn_start_[d];
+            Int pend = sn_rowptr_[d+1];
+            for (Int p = sn_rowptr_[d] + ncol; p < pend; ) {
+                Int t = sn_of[sn_rows_[p]];
+                if (pass == 0) {
+                    upd_ptr_[t+1]++;
+                } else {
+                    upd_source_[fill[t]] = d;
+                    upd_pos_[fill[t]] = p - sn_rowptr_[d];
+                    fill[t]++;
+                }
+                while (p < pend && sn_of[sn_rows_[p]] == t)
+                    p++;
+            }
+        }
+        if (pass == 0) {
+            for (Int s = 0; s < nsn; s++) {
+                upd_ptr_[s+1] += upd_ptr_[s];
+                fill[s] = upd_ptr_[s];
+            }
+            upd_source_.resize(upd_ptr_[nsn]);
+            upd_pos_.resize(upd_ptr_[nsn]);
+        }
+    }
+
+    // Map from the entries of the input matrix into the supernodal storage.
+    map_.resize(lower.entries());
+    for (Int j = 0; j < n; j++) {
+        for (Int p = lower.begin(j); p < lower.end(j); p++) {
+            Int a = iperm[lower.index(p)];
+            Int b = iperm[j];
+            Int row = std::max(a,b);
+            Int col = std::min(a,b);
+            Int s = sn_of[col];
+            Int ncol = sn_start_[s+1]-sn_start_[s];
+            const Int* begin = &sn_rows_[0] + sn_rowptr_[s];
+            const Int* end = &sn_rows_[0] + sn_rowptr_[s+1];
+            const Int* pos = std::lower_bound(begin, end, row);
+            assert(pos != end && *pos == row);
+            map_[p] = sn_valptr_[s] + (pos-begin)*ncol + (col-sn_start_[s]);
+        }
+    }
+    values_.assign(sn_valptr_[nsn], 0.0);
+    diag_.assign(n, 0.0);
+    analysed_ = true;
+}
+
+// Approximate minimum degree ordering on the quotient graph. Eliminated
+// variables become elements; the pattern of an element is the list of
+// variables adjacent to it. The degree of a variable i adjacent to the new
+// element p is bounded by
+//
+//   |Lp \ i| + |Ai \ i| + sum over elements e adjacent to i of |Le \ Lp|,
+//
+// as in the AMD algorithm. Elements e with Le \ Lp empty are absorbed into p,
+// and variables with identical adjacency are merged into supervariables.
+void SparseCholesky::MinimumDegree(std::vector<std::vector<Int>>& adj) {
+    const Int n = dim_;
+    enum : int { kVariable, kMerged, kElement, kAbsorbed };
+
+    // For a variable i, vars[i] are its adjacent variables and elems[i] its
+    // adjacent elements. For an element e, vars[e] is its pattern.
+    std::vector<std::vector<Int>>& vars = adj;
+    std::vector<std::vector<Int>> elems(n);
+    std::vector<std::vector<Int>> members(n);
+    std::vector<int> status(n, kVariable);
+    std::vector<Int> nv(n, 1);
+    std::vector<Int> degree(n);
+    std::vector<Int> head(n, -1), next(n, -1), prev(n, -1);
+    std::vector<Int> mark(n, -1), wmark(n, -1), wval(n, 0);
+    Int stamp = 0;
+
+    auto insert = [&](Int i) {
+        Int d = degree[i];
+        prev[i] = -1;
+        next[i] = head[d];
+        if (head[d] >= 0)
+            prev[head[d]] = i;
+        head[d] = i;
+    };
+    auto remove = [&](Int i) {
+        if (prev[i] >= 0)
+            next[prev[i]] = next[i];
+        else
+            head[degree[i]] = next[i];
+        if (next[i] >= 0)
+            prev[next[i]] = prev[i];
+    };
+
+    for (Int i = 0; i < n; i++) {
+        degree[i] = vars[i].size();
+        insert(i);
+    }
+    perm_.clear();
+    perm_.reserve(n);
+    std::vector<Int> Lp;
+    std::vector<std::pair<uint64_t,Int>> hashes;
+    Int mindeg = 0;
+    Int nelim = 0;
+
+    while (nelim < n) {
+        while (head[mindeg] < 0)
+            mindeg++;
+        const Int p = head[mindeg];
+        remove(p);
+        perm_.push_back(p);
+        for (Int j : members[p])
+            perm_.push_back(j);
+        nelim += nv[p];
+
+        // Construct the pattern of the new element p from its adjacent
+        // elements, which are absorbed, and its adjacent variables.
+        const Int lpmark = ++stamp;
+        mark[p] = lpmark;
+        Lp.clear();
+        Int lpweight = 0;
+        for (Int e : elems[p]) {
+            if (status[e] != kElement)
+                continue;
+            for (Int i : vars[e]) {
+                if (status[i] == kVariable && mark[i] != lpmark) {
+                    mark[i] = lpmark;
+                    Lp.push_back(i);
+                    lpweight += nv[i];
+                }
+            }
+            status[e] = kAbsorbed;
+            std::vector<Int>().swap(vars[e]);
+        }
+        for (Int i : vars[p]) {
+            if (status[i] == kVariable && mark[i] != lpmark) {
+                mark[i] = lpmark;
+                Lp.push_back(i);
+                lpweight += nv[i];
+            }
+        }
+        status[p] = kElement;
+        std::vector<Int>().swap(elems[p]);
+        std::vector<Int>().swap(members[p]);
+        vars[p] = Lp;
+
+        // Update the adjacency of the variables in Lp and compute the weight
+        // of Le \ Lp for each element e adjacent to a variable in Lp.
+        const Int wstamp = ++stamp;
+        for (Int i : Lp) {
+            remove(i);
+            std::vector<Int>& Ei = elems[i];
+            Int k = 0;
+            for (Int e : Ei) {
+                if (status[e] != kElement)
+                    continue;
+                Ei[k++] = e;
+                if (wmark[e] != wstamp) {
+                    wmark[e] = wstamp;
+                    std::vector<Int>& Le = vars[e];
+                    Int kk = 0;
+                    Int w = 0;
+                    for (Int j : Le) {
+                        if (status[j] == kVariable) {
+                            Le[kk++] = j;
+                            w += nv[j];
+                        }
+                    }
+                    Le.resize(kk);
+                    wval[e] = w;
+                }
+                wval[e] -= nv[i];
+            }
+            Ei.resize(k);
+            std::vector<Int>& Vi = vars[i];
+            k = 0;
+            for (Int j : Vi)
+                if (status[j] == kVariable && mark[j] != lpmark)
+                    Vi[k++] = j;
+            Vi.resize(k);
+        }
+
+        // Approximate degrees and aggressive element absorption.
+        const Int remaining = n - nelim;
+        for (Int i : Lp) {
+            std::vector<Int>& Ei = elems[i];
+            Int deg = lpweight - nv[i];
+            Int k = 0;
+            for (Int e : Ei) {
+                if (status[e] != kElement)
+                    continue;
+                if (wval[e] == 0) {
+                    status[e] = kAbsorbed;
+                    std::vector<Int>().swap(vars[e]);
+                    continue;
+                }
+                deg += wval[e];
+                Ei[k++] = e;
+            }
+            Ei.resize(k);
+            Ei.push_back(p);
+            for (Int j : vars[i])
+                deg += nv[j];
+            degree[i] = std::min(deg, remaining - nv[i]);
+        }
+
+        // Merge indistinguishable variables in Lp into supervariables.
+        hashes.clear();
+        for (Int i : Lp) {
+            uint64_t h = 0;
+            for (Int e : elems[i])
+                h += e;
+            for (Int j : vars[i])
+                h += j;
+            hashes.push_back(std::make_pair(h, i));
+        }
+        std::sort(hashes.begin(), hashes.end());
+        for (std::size_t a = 0; a < hashes.size(); a++) {
+            const Int i = hashes[a].second;
+            if (status[i] != kVariable)
+                continue;
+            bool marked = false;
+            Int imark = 0;
+            for (std::size_t b = a+1;
+                 b < hashes.size() && hashes[b].first == hashes[a].first; b++) {
+                const Int j = hashes[b].second;
+                if (status[j] != kVariable ||
+                    elems[j].size() != elems[i].size() ||
+                    vars[j].size() != vars[i].size())
+                    continue;
+                if (!marked) {
+                    imark = ++stamp;
+                    for (Int e : elems[i])
+                        mark[e] = imark;
+                    for (Int v : vars[i])
+                        mark[v] = imark;
+                    marked = true;
+                }
+                bool same = true;
+                for (Int e : elems[j])
+                    same = same && mark[e] == imark;
+                for (Int v : vars[j])
+                    same = same && mark[v] == imark;
+                if (!same)
+                    continue;
+                nv[i] += nv[j];
+                degree[i] = std::max(degree[i] - nv[j], (Int) 0);
+                nv[j] = 0;
+                status[j] = kMerged;
+                members[i].push_back(j);
+                members[i].insert(members[i].end(), members[j].begin(),
+                                  members[j].end());
+                std::vector<Int>().swap(members[j]);
+                std::vector<Int>().swap(elems[j]);
+                std::vector<Int>().swap(vars[j]);
+            }
+        }
+
+        for (Int i : Lp) {
+            if (status[i] != kVariable)
+                continue;
+            degree[i] = std::min(degree[i], remaining - nv[i]);
+            insert(i);
+            mindeg = std::min(mindeg, degree[i]);
+        }
+    }
+    assert((Int) perm_.size() == n);
+}
+
+void SparseCholesky::EliminationTree(const SparseMatrix& upper,
+                                     std::vector<Int>& parent) const {
+    const Int n = dim_;
+    parent.assign(n, -1);
+    std::vector<Int> ancestor(n, -1);
+    for (Int k = 0; k < n; k++) {
+        for (Int p = upper.begin(k); p < upper.end(k); p++) {
+            Int inext;
+            for (Int i = upper.index(p); i != -1 && i < k; i = inext) {
+                inext = ancestor[i];
+                ancestor[i] = k;
+                if (inext == -1)
+                    parent[i] = k;
+            }
+        }
+    }
+}
+
+// Splits the largest subtree of the supernodal elimination tree into its root
+// and child subtrees until no subtree has more than 1/(2*num_threads) of the
+// total work. The roots removed this way form the top of the tree.
+void SparseCholesky::ScheduleSubtrees(Int num_threads) {
+    const Int nsn = supernodes();
+    std::vector<double> work(nsn, 0.0);
+    std::vector<Int> head(nsn, -1), next(nsn, -1);
+    std::vector<Int> heap;
+    double total = 0.0;
+    for (Int s = 0; s < nsn; s++) {
+        double ncol = sn_start_[s+1]-sn_start_[s];
+        double nrow = sn_rowptr_[s+1]-sn_rowptr_[s];
+        work[s] += ncol*nrow*nrow;
+        Int t = sn_parent_[s];
+        if (t >= 0) {
+            work[t] += work[s];
+            next[s] = head[t];
+            head[t] = s;
+        } else {
+            heap.push_back(s);
+            total += work[s];
+        }
+    }
+    auto less = [&](Int a, Int b) { return work[a] < work[b]; };
+    std::make_heap(heap.begin(), heap.end(), less);
+    const double limit = total / (2*std::max(num_threads, (Int) 1));
+    subtree_roots_.clear();
+    top_.clear();
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), less);
+        Int s = heap.back();
+        heap.pop_back();
+        if (num_threads <= 1 || work[s] <= limit || head[s] < 0) {
+            subtree_roots_.push_back(s);
+            continue;
+        }
+        top_.push_back(s);
+        for (Int c = head[s]; c >= 0; c = next[c]) {
+            heap.push_back(c);
+            std::push_heap(heap.begin(), heap.end(), less);
+        }
+    }
+    std::sort(top_.begin(), top_.end());
+}
+
+Int SparseCholesky::Factorize(const SparseMatrix& lower) {
+    assert(analysed_);
+    assert(lower.entries() == (Int) map_.size());
+    const Int n = dim_;
+    factorized_ = false;
+
+    std::fill(values_.begin(), values_.end(), 0.0);
+    for (Int p = 0; p < lower.entries(); p++)
+        values_[map_[p]] += lower.value(p);
+    for (Int s = 0; s < supernodes(); s++) {
+        const Int ncol = sn_start_[s+1]-sn_start_[s];
+        for (Int c = 0; c < ncol; c++)
+            diag_[sn_start_[s]+c] = values_[sn_valptr_[s] + c*ncol + c];
+    }
+
+    const Int num_threads = highs::parallel::num_threads();
+    if (num_threads != scheduled_threads_) {
+        ScheduleSubtrees(num_threads);
+        scheduled_threads_ = num_threads;
+    }
+
+    // Factorize independent subtrees in parallel, then the top of the tree.
+    std::atomic<Int> num_dropped{0};
+    highs::parallel::for_each(
+        0, (HighsInt) subtree_roots_.size(), [&](HighsInt start, HighsInt end) {
+            std::vector<Int> relpos(n);
+            Int dropped = 0;
+            for (HighsInt t = start; t < end; t++) {
+                const Int root = subtree_roots_[t];
+                for (Int s = sn_first_desc_[root]; s <= root; s++)
+                    dropped += FactorizeSupernode(s, relpos.data(), false);
+            }
+            num_dropped += dropped;
+        });
+    std::vector<Int> relpos(n);
+    Int dropped = num_dropped;
+    for (Int s : top_)
+        dropped += FactorizeSupernode(s, relpos.data(), true);
+    factorized_ = true;
+    return dropped;
+}
+
+Int SparseCholesky::FactorizeSupernode(Int s, Int* relpos, bool parallel) {
+    const Int ncol = sn_start_[s+1]-sn_start_[s];
+    const Int nrow = sn_rowptr_[s+1]-sn_rowptr_[s];
+    const Int* rows = &sn_rows_[sn_rowptr_[s]];
+    for (Int r = 0; r < nrow; r++)
+        relpos[rows[r]] = r;
+    if (parallel && nrow > kParallelRows) {
+        highs::parallel::for_each(
+            0, nrow, [&](HighsInt start, HighsInt end) {
+                UpdateSupernode(s, start, end, relpos);
+            }, kBlockRows);
+        Int dropped = FactorizeDiagonalBlock(s);
+        highs::parallel::for_each(
+            ncol, nrow, [&](HighsInt start, HighsInt end) {
+                SolveOffDiagonalBlock(s, start, end);
+            }, kBlockRows);
+        return dropped;
+    }
+    UpdateSupernode(s, 0, nrow, relpos);
+    Int dropped = FactorizeDiagonalBlock(s);
+    SolveOffDiagonalBlock(s, ncol, nrow);
+    return dropped;
+}
+
+// Subtracts L_d[i,:]*L_d[j,:]' from supernode s for each updating supernode d,
+// where j runs over the rows of d that are columns of s and i over the rows of
+// d that are rows of s (i >= j). The rows of each block are contiguous.
+void SparseCholesky::UpdateSupernode(Int s, Int rbegin, Int rend,
+                                     const Int* relpos) {
+    const Int first = sn_start_[s];
+    const Int ncol = sn_start_[s+1]-first;
+    double* Ls = &values_[sn_valptr_[s]];
+    for (Int q = upd_ptr_[s]; q < upd_ptr_[s+1]; q++) {
+        const Int d = upd_source_[q];
+        const Int kd = sn_start_[d+1]-sn_start_[d];
+        const Int nrd = sn_rowptr_[d+1]-sn_rowptr_[d];
+        const Int* rows_d = &sn_rows_[sn_rowptr_[d]];
+        const double* Ld = &values_[sn_valptr_[d]];
+        const Int pos = upd_pos_[q];
+        Int jend = pos;
+        while (jend < nrd && rows_d[jend] < first+ncol)
+            jend++;
+        for (Int i = pos; i < nrd; i++) {
+            const Int r = relpos[rows_d[i]];
+            if (r < rbegin)
+                continue;
+            if (r >= rend)
+                break;
+            const double* li = Ld + i*kd;
+            double* target = Ls + r*ncol - first;
+            const Int jlast = std::min(i+1, jend);
+            for (Int j = pos; j < jlast; j++)
+                target[rows_d[j]] -= DenseDot(li, Ld + j*kd, kd);
+        }
+    }
+}
+
+Int SparseCholesky::FactorizeDiagonalBlock(Int s) {
+    const Int first = sn_start_[s];
+    const Int ncol = sn_start_[s+1]-first;
+    double* L = &values_[sn_valptr_[s]];
+    Int dropped = 0;
+    for (Int c = 0; c < ncol; c++) {
+        double* lc = L + c*ncol;
+        double d = lc[c] - DenseDot(lc, lc, c);
+        if (!(d > kPivotTolerance * diag_[first+c])) {
+            d = kHugePivot;
+            dropped++;
+        }
+        lc[c] = std::sqrt(d);
+        for (Int r = c+1; r < ncol; r++) {
+            double* lr = L + r*ncol;
+            lr[c] = (lr[c] - DenseDot(lr, lc, c)) / lc[c];
+        }
+    }
+    return dropped;
+}
+
+void SparseCholesky::SolveOffDiagonalBlock(Int s, Int rbegin, Int rend) {
+    const Int ncol = sn_start_[s+1]-sn_start_[s];
+    double* L = &values_[sn_valptr_[s]];
+    for (Int r = rbegin; r < rend; r++) {
+        double* lr = L + r*ncol;
+        for (Int c = 0; c < ncol; c++) {
+            const double* lc = L + c*ncol;
+            lr[c] = (lr[c] - DenseDot(lr, lc, c)) / lc[c];
+        }
+    }
+}
+
+void SparseCholesky::Solve(Vector& x) const {
+    assert(factorized_);
+    const Int n = dim_;
+    const Int nsn = supernodes();
+    Vector y(n);
+    for (Int k = 0; k < n; k++)
+        y[k] = x[perm_[k]];
+
+    // Forward solve with L.
+    for (Int s = 0; s < nsn; s++) {
+        const Int first = sn_start_[s];
+        const Int ncol = sn_start_[s+1]-first;
+        const Int nrow = sn_rowptr_[s+1]-sn_rowptr_[s];
+        const Int* rows = &sn_rows_[sn_rowptr_[s]];
+        const double* L = &values_[sn_valptr_[s]];
+        double* ys = &y[first];
+        for (Int c = 0; c < ncol; c++) {
+            const double* lc = L + c*ncol;
+            ys[c] = (ys[c] - DenseDot(lc, ys, c)) / lc[c];
+        }
+        for (Int r = ncol; r < nrow; r++)
+            y[rows[r]] -= DenseDot(L + r*ncol, ys, ncol);
+    }
+
+    // Backward solve with L'.
+    for (Int s = nsn-1; s >= 0; s--) {
+        const Int first = sn_start_[s];
+        const Int ncol = sn_start_[s+1]-first;
+        const Int nrow = sn_rowptr_[s+1]-sn_rowptr_[s];
+        const Int* rows = &sn_rows_[sn_rowptr_[s]];
+        const double* L = &values_[sn_valptr_[s]];
+        double* ys = &y[first];
+        for (Int r = ncol; r < nrow; r++) {
+            const double* lr = L + r*ncol;
+            const double yr = y[rows[r]];
+            for (Int c = 0; c < ncol; c++)
+                ys[c] -= lr[c] * yr;
+        }
+        for (Int c = ncol-1; c >= 0; c--) {
+            const double* lc = L + c*ncol;
+            ys[c] /= lc[c];
+            for (Int u = 0; u < c; u++)
+                ys[u] -= lc[u] * ys[c];
+        }
+    }
+
+    for (Int k = 0; k < n; k++)
+        x[perm_[k]] = y[k];
+}
+
+void SparseCholesky::_Apply(const Vector& rhs, Vector& lhs,
+                            double* rhs_dot_lhs) {
+    Timer timer;
+    lhs = rhs;
+    Solve(lhs);
+    if (rhs_dot_lhs)
+        *rhs_dot_lhs = Dot(rhs, lhs);
+    time_ += timer.Elapsed();
+}
+
+}  // namespace ipx
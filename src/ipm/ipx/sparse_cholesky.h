@@ -0,0 +1,132 @@
+#ifndef IPX_SPARSE_CHOLESKY_H_
+#define IPX_SPARSE_CHOLESKY_H_
+
+#include <vector>
+#include "ipm/ipx/ipx_internal.h"
+#include "ipm/ipx/linear_operator.h"
+#include "ipm/ipx/sparse_matrix.h"
+
+namespace ipx {
+
+// SparseCholesky computes a supernodal Cholesky factorization
+//
+//   P*N*P' = L*L'
+//
+// of a symmetric positive definite matrix N. The permutation P is a fill
+// reducing ordering obtained from an approximate minimum degree algorithm.
+// The symbolic analysis (ordering, elimination tree, supernode partition and
+// update lists) depends on the sparsity pattern of N only and is done once by
+// Analyse(). Factorize() can then be called repeatedly for matrices with the
+// same pattern but different values, as happens in the IPM.
+//
+// Each supernode is a set of consecutive columns of L with identical pattern
+// below the diagonal block. Its entries are stored as a dense row-major block,
+// so that the numeric factorization and the triangular solves are performed by
+// dense kernels on contiguous memory. The numeric factorization is left
+// looking. Independent subtrees of the supernodal elimination tree are
+// factorized in parallel; the remaining supernodes near the root are processed
+// one at a time with the work inside a supernode split into row blocks.
+//
+// As a LinearOperator the object applies inverse(N).
+
+class SparseCholesky : public LinearOperator {
+public:
+    SparseCholesky() = default;
+
+    // Computes the ordering and symbolic factorization. @lower holds the lower
+    // triangle (including the diagonal) of the symmetric matrix in CSC format.
+    // All diagonal entries must be present. Only the pattern is accessed.
+    void Analyse(const SparseMatrix& lower);
+
+    // Computes the numeric factorization. @lower must have the same pattern
+    // as in the call to Analyse(), with entries in the same positions.
+    // Pivots that are not sufficiently positive are replaced by a huge value,
+    // which effectively removes the corresponding row and column from the
+    // system. Returns the # such pivots.
+    Int Factorize(const SparseMatrix& lower);
+
+    // Solves N*x = rhs. @x holds rhs on entry and the solution on return.
+    void Solve(Vector& x) const;
+
+    Int dim() const { return dim_; }
+    bool analysed() const { return analysed_; }
+    bool factorized() const { return factorized_; }
+
+    // Returns the # nonzeros in L (including the diagonal).
+    Int nnz() const { return nnz_; }
+
+    // Returns the # supernodes.
+    Int supernodes() const { return (Int) sn_start_.size()-1; }
+
+    // Returns computation time for calls to Apply() since last reset_time().
+    double time() const { return time_; }
+    void reset_time() { time_ = 0.0; }
+
+private:
+    void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+
+    // Computes perm_ by approximate minimum degree ordering of the symmetric
+    // pattern given by the adjacency lists in @adj (no diagonal entries).
+    void MinimumDegree(std::vector<std::vector<Int>>& adj);
+
+    // Computes the elimination tree of the matrix permuted by perm_. @upper
+    // holds the pattern of the strict upper triangle of the permuted matrix.
+    void EliminationTree(const SparseMatrix& upper, std::vector<Int>& parent)
+        const;
+
+    // Partitions the supernodal elimination tree into independent subtrees
+    // that are factorized in parallel (subtree_roots_) and the remaining
+    // supernodes near the root (top_).
+    void ScheduleSubtrees(Int num_threads);
+
+    // Applies the updates from descendant supernodes to supernode s and
+    // factorizes it. Only rows [rbegin,rend) of the supernode are updated in
+    // the first step. @relpos is workspace of dimension dim_ that maps the
+    // global row indices of supernode s to local ones.
+    void UpdateSupernode(Int s, Int rbegin, Int rend, const Int* relpos);
+    Int FactorizeDiagonalBlock(Int s);
+    void SolveOffDiagonalBlock(Int s, Int rbegin, Int rend);
+    Int FactorizeSupernode(Int s, Int* relpos, bool parallel);
+
+    Int dim_{0};
+    bool analysed_{false};
+    bool factorized_{false};
+    Int nnz_{0};
+
+    std::vector<Int> perm_;     // row/column i of P*N*P' is row/column perm_[i]
+                                // of N
+
+    // Supernode s consists of columns sn_start_[s] to sn_start_[s+1]-1. Its
+    // row indices (including those of the diagonal block) are in
+    // sn_rows_[sn_rowptr_[s]..sn_rowptr_[s+1]-1] in increasing order, and its
+    // values form a dense row-major block at values_[sn_valptr_[s]].
+    std::vector<Int> sn_start_;
+    std::vector<Int> sn_rowptr_;
+    std::vector<Int> sn_rows_;
+    std::vector<Int> sn_valptr_;
+    std::vector<Int> sn_parent_;
+    std::vector<Int> sn_first_desc_; // subtree of s is sn_first_desc_[s]..s
+
+    // The supernodes that update supernode s are upd_source_[p] for
+    // upd_ptr_[s] <= p < upd_ptr_[s+1]. The first row of the source supernode
+    // that lies in s is at position upd_pos_[p] in its row list.
+    std::vector<Int> upd_ptr_;
+    std::vector<Int> upd_source_;
+    std::vector<Int> upd_pos_;
+
+    // values_[map_[p]] receives entry p of the matrix passed to Factorize().
+    std::vector<Int> map_;
+    std::vector<double> values_;
+    std::vector<double> diag_;  // diagonal of P*N*P' before factorization
+
+    // Parallel schedule computed when the number of threads is known.
+    Int scheduled_threads_{0};
+    std::vector<Int> subtree_roots_;
+    std::vector<Int> top_;
+
+    double time_{0.0};
+};
+
+}  // namespace ipx
+
+#endif  // IPX_SPARSE_CHOLESKY_H_
@@ -42,7 +42,6 @@ const double kExcessivelySmallBoundValue = 1e-4;
 const double kExcessivelySmallCostValue = 1e-4;
 
 const bool kAllowDeveloperAssert = false;
-const bool kExtendInvertWhenAddingRows = false;
 
 enum class HighsLogType { kInfo = 1, kDetailed, kVerbose, kWarning, kError };
 
@@ -120,6 +119,13 @@ enum IpxDualizeStrategy {
   kIpxDualizeStrategyMax = kIpxDualizeStrategyFilippo,
 };
 
+enum IpxKktSolver {
+  kIpxKktSolverCr = 0,
+  kIpxKktSolverCholesky,
+  kIpxKktSolverMin = kIpxKktSolverCr,
+  kIpxKktSolverMax = kIpxKktSolverCholesky,
+};
+
 /** SCIP/HiGHS Objective sense */
 enum class ObjSense { kMinimize = 1, kMaximize = -1 };
 
@@ -224,7 +230,8 @@ enum HighsCallbackType : int {
   kCallbackMipInterrupt,              // 6
   kCallbackMipGetCutPool,             // 7
   kCallbackMipDefineLazyConstraints,  // 8
-  kCallbackMax = kCallbackMipDefineLazyConstraints,
+  kCallbackPdlpInterrupt,             // 9
+  kCallbackMax = kCallbackPdlpInterrupt,
   kNumCallbackType
 };
 
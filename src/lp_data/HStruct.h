@@ -143,4 +143,13 @@ struct HighsIllConditioning {
   void clear();
 };
 
+struct HighsBlockStructure {
+  HighsInt num_block = 0;
+  HighsInt num_linking_row = 0;
+  // Block of each column and row, with -1 for a linking row
+  std::vector<HighsInt> col_block;
+  std::vector<HighsInt> row_block;
+  void clear();
+};
+
 #endif /* LP_DATA_HSTRUCT_H_ */
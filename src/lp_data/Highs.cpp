@@ -22,6 +22,7 @@
 #include <sstream>
 
 #include "io/Filereader.h"
+#include "io/FilereaderBinary.h"
 #include "io/LoadOptions.h"
 #include "lp_data/HighsCallbackStruct.h"
 #include "lp_data/HighsInfoDebug.h"
@@ -29,6 +30,7 @@
 #include "lp_data/HighsSolve.h"
 #include "mip/HighsMipSolver.h"
 #include "model/HighsHessianUtils.h"
+#include "model/HighsModelComponents.h"
 #include "parallel/HighsParallel.h"
 #include "presolve/ICrashX.h"
 #include "qpsolver/a_quass.hpp"
@@ -629,9 +631,23 @@ HighsStatus Highs::readModel(const std::string& filename) {
     return HighsStatus::kError;
   }
 
+  // File readers can use the global scheduler, but it is only
+  // initialized here if the number of threads has been specified, so
+  // that it can still be set after reading the model
+  if (options_.threads != 0)
+    highs::parallel::initialize_scheduler(options_.threads);
+
   HighsModel model;
   FilereaderRetcode call_code =
       reader->readModelFromFile(options_, filename, model);
+  // A binary model file may also contain a solution and basis
+  HighsSolution read_solution;
+  HighsBasis read_basis;
+  FilereaderBinary* binary_reader = dynamic_cast<FilereaderBinary*>(reader);
+  if (binary_reader != nullptr) {
+    read_solution = std::move(binary_reader->solution);
+    read_basis = std::move(binary_reader->basis);
+  }
   delete reader;
   if (call_code != FilereaderRetcode::kOk) {
     interpretFilereaderRetcode(options_.log_options, filename.c_str(),
@@ -655,6 +671,17 @@ HighsStatus Highs::readModel(const std::string& filename) {
   return_status =
       interpretCallStatus(options_.log_options, passModel(std::move(model)),
                           return_status, "passModel");
+  if (return_status == HighsStatus::kError) return return_status;
+  if (read_basis.valid) {
+    return_status = interpretCallStatus(options_.log_options,
+                                        setBasis(read_basis, "readModel"),
+                                        return_status, "setBasis");
+    if (return_status == HighsStatus::kError) return return_status;
+  }
+  // For a MIP, the solution is the incumbent, so is used as the
+  // starting solution by the MIP solver
+  if (read_solution.value_valid || read_solution.dual_valid)
+    solution_ = std::move(read_solution);
   return returnFromHighs(return_status);
 }
 
@@ -720,6 +747,13 @@ HighsStatus Highs::writeLocalModel(HighsModel& model,
                    "Model file %s not supported\n", filename.c_str());
       return HighsStatus::kError;
     }
+    // Any solution and basis for the incumbent model are written to
+    // a binary model file
+    FilereaderBinary* binary_writer = dynamic_cast<FilereaderBinary*>(writer);
+    if (binary_writer != nullptr && &model == &model_) {
+      binary_writer->write_solution = &solution_;
+      binary_writer->write_basis = &basis_;
+    }
     // Report to user that model is being written
     highsLogUser(options_.log_options, HighsLogType::kInfo,
                  "Writing the model to %s\n", filename.c_str());
@@ -1040,6 +1074,12 @@ HighsStatus Highs::run() {
       return returnFromRun(HighsStatus::kError, undo_mods);
     }
   }
+  if (options_.solve_components) {
+    // Solve any independent components of the model separately
+    bool decomposed = false;
+    call_status = solveComponents(decomposed);
+    if (decomposed) return returnFromRun(call_status, undo_mods);
+  }
   const bool use_simplex_or_ipm =
       (options_.solver.compare(kHighsChooseString) != 0);
   if (!use_simplex_or_ipm) {
@@ -1482,9 +1522,12 @@ HighsStatus Highs::run() {
             HighsOptions save_options = options_;
             const bool full_logging = false;
             if (full_logging) options_.log_dev_level = kHighsLogDevLevelVerbose;
-            // Force the use of simplex to clean up if IPM has been used
-            // to solve the presolved problem
-            if (options_.solver == kIpmString) options_.solver = kSimplexString;
+            // Force the use of simplex to clean up if IPM, or a
+            // concurrent solve, has been used to solve the presolved
+            // problem
+            if (options_.solver == kIpmString ||
+                options_.solver == kConcurrentString)
+              options_.solver = kSimplexString;
             options_.simplex_strategy = kSimplexStrategyChoose;
             // Ensure that the parallel solver isn't used
             options_.simplex_min_concurrency = 1;
@@ -1679,6 +1722,11 @@ HighsStatus Highs::getIllConditioning(HighsIllConditioning& ill_conditioning,
                                 ill_conditioning_bound);
 }
 
+HighsStatus Highs::getBlockStructure(HighsBlockStructure& block_structure) {
+  ::getBlockStructure(model_, true, block_structure);
+  return HighsStatus::kOk;
+}
+
 bool Highs::hasInvert() const { return ekk_instance_.status_.has_invert; }
 
 const HighsInt* Highs::getBasicVariablesArray() const {
@@ -0,0 +1,360 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsBatchSolver.cpp
+ * @brief Solves batches of models with a pool of reusable Highs instances
+ */
+#include "lp_data/HighsBatchSolver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+
+#include "parallel/HighsParallel.h"
+
+namespace {
+
+// Models with the same dimensions, matrix and Hessian can be loaded
+// into an instance holding the other by changing costs, bounds and
+// integrality, retaining its scaling, basis and factorization
+bool sameStructure(const HighsModel& model0, const HighsModel& model1) {
+  const HighsLp& lp0 = model0.lp_;
+  const HighsLp& lp1 = model1.lp_;
+  return lp0.num_col_ == lp1.num_col_ && lp0.num_row_ == lp1.num_row_ &&
+         lp0.sense_ == lp1.sense_ &&
+         lp0.integrality_.size() == lp1.integrality_.size() &&
+         lp0.a_matrix_ == lp1.a_matrix_ && model0.hessian_ == model1.hessian_;
+}
+
+bool validIndices(const std::vector<HighsInt>& index, const HighsInt dim) {
+  for (const HighsInt i : index)
+    if (i < 0 || i >= dim) return false;
+  return true;
+}
+
+}  // namespace
+
+void HighsBatchDelta::clear() {
+  this->cost_index.clear();
+  this->cost_value.clear();
+  this->col_index.clear();
+  this->col_lower.clear();
+  this->col_upper.clear();
+  this->row_index.clear();
+  this->row_lower.clear();
+  this->row_upper.clear();
+}
+
+HighsBatchSolver::HighsBatchSolver() { options_.output_flag = false; }
+
+HighsStatus HighsBatchSolver::optionChangeAction(const OptionStatus status) {
+  if (status != OptionStatus::kOk) return HighsStatus::kError;
+  options_version_++;
+  return HighsStatus::kOk;
+}
+
+HighsStatus HighsBatchSolver::setOptionValue(const std::string& option,
+                                             const bool value) {
+  return optionChangeAction(setLocalOptionValue(
+      options_.log_options, option, options_.records, value));
+}
+
+HighsStatus HighsBatchSolver::setOptionValue(const std::string& option,
+                                             const HighsInt value) {
+  return optionChangeAction(setLocalOptionValue(
+      options_.log_options, option, options_.records, value));
+}
+
+HighsStatus HighsBatchSolver::setOptionValue(const std::string& option,
+                                             const double value) {
+  return optionChangeAction(setLocalOptionValue(
+      options_.log_options, option, options_.records, value));
+}
+
+HighsStatus HighsBatchSolver::setOptionValue(const std::string& option,
+                                             const std::string& value) {
+  HighsLogOptions report_log_options = options_.log_options;
+  return optionChangeAction(setLocalOptionValue(report_log_options, option,
+                                                options_.log_options,
+                                                options_.records, value));
+}
+
+HighsStatus HighsBatchSolver::setOptionValue(const std::string& option,
+                                             const char* value) {
+  return setOptionValue(option, std::string(value));
+}
+
+HighsStatus HighsBatchSolver::passOptions(const HighsOptions& options) {
+  return optionChangeAction(
+      passLocalOptions(options_.log_options, options, options_));
+}
+
+HighsInt HighsBatchSolver::addModel(HighsModel model) {
+  model.lp_.ensureColwise();
+  std::shared_ptr<const HighsModel> shared_model =
+      std::make_shared<const HighsModel>(std::move(model));
+  const HighsInt id = next_id_++;
+  model_.push_back(shared_model);
+  queue_.push_back(Job{id, -1, shared_model, nullptr});
+  return id;
+}
+
+HighsInt HighsBatchSolver::addModel(HighsLp lp) {
+  HighsModel model;
+  model.lp_ = std::move(lp);
+  return addModel(std::move(model));
+}
+
+HighsInt HighsBatchSolver::addModelDelta(const HighsInt base_id,
+                                         HighsBatchDelta delta) {
+  if (base_id < 0 || base_id >= HighsInt(model_.size()) ||
+      !model_[base_id]) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "HighsBatchSolver::addModelDelta: %d is not the identifier "
+                 "of a model\n",
+                 int(base_id));
+    return -1;
+  }
+  const HighsLp& lp = model_[base_id]->lp_;
+  const bool valid =
+      delta.cost_value.size() == delta.cost_index.size() &&
+      delta.col_lower.size() == delta.col_index.size() &&
+      delta.col_upper.size() == delta.col_index.size() &&
+      delta.row_lower.size() == delta.row_index.size() &&
+      delta.row_upper.size() == delta.row_index.size() &&
+      validIndices(delta.cost_index, lp.num_col_) &&
+      validIndices(delta.col_index, lp.num_col_) &&
+      validIndices(delta.row_index, lp.num_row_);
+  if (!valid) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "HighsBatchSolver::addModelDelta: delta has inconsistent "
+                 "sizes or indices out of range\n");
+    return -1;
+  }
+  const HighsInt id = next_id_++;
+  model_.push_back(nullptr);
+  queue_.push_back(
+      Job{id, base_id, model_[base_id],
+          std::make_shared<const HighsBatchDelta>(std::move(delta))});
+  return id;
+}
+
+void HighsBatchSolver::clear() {
+  next_id_ = 0;
+  model_.clear();
+  queue_.clear();
+  results_.clear();
+}
+
+HighsStatus HighsBatchSolver::loadModel(
+    Solver& solver, const std::shared_ptr<const HighsModel>& model) {
+  if (solver.model == model) return HighsStatus::kOk;
+  Highs& highs = solver.highs;
+  const bool compatible = solver.model && sameStructure(*solver.model, *model);
+  solver.model = nullptr;
+  solver.delta = nullptr;
+  HighsStatus return_status = HighsStatus::kOk;
+  if (compatible) {
+    // Change all costs, bounds and integrality, overwriting any delta
+    const HighsLp& lp = model->lp_;
+    if (lp.num_col_ > 0) {
+      return_status = worseStatus(
+          highs.changeColsCost(0, lp.num_col_ - 1, lp.col_cost_.data()),
+          return_status);
+      return_status = worseStatus(
+          highs.changeColsBounds(0, lp.num_col_ - 1, lp.col_lower_.data(),
+                                 lp.col_upper_.data()),
+          return_status);
+      if (lp.integrality_.size())
+        return_status =
+            worseStatus(highs.changeColsIntegrality(0, lp.num_col_ - 1,
+                                                    lp.integrality_.data()),
+                        return_status);
+    }
+    if (lp.num_row_ > 0)
+      return_status = worseStatus(
+          highs.changeRowsBounds(0, lp.num_row_ - 1, lp.row_lower_.data(),
+                                 lp.row_upper_.data()),
+          return_status);
+    return_status = worseStatus(highs.changeObjectiveOffset(lp.offset_),
+                                return_status);
+  } else {
+    return_status = highs.passModel(*model);
+  }
+  if (return_status != HighsStatus::kError) solver.model = model;
+  return return_status;
+}
+
+HighsStatus HighsBatchSolver::applyDelta(
+    Solver& solver, const std::shared_ptr<const HighsBatchDelta>& delta) {
+  if (solver.delta == delta) return HighsStatus::kOk;
+  Highs& highs = solver.highs;
+  HighsStatus return_status = HighsStatus::kOk;
+  if (solver.delta) {
+    // Restore the values changed by the previous delta
+    const HighsBatchDelta& previous = *solver.delta;
+    const HighsLp& lp = solver.model->lp_;
+    HighsBatchDelta restore;
+    for (const HighsInt iCol : previous.cost_index)
+      restore.cost_value.push_back(lp.col_cost_[iCol]);
+    for (const HighsInt iCol : previous.col_index) {
+      restore.col_lower.push_back(lp.col_lower_[iCol]);
+      restore.col_upper.push_back(lp.col_upper_[iCol]);
+    }
+    for (const HighsInt iRow : previous.row_index) {
+      restore.row_lower.push_back(lp.row_lower_[iRow]);
+      restore.row_upper.push_back(lp.row_upper_[iRow]);
+    }
+    if (previous.cost_index.size())
+      return_status = worseStatus(
+          highs.changeColsCost(previous.cost_index.size(),
+                               previous.cost_index.data(),
+                               restore.cost_value.data()),
+          return_status);
+    if (previous.col_index.size())
+      return_status = worseStatus(
+          highs.changeColsBounds(
+              previous.col_index.size(), previous.col_index.data(),
+              restore.col_lower.data(), restore.col_upper.data()),
+          return_status);
+    if (previous.row_index.size())
+      return_status = worseStatus(
+          highs.changeRowsBounds(
+              previous.row_index.size(), previous.row_index.data(),
+              restore.row_lower.data(), restore.row_upper.data()),
+          return_status);
+  }
+  solver.delta = nullptr;
+  if (!delta) return return_status;
+  if (delta->cost_index.size())
+    return_status = worseStatus(
+        highs.changeColsCost(delta->cost_index.size(),
+                             delta->cost_index.data(),
+                             delta->cost_value.data()),
+        return_status);
+  if (delta->col_index.size())
+    return_status = worseStatus(
+        highs.changeColsBounds(delta->col_index.size(),
+                               delta->col_index.data(),
+                               delta->col_lower.data(),
+                               delta->col_upper.data()),
+        return_status);
+  if (delta->row_index.size())
+    return_status = worseStatus(
+        highs.changeRowsBounds(delta->row_index.size(),
+                               delta->row_index.data(),
+                               delta->row_lower.data(),
+                               delta->row_upper.data()),
+        return_status);
+  solver.delta = delta;
+  return return_status;
+}
+
+void HighsBatchSolver::solveJob(Solver& solver, const Job& job,
+                                HighsBatchResult& result) {
+  Highs& highs = solver.highs;
+  result.id = job.id;
+  HighsStatus return_status = HighsStatus::kOk;
+  if (solver.options_version != options_version_) {
+    return_status = highs.passOptions(options_);
+    solver.options_version = options_version_;
+  }
+  if (return_status != HighsStatus::kError)
+    return_status = worseStatus(loadModel(solver, job.model), return_status);
+  if (return_status != HighsStatus::kError)
+    return_status = worseStatus(applyDelta(solver, job.delta), return_status);
+  if (return_status == HighsStatus::kError) {
+    // Don't rely on the state of the instance for later models
+    solver.model = nullptr;
+    solver.delta = nullptr;
+    result.run_status = HighsStatus::kError;
+    result.model_status = HighsModelStatus::kLoadError;
+    result.info.invalidate();
+    result.solution.clear();
+    result.basis.clear();
+    result.run_time = 0;
+    return;
+  }
+  result.run_status = worseStatus(highs.run(), return_status);
+  result.model_status = highs.getModelStatus();
+  result.info = highs.getInfo();
+  result.solution = highs.getSolution();
+  result.basis = highs.getBasis();
+  result.run_time = highs.getRunTime();
+}
+
+HighsStatus HighsBatchSolver::run(const HighsBatchCallback& callback) {
+  results_.clear();
+  const HighsInt num_job = queue_.size();
+  if (num_job == 0) return HighsStatus::kOk;
+  highs::parallel::initialize_scheduler(options_.threads);
+  const HighsInt num_solver =
+      std::min(HighsInt(highs::parallel::num_threads()), num_job);
+  while (HighsInt(solver_.size()) < num_solver)
+    solver_.emplace_back(new Solver());
+
+  // Order the models so that deltas follow their base model, and
+  // split them into chunks that are solved by one instance, so that
+  // consecutive deltas of a model reuse its basis and factorization
+  auto key = [&](const HighsInt iJob) {
+    return queue_[iJob].base_id >= 0 ? queue_[iJob].base_id : queue_[iJob].id;
+  };
+  std::vector<HighsInt> order(num_job);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&key](const HighsInt job0, const HighsInt job1) {
+                     return key(job0) < key(job1);
+                   });
+  const HighsInt max_chunk_size =
+      std::max(HighsInt{1}, num_job / (4 * num_solver));
+  std::vector<HighsInt> chunk_start;
+  for (HighsInt k = 0; k < num_job; k++) {
+    if (k == 0 || key(order[k]) != key(order[k - 1]) ||
+        k - chunk_start.back() == max_chunk_size)
+      chunk_start.push_back(k);
+  }
+  const HighsInt num_chunk = chunk_start.size();
+  chunk_start.push_back(num_job);
+
+  if (!callback) results_.resize(num_job);
+  std::vector<HighsStatus> solver_status(num_solver, HighsStatus::kOk);
+  std::atomic<HighsInt> next_chunk{0};
+  std::mutex callback_mutex;
+  highs::parallel::for_each(
+      0, num_solver, [&](HighsInt from_solver, HighsInt to_solver) {
+        for (HighsInt iSolver = from_solver; iSolver < to_solver; iSolver++) {
+          Solver& solver = *solver_[iSolver];
+          HighsBatchResult callback_result;
+          for (;;) {
+            const HighsInt iChunk = next_chunk.fetch_add(1);
+            if (iChunk >= num_chunk) break;
+            for (HighsInt k = chunk_start[iChunk]; k < chunk_start[iChunk + 1];
+                 k++) {
+              const HighsInt iJob = order[k];
+              HighsBatchResult& result =
+                  callback ? callback_result : results_[iJob];
+              solveJob(solver, queue_[iJob], result);
+              solver_status[iSolver] =
+                  worseStatus(result.run_status, solver_status[iSolver]);
+              if (callback) {
+                std::lock_guard<std::mutex> lock(callback_mutex);
+                callback(result);
+              }
+            }
+          }
+        }
+      });
+  queue_.clear();
+  HighsStatus return_status = HighsStatus::kOk;
+  for (const HighsStatus status : solver_status)
+    return_status = worseStatus(status, return_status);
+  return return_status;
+}
@@ -0,0 +1,133 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsBatchSolver.h
+ * @brief Solves batches of models with a pool of reusable Highs instances
+ */
+#ifndef LP_DATA_HIGHSBATCHSOLVER_H_
+#define LP_DATA_HIGHSBATCHSOLVER_H_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Highs.h"
+
+// Changes to the costs and bounds of a model previously added to a
+// batch solver
+struct HighsBatchDelta {
+  std::vector<HighsInt> cost_index;
+  std::vector<double> cost_value;
+  std::vector<HighsInt> col_index;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  std::vector<HighsInt> row_index;
+  std::vector<double> row_lower;
+  std::vector<double> row_upper;
+  void clear();
+};
+
+struct HighsBatchResult {
+  HighsInt id = -1;
+  HighsStatus run_status = HighsStatus::kError;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  HighsInfo info;
+  HighsSolution solution;
+  HighsBasis basis;
+  double run_time = 0;
+};
+
+// Called as each model is solved. Calls are serialized, but may be
+// made from any thread
+typedef std::function<void(const HighsBatchResult&)> HighsBatchCallback;
+
+class HighsBatchSolver {
+ public:
+  HighsBatchSolver();
+
+  // Options are applied to every model. By default there is no
+  // logging, since models are solved concurrently
+  HighsStatus setOptionValue(const std::string& option, const bool value);
+  HighsStatus setOptionValue(const std::string& option, const HighsInt value);
+#ifdef HIGHSINT64
+  HighsStatus setOptionValue(const std::string& option, const int value) {
+    return setOptionValue(option, HighsInt{value});
+  }
+#endif
+  HighsStatus setOptionValue(const std::string& option, const double value);
+  HighsStatus setOptionValue(const std::string& option,
+                             const std::string& value);
+  HighsStatus setOptionValue(const std::string& option, const char* value);
+  HighsStatus passOptions(const HighsOptions& options);
+  const HighsOptions& getOptions() const { return options_; }
+
+  // Queue a model to be solved, returning its identifier
+  HighsInt addModel(HighsModel model);
+  HighsInt addModel(HighsLp lp);
+
+  // Queue a model defined by changes to the costs and bounds of a
+  // model added previously (with addModel), returning its identifier,
+  // or -1 if there is no such model. Solver instances that already
+  // hold the base model are reused, so that the solve starts from
+  // their basis and factorization
+  HighsInt addModelDelta(const HighsInt base_id, HighsBatchDelta delta);
+
+  // Solve the queued models, calling any callback with the result of
+  // each, and otherwise keeping the results. Returns the worst status
+  // from solving the models
+  HighsStatus run(const HighsBatchCallback& callback = nullptr);
+
+  // Results kept by the last call to run(), in the order that the
+  // models were added
+  const std::vector<HighsBatchResult>& getResults() const {
+    return results_;
+  }
+
+  // Number of models queued by addModel/addModelDelta since the last
+  // call to run()
+  HighsInt getNumQueued() const { return HighsInt(queue_.size()); }
+
+  // Discard any queued models, kept results and models held for
+  // addModelDelta, retaining the options and solver instances
+  void clear();
+
+ private:
+  struct Job {
+    HighsInt id;
+    HighsInt base_id;
+    std::shared_ptr<const HighsModel> model;
+    std::shared_ptr<const HighsBatchDelta> delta;
+  };
+  struct Solver {
+    Highs highs;
+    HighsInt options_version = -1;
+    // The model loaded in highs, and any delta applied to it
+    std::shared_ptr<const HighsModel> model;
+    std::shared_ptr<const HighsBatchDelta> delta;
+  };
+
+  HighsStatus optionChangeAction(const OptionStatus status);
+  HighsStatus loadModel(Solver& solver,
+                        const std::shared_ptr<const HighsModel>& model);
+  HighsStatus applyDelta(Solver& solver,
+                         const std::shared_ptr<const HighsBatchDelta>& delta);
+  void solveJob(Solver& solver, const Job& job, HighsBatchResult& result);
+
+  HighsOptions options_;
+  HighsInt options_version_ = 0;
+  HighsInt next_id_ = 0;
+  // Models that can be the base for a delta, indexed by identifier
+  std::vector<std::shared_ptr<const HighsModel>> model_;
+  std::vector<Job> queue_;
+  std::vector<std::unique_ptr<Solver>> solver_;
+  std::vector<HighsBatchResult> results_;
+};
+
+#endif  // LP_DATA_HIGHSBATCHSOLVER_H_
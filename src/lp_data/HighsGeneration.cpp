@@ -0,0 +1,170 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsGeneration.cpp
+ * @brief Generation of columns and rows of an LP by callback
+ */
+#include "lp_data/HighsGeneration.h"
+
+#include "Highs.h"
+
+void HighsGeneration::addCol(const double cost, const double lower,
+                             const double upper, const HighsInt num_nz,
+                             const HighsInt* index, const double* value) {
+  col_cost.push_back(cost);
+  col_lower.push_back(lower);
+  col_upper.push_back(upper);
+  col_start.push_back(HighsInt(col_index.size()));
+  col_index.insert(col_index.end(), index, index + num_nz);
+  col_value.insert(col_value.end(), value, value + num_nz);
+}
+
+void HighsGeneration::addRow(const double lower, const double upper,
+                             const HighsInt num_nz, const HighsInt* index,
+                             const double* value) {
+  row_lower.push_back(lower);
+  row_upper.push_back(upper);
+  row_start.push_back(HighsInt(row_index.size()));
+  row_index.insert(row_index.end(), index, index + num_nz);
+  row_value.insert(row_value.end(), value, value + num_nz);
+}
+
+void HighsGeneration::clear() {
+  col_cost.clear();
+  col_lower.clear();
+  col_upper.clear();
+  col_start.clear();
+  col_index.clear();
+  col_value.clear();
+  row_lower.clear();
+  row_upper.clear();
+  row_start.clear();
+  row_index.clear();
+  row_value.clear();
+}
+
+HighsStatus Highs::generate(const HighsGenerationCallback& callback,
+                            const HighsInt max_round) {
+  generation_round_.clear();
+  if (!callback) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Highs::generate() called without a callback\n");
+    return HighsStatus::kError;
+  }
+  if (model_.isMip() || model_.isQp()) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Highs::generate() is only for LPs\n");
+    return HighsStatus::kError;
+  }
+  // Keep the simplex basis, factorization and edge weights when
+  // columns and rows are added, so that each LP is solved from where
+  // the previous one finished
+  const bool save_simplex_extend_invert = options_.simplex_extend_invert;
+  const bool save_dual_steepest_edge_weight_keep =
+      options_.dual_steepest_edge_weight_keep;
+  options_.simplex_extend_invert = true;
+  options_.dual_steepest_edge_weight_keep = true;
+
+  HighsStatus return_status = HighsStatus::kOk;
+  HighsGeneration generation;
+  for (HighsInt round = 0;; round++) {
+    HighsGenerationRound record;
+    generation.clear();
+    // If the dual simplex solver cleans up the solution of the
+    // incumbent LP, generate from the primal feasible solution before
+    // cleanup, concurrently with it
+    const size_t num_col = model_.lp_.num_col_;
+    const size_t num_row = model_.lp_.num_row_;
+    if (round < max_round)
+      ekk_instance_.cleanup_callback_ = [&](const HighsSolution& solution) {
+        if (record.speculative || solution.col_value.size() != num_col ||
+            solution.row_value.size() != num_row)
+          return;
+        record.speculative = true;
+        callback(solution, generation);
+      };
+    double start_time = timer_.getWallTime();
+    return_status =
+        interpretCallStatus(options_.log_options, run(), return_status, "run");
+    ekk_instance_.cleanup_callback_ = nullptr;
+    record.solve_time = timer_.getWallTime() - start_time;
+    record.model_status = model_status_;
+    record.objective_function_value = info_.objective_function_value;
+    record.simplex_iteration_count = info_.simplex_iteration_count;
+    const bool optimal = return_status != HighsStatus::kError &&
+                         model_status_ == HighsModelStatus::kOptimal;
+    if (!optimal) {
+      // Discard anything generated speculatively
+      record.speculative = false;
+      generation.clear();
+    } else if (round < max_round && generation.empty()) {
+      // Nothing was generated speculatively, so generate from the
+      // optimal solution
+      record.speculative = false;
+      start_time = timer_.getWallTime();
+      callback(solution_, generation);
+      record.generate_time = timer_.getWallTime() - start_time;
+    }
+    record.num_new_col = generation.numCol();
+    record.num_new_row = generation.numRow();
+    if (!generation.empty()) {
+      start_time = timer_.getWallTime();
+      clearPresolve();
+      if (generation.numCol())
+        return_status = interpretCallStatus(
+            options_.log_options,
+            addColsInterface(generation.numCol(), generation.col_cost.data(),
+                             generation.col_lower.data(),
+                             generation.col_upper.data(),
+                             generation.col_index.size(),
+                             generation.col_start.data(),
+                             generation.col_index.data(),
+                             generation.col_value.data()),
+            return_status, "addCols");
+      if (return_status != HighsStatus::kError && generation.numRow())
+        return_status = interpretCallStatus(
+            options_.log_options,
+            addRowsInterface(generation.numRow(), generation.row_lower.data(),
+                             generation.row_upper.data(),
+                             generation.row_index.size(),
+                             generation.row_start.data(),
+                             generation.row_index.data(),
+                             generation.row_value.data()),
+            return_status, "addRows");
+      record.add_time = timer_.getWallTime() - start_time;
+    }
+    generation_round_.push_back(record);
+    highsLogUser(
+        options_.log_options, HighsLogType::kInfo,
+        "Generation round %" HIGHSINT_FORMAT
+        ": objective %.10g after %" HIGHSINT_FORMAT
+        " iterations; %" HIGHSINT_FORMAT " columns and %" HIGHSINT_FORMAT
+        " rows%s added; time: solve %.3gs, generate %.3gs, add %.3gs\n",
+        round, record.objective_function_value, record.simplex_iteration_count,
+        record.num_new_col, record.num_new_row,
+        record.speculative ? " generated speculatively" : "", record.solve_time,
+        record.generate_time, record.add_time);
+    if (return_status == HighsStatus::kError || !optimal) break;
+    if (generation.empty()) {
+      if (round >= max_round) {
+        highsLogUser(options_.log_options, HighsLogType::kWarning,
+                     "Highs::generate() has reached the limit of "
+                     "%" HIGHSINT_FORMAT " rounds\n",
+                     max_round);
+        return_status = HighsStatus::kWarning;
+      }
+      break;
+    }
+  }
+  options_.simplex_extend_invert = save_simplex_extend_invert;
+  options_.dual_steepest_edge_weight_keep =
+      save_dual_steepest_edge_weight_keep;
+  return returnFromHighs(return_status);
+}
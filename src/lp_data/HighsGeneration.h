@@ -0,0 +1,72 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsGeneration.h
+ * @brief Data for generating columns and rows of an LP by callback
+ */
+#ifndef LP_DATA_HIGHSGENERATION_H_
+#define LP_DATA_HIGHSGENERATION_H_
+
+#include <functional>
+#include <vector>
+
+#include "lp_data/HStruct.h"
+
+// Columns and rows generated in a round, held as for Highs::addCols
+// and Highs::addRows. Columns are added first, so rows may have
+// entries in generated columns
+struct HighsGeneration {
+  std::vector<double> col_cost;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  std::vector<HighsInt> col_start;
+  std::vector<HighsInt> col_index;
+  std::vector<double> col_value;
+  std::vector<double> row_lower;
+  std::vector<double> row_upper;
+  std::vector<HighsInt> row_start;
+  std::vector<HighsInt> row_index;
+  std::vector<double> row_value;
+  void addCol(const double cost, const double lower, const double upper,
+              const HighsInt num_nz, const HighsInt* index,
+              const double* value);
+  void addRow(const double lower, const double upper, const HighsInt num_nz,
+              const HighsInt* index, const double* value);
+  HighsInt numCol() const { return HighsInt(col_cost.size()); }
+  HighsInt numRow() const { return HighsInt(row_lower.size()); }
+  bool empty() const { return numCol() + numRow() == 0; }
+  void clear();
+};
+
+// Record of a round of generation
+struct HighsGenerationRound {
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_function_value = 0;
+  HighsInt simplex_iteration_count = 0;
+  HighsInt num_new_col = 0;
+  HighsInt num_new_row = 0;
+  // Whether the columns and rows were generated from the solution
+  // before simplex cleanup, concurrently with it
+  bool speculative = false;
+  // Time to solve the LP, including any concurrent generation, to
+  // generate from the optimal solution, and to add to the LP
+  double solve_time = 0;
+  double generate_time = 0;
+  double add_time = 0;
+};
+
+// Called with an optimal solution of the LP, or a primal feasible
+// solution before simplex cleanup. Columns and rows are appended to
+// the generation. Calls are serialized, but may be made from any
+// thread
+typedef std::function<void(const HighsSolution&, HighsGeneration&)>
+    HighsGenerationCallback;
+
+#endif  // LP_DATA_HIGHSGENERATION_H_
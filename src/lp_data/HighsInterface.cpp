@@ -11,12 +11,16 @@
 /**@file lp_data/HighsInterface.cpp
  * @brief
  */
+#include <cinttypes>
+#include <cmath>
 #include <sstream>
 
 #include "Highs.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
 #include "model/HighsHessianUtils.h"
+#include "model/HighsModelComponents.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HSimplex.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
@@ -231,11 +235,6 @@ HighsStatus Highs::addRowsInterface(HighsInt ext_num_new_row,
   // addRows is fundamentally different from addCols, since the new
   // matrix data are held row-wise, so we have to insert data into the
   // column-wise matrix of the LP.
-  if (kExtendInvertWhenAddingRows) {
-    if (ekk_instance_.status_.has_nla)
-      ekk_instance_.debugNlaCheckInvert("Start of Highs::addRowsInterface",
-                                        kHighsDebugLevelExpensive + 1);
-  }
   HighsStatus return_status = HighsStatus::kOk;
   HighsOptions& options = options_;
   if (ext_num_new_row < 0) return HighsStatus::kError;
@@ -856,8 +855,16 @@ void Highs::changeCoefficientInterface(const HighsInt ext_row,
     this->basis_.alien = true;
   }
 
-  // Determine any implications for simplex data
-  ekk_instance_.updateStatus(LpAction::kNewRows);
+  // Determine any implications for simplex data. If the column is
+  // nonbasic in the simplex basis then the basis matrix is unchanged,
+  // so its factorization can be kept
+  const HighsSimplexStatus& ekk_status = ekk_instance_.status_;
+  const bool keep_invert =
+      options_.simplex_extend_invert && ekk_status.has_invert &&
+      ekk_status.has_basis &&
+      ekk_instance_.basis_.nonbasicFlag_[ext_col] == kNonbasicFlagTrue;
+  ekk_instance_.updateStatus(keep_invert ? LpAction::kKeepInvert
+                                         : LpAction::kNewRows);
 }
 
 HighsStatus Highs::scaleColInterface(const HighsInt col,
@@ -2527,3 +2534,270 @@ bool Highs::infeasibleBoundsOk() {
                  int(num_true_infeasible_bound));
   return num_true_infeasible_bound == 0;
 }
+
+HighsStatus Highs::solveComponents(bool& decomposed) {
+  decomposed = false;
+  const HighsLp& lp = model_.lp_;
+  const bool solve_mip = model_.isMip() && !options_.solve_relaxation &&
+                         options_.solver == kHighsChooseString;
+  // The components are solved independently, so any callback,
+  // objective bound or objective target would only apply to each
+  // component
+  if (callback_.user_callback || lp.hasSemiVariables() ||
+      (solve_mip && model_.isQp()) || options_.objective_bound < kHighsInf ||
+      options_.objective_target > -kHighsInf)
+    return HighsStatus::kOk;
+  HighsBlockStructure structure;
+  ::getBlockStructure(model_, false, structure);
+  if (structure.num_block < 2) return HighsStatus::kOk;
+
+  // Gather consecutive blocks into groups, each with at least a
+  // fraction of the columns and nonzeros of the model, so that
+  // trivial components are not solved individually
+  const HighsInt kMaxNumGroup = 64;
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsSparseMatrix& matrix = lp.a_matrix_;
+  std::vector<HighsInt> block_size(structure.num_block, 0);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++)
+    block_size[structure.col_block[iCol]] +=
+        1 + matrix.start_[iCol + 1] - matrix.start_[iCol];
+  const HighsInt min_group_size =
+      (HighsInt(num_col) + matrix.numNz()) / kMaxNumGroup;
+  std::vector<HighsInt> block_group(structure.num_block);
+  HighsInt num_group = 0;
+  HighsInt group_size = 0;
+  for (HighsInt iBlock = 0; iBlock < structure.num_block; iBlock++) {
+    block_group[iBlock] = num_group;
+    group_size += block_size[iBlock];
+    if (group_size >= min_group_size) {
+      num_group++;
+      group_size = 0;
+    }
+  }
+  if (group_size > 0) num_group++;
+  if (num_group < 2) return HighsStatus::kOk;
+  decomposed = true;
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Model has %d independent components: solving them as %d "
+               "separate models\n",
+               int(structure.num_block), int(num_group));
+
+  std::vector<std::vector<HighsInt>> group_col(num_group);
+  std::vector<std::vector<HighsInt>> group_row(num_group);
+  std::vector<HighsInt> local_col(num_col);
+  std::vector<HighsInt> local_row(num_row);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    std::vector<HighsInt>& col =
+        group_col[block_group[structure.col_block[iCol]]];
+    local_col[iCol] = col.size();
+    col.push_back(iCol);
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    std::vector<HighsInt>& row =
+        group_row[block_group[structure.row_block[iRow]]];
+    local_row[iRow] = row.size();
+    row.push_back(iRow);
+  }
+
+  HighsOptions group_options = options_;
+  group_options.output_flag = false;
+  group_options.log_to_console = false;
+  group_options.log_file = "";
+  group_options.solve_components = false;
+  group_options.time_limit =
+      std::max(0.0, options_.time_limit - timer_.readRunHighsClock());
+  std::vector<HighsModelStatus> group_status(num_group);
+  std::vector<HighsSolution> group_solution(num_group);
+  std::vector<HighsBasis> group_basis(num_group);
+  std::vector<HighsInfo> group_info(num_group);
+  auto solveGroup = [&](HighsInt from_group, HighsInt to_group) {
+    for (HighsInt iGroup = from_group; iGroup < to_group; iGroup++) {
+      const std::vector<HighsInt>& col = group_col[iGroup];
+      const std::vector<HighsInt>& row = group_row[iGroup];
+      HighsModel component;
+      extractComponentModel(model_, col, row, local_col, local_row, component);
+      Highs highs;
+      highs.passOptions(group_options);
+      highs.passModel(std::move(component));
+      // Pass on any basis or solution to warm start the component
+      if (basis_.valid) {
+        HighsBasis basis;
+        basis.col_status.resize(col.size());
+        basis.row_status.resize(row.size());
+        for (size_t iCol = 0; iCol < col.size(); iCol++)
+          basis.col_status[iCol] = basis_.col_status[col[iCol]];
+        for (size_t iRow = 0; iRow < row.size(); iRow++)
+          basis.row_status[iRow] = basis_.row_status[row[iRow]];
+        basis.valid = true;
+        highs.setBasis(basis, "solveComponents");
+      }
+      if (solution_.value_valid) {
+        HighsSolution solution;
+        solution.col_value.resize(col.size());
+        for (size_t iCol = 0; iCol < col.size(); iCol++)
+          solution.col_value[iCol] = solution_.col_value[col[iCol]];
+        solution.value_valid = true;
+        highs.setSolution(solution);
+      }
+      highs.run();
+      group_status[iGroup] = highs.getModelStatus();
+      group_solution[iGroup] = highs.getSolution();
+      group_basis[iGroup] = highs.getBasis();
+      group_info[iGroup] = highs.getInfo();
+    }
+  };
+  highs::parallel::for_each(0, num_group, solveGroup);
+
+  // The model is infeasible if any component is infeasible, and
+  // otherwise takes the status of the first component that is not
+  // optimal
+  model_status_ = HighsModelStatus::kOptimal;
+  for (HighsInt iGroup = 0; iGroup < num_group; iGroup++) {
+    if (group_status[iGroup] == HighsModelStatus::kInfeasible) {
+      model_status_ = HighsModelStatus::kInfeasible;
+      break;
+    }
+    if (model_status_ == HighsModelStatus::kOptimal)
+      model_status_ = group_status[iGroup];
+  }
+  const HighsStatus return_status =
+      highsStatusFromHighsModelStatus(model_status_);
+  if (return_status == HighsStatus::kError) return return_status;
+
+  // Assemble the solution and basis from those of the components, if
+  // all are available
+  bool value_valid = true;
+  bool dual_valid = true;
+  bool basis_valid = true;
+  for (HighsInt iGroup = 0; iGroup < num_group; iGroup++) {
+    value_valid = value_valid && group_solution[iGroup].value_valid;
+    dual_valid = dual_valid && group_solution[iGroup].dual_valid;
+    basis_valid = basis_valid && group_basis[iGroup].valid;
+  }
+  dual_valid = dual_valid && value_valid;
+  invalidateSolution();
+  invalidateBasis();
+  if (value_valid) {
+    solution_.col_value.resize(num_col);
+    solution_.row_value.resize(num_row);
+    if (dual_valid) {
+      solution_.col_dual.resize(num_col);
+      solution_.row_dual.resize(num_row);
+    }
+    for (HighsInt iGroup = 0; iGroup < num_group; iGroup++) {
+      const HighsSolution& solution = group_solution[iGroup];
+      const std::vector<HighsInt>& col = group_col[iGroup];
+      const std::vector<HighsInt>& row = group_row[iGroup];
+      for (size_t iCol = 0; iCol < col.size(); iCol++) {
+        solution_.col_value[col[iCol]] = solution.col_value[iCol];
+        if (dual_valid)
+          solution_.col_dual[col[iCol]] = solution.col_dual[iCol];
+      }
+      for (size_t iRow = 0; iRow < row.size(); iRow++) {
+        solution_.row_value[row[iRow]] = solution.row_value[iRow];
+        if (dual_valid)
+          solution_.row_dual[row[iRow]] = solution.row_dual[iRow];
+      }
+    }
+    solution_.value_valid = true;
+    solution_.dual_valid = dual_valid;
+  }
+  if (basis_valid) {
+    basis_.col_status.resize(num_col);
+    basis_.row_status.resize(num_row);
+    for (HighsInt iGroup = 0; iGroup < num_group; iGroup++) {
+      const HighsBasis& basis = group_basis[iGroup];
+      const std::vector<HighsInt>& col = group_col[iGroup];
+      const std::vector<HighsInt>& row = group_row[iGroup];
+      for (size_t iCol = 0; iCol < col.size(); iCol++)
+        basis_.col_status[col[iCol]] = basis.col_status[iCol];
+      for (size_t iRow = 0; iRow < row.size(); iRow++)
+        basis_.row_status[row[iRow]] = basis.row_status[iRow];
+    }
+    basis_.valid = true;
+    basis_.alien = false;
+    basis_.was_alien = false;
+  }
+
+  // Accumulate the objective, iteration counts and, for a MIP, the
+  // dual bound
+  const double unbounded_dual_bound =
+      lp.sense_ == ObjSense::kMinimize ? -kHighsInf : kHighsInf;
+  info_.objective_function_value = lp.offset_;
+  info_.mip_dual_bound = lp.offset_;
+  info_.max_integrality_violation = 0;
+  info_.simplex_iteration_count = 0;
+  info_.ipm_iteration_count = 0;
+  info_.crossover_iteration_count = 0;
+  info_.pdlp_iteration_count = 0;
+  info_.qp_iteration_count = 0;
+  info_.mip_node_count = 0;
+  for (HighsInt iGroup = 0; iGroup < num_group; iGroup++) {
+    const HighsInfo& info = group_info[iGroup];
+    info_.objective_function_value += info.objective_function_value;
+    info_.simplex_iteration_count +=
+        std::max(HighsInt{0}, info.simplex_iteration_count);
+    info_.ipm_iteration_count +=
+        std::max(HighsInt{0}, info.ipm_iteration_count);
+    info_.crossover_iteration_count +=
+        std::max(HighsInt{0}, info.crossover_iteration_count);
+    info_.pdlp_iteration_count +=
+        std::max(HighsInt{0}, info.pdlp_iteration_count);
+    info_.qp_iteration_count += std::max(HighsInt{0}, info.qp_iteration_count);
+    if (!solve_mip) continue;
+    // Components without integer variables are solved as LPs, so
+    // their dual bound is their optimal objective
+    if (info.mip_node_count >= 0) {
+      info_.mip_node_count += info.mip_node_count;
+      info_.mip_dual_bound += info.mip_dual_bound;
+      info_.max_integrality_violation = std::max(
+          info.max_integrality_violation, info_.max_integrality_violation);
+    } else if (group_status[iGroup] == HighsModelStatus::kOptimal) {
+      info_.mip_dual_bound += info.objective_function_value;
+    } else {
+      info_.mip_dual_bound += unbounded_dual_bound;
+    }
+  }
+  double primal_feasibility_tolerance = options_.primal_feasibility_tolerance;
+  if (solve_mip) {
+    const double primal_bound =
+        value_valid ? info_.objective_function_value : -unbounded_dual_bound;
+    if (primal_bound == 0.0) {
+      info_.mip_gap = info_.mip_dual_bound == 0.0 ? 0.0 : kHighsInf;
+    } else if (std::fabs(primal_bound) < kHighsInf) {
+      info_.mip_gap = std::fabs(primal_bound - info_.mip_dual_bound) /
+                      std::fabs(primal_bound);
+    } else {
+      info_.mip_gap = kHighsInf;
+    }
+    options_.primal_feasibility_tolerance = options_.mip_feasibility_tolerance;
+  }
+  // NB getKktFailures sets the primal and dual solution status
+  getKktFailures(options_, model_, solution_, basis_, info_);
+  options_.primal_feasibility_tolerance = primal_feasibility_tolerance;
+  info_.basis_validity =
+      basis_.valid ? kBasisValidityValid : kBasisValidityInvalid;
+  info_.valid = true;
+  // The MIP solver reports on its solution, so do so for the
+  // components that are solved as MIPs
+  if (solve_mip) {
+    const HighsLogOptions& log_options = options_.log_options;
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Model   status      : %s\n",
+                 modelStatusToString(model_status_).c_str());
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Objective value     : %17.10e\n",
+                 info_.objective_function_value);
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Dual bound          : %17.10e\n", info_.mip_dual_bound);
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Gap                 : %17.10e\n", info_.mip_gap);
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "Nodes               : %" PRId64 "\n", info_.mip_node_count);
+    highsLogUser(log_options, HighsLogType::kInfo,
+                 "HiGHS run time      : %13.2f\n",
+                 timer_.readRunHighsClock());
+  }
+  return return_status;
+}
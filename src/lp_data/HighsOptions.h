@@ -258,6 +258,7 @@ void reportOption(FILE* file, const OptionRecordString& option,
 const string kSimplexString = "simplex";
 const string kIpmString = "ipm";
 const string kPdlpString = "pdlp";
+const string kConcurrentString = "concurrent";
 
 const HighsInt kKeepNRowsDeleteRows = -1;
 const HighsInt kKeepNRowsDeleteEntries = 0;
@@ -304,6 +305,7 @@ struct HighsOptionsStruct {
   double objective_bound;
   double objective_target;
   HighsInt threads;
+  bool solve_components;
   HighsInt user_bound_scale;
   HighsInt user_cost_scale;
   HighsInt highs_debug_level;
@@ -317,6 +319,7 @@ struct HighsOptionsStruct {
   HighsInt simplex_update_limit;
   HighsInt simplex_min_concurrency;
   HighsInt simplex_max_concurrency;
+  bool simplex_parallel_iteration;
 
   std::string log_file;
   bool write_model_to_file;
@@ -330,6 +333,7 @@ struct HighsOptionsStruct {
 
   // Options for IPM solver
   HighsInt ipm_iteration_limit;
+  HighsInt ipx_kkt_solver;
 
   // Options for PDLP solver
   bool pdlp_native_termination;
@@ -350,6 +354,8 @@ struct HighsOptionsStruct {
   bool use_implied_bounds_from_presolve;
   bool lp_presolve_requires_basis_postsolve;
   bool mps_parser_type_free;
+  bool mps_parser_mapped;
+  bool lp_parser_streaming;
   HighsInt keep_n_rows;
   HighsInt cost_scale_factor;
   HighsInt allowed_matrix_scale_factor;
@@ -370,14 +376,19 @@ struct HighsOptionsStruct {
   bool no_unnecessary_rebuild_refactor;
   double simplex_initial_condition_tolerance;
   double rebuild_refactor_solution_error_tolerance;
+  bool simplex_extend_invert;
   double dual_steepest_edge_weight_error_tolerance;
   double dual_steepest_edge_weight_log_error_threshold;
+  bool dual_steepest_edge_weight_block;
+  bool dual_steepest_edge_weight_keep;
   double dual_simplex_cost_perturbation_multiplier;
   double primal_simplex_bound_perturbation_multiplier;
+  bool primal_simplex_hyper_chuzc;
   double dual_simplex_pivot_growth_tolerance;
   double presolve_pivot_threshold;
   double factor_pivot_threshold;
   double factor_pivot_tolerance;
+  bool factor_reach_cache;
   double start_crossover_tolerance;
   bool less_infeasible_DSE_check;
   bool less_infeasible_DSE_choose_row;
@@ -408,6 +419,7 @@ struct HighsOptionsStruct {
   HighsInt mip_pool_soft_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
+  HighsInt mip_race_concurrency;
   HighsInt mip_report_level;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
@@ -445,6 +457,7 @@ struct HighsOptionsStruct {
         objective_bound(0.0),
         objective_target(0.0),
         threads(0),
+        solve_components(false),
         user_bound_scale(0),
         user_cost_scale(0),
         highs_debug_level(0),
@@ -458,6 +471,7 @@ struct HighsOptionsStruct {
         simplex_update_limit(0),
         simplex_min_concurrency(0),
         simplex_max_concurrency(0),
+        simplex_parallel_iteration(false),
         log_file(""),
         write_model_to_file(false),
         write_solution_to_file(false),
@@ -466,6 +480,7 @@ struct HighsOptionsStruct {
         output_flag(false),
         log_to_console(false),
         ipm_iteration_limit(0),
+        ipx_kkt_solver(0),
         pdlp_native_termination(false),
         pdlp_scaling(false),
         pdlp_iteration_limit(0),
@@ -480,6 +495,8 @@ struct HighsOptionsStruct {
         use_implied_bounds_from_presolve(false),
         lp_presolve_requires_basis_postsolve(false),
         mps_parser_type_free(false),
+        mps_parser_mapped(false),
+        lp_parser_streaming(false),
         keep_n_rows(0),
         cost_scale_factor(0),
         allowed_matrix_scale_factor(0),
@@ -500,14 +517,19 @@ struct HighsOptionsStruct {
         no_unnecessary_rebuild_refactor(false),
         simplex_initial_condition_tolerance(0.0),
         rebuild_refactor_solution_error_tolerance(0.0),
+        simplex_extend_invert(false),
         dual_steepest_edge_weight_error_tolerance(0.0),
         dual_steepest_edge_weight_log_error_threshold(0.0),
+        dual_steepest_edge_weight_block(false),
+        dual_steepest_edge_weight_keep(false),
         dual_simplex_cost_perturbation_multiplier(0.0),
         primal_simplex_bound_perturbation_multiplier(0.0),
+        primal_simplex_hyper_chuzc(false),
         dual_simplex_pivot_growth_tolerance(0.0),
         presolve_pivot_threshold(0.0),
         factor_pivot_threshold(0.0),
         factor_pivot_tolerance(0.0),
+        factor_reach_cache(false),
         start_crossover_tolerance(0.0),
         less_infeasible_DSE_check(false),
         less_infeasible_DSE_choose_row(false),
@@ -534,6 +556,7 @@ struct HighsOptionsStruct {
         mip_pool_soft_limit(0),
         mip_pscost_minreliable(0),
         mip_min_cliquetable_entries_for_parallelism(0),
+        mip_race_concurrency(0),
         mip_report_level(0),
         mip_feasibility_tolerance(0.0),
         mip_rel_gap(0.0),
@@ -613,8 +636,9 @@ class HighsOptions : public HighsOptionsStruct {
 
     record_string = new OptionRecordString(
         kSolverString,
-        "Solver option: \"simplex\", \"choose\", \"ipm\" or \"pdlp\". If "
-        "\"simplex\"/\"ipm\"/\"pdlp\" is chosen then, for a MIP (QP) the "
+        "Solver option: \"simplex\", \"choose\", \"ipm\", \"pdlp\" or "
+        "\"concurrent\". If \"simplex\"/\"ipm\"/\"pdlp\"/\"concurrent\" is "
+        "chosen then, for a MIP (QP) the "
         "integrality "
         "constraint (quadratic term) will be ignored",
         advanced, &solver, kHighsChooseString);
@@ -710,6 +734,13 @@ class HighsOptions : public HighsOptionsStruct {
         &threads, 0, 0, kHighsIInf);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "solve_components",
+        "Solve any independent components of the model separately, and in "
+        "parallel when threads are available",
+        advanced, &solve_components, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt(
         "user_bound_scale", "Exponent of power-of-two bound scaling for model",
         advanced, &user_bound_scale, -kHighsIInf, 0, kHighsIInf);
@@ -801,6 +832,13 @@ class HighsOptions : public HighsOptionsStruct {
                             kSimplexConcurrencyLimit, kSimplexConcurrencyLimit);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "simplex_parallel_iteration",
+        "Partition CHUZR, PRICE and CHUZC of the serial dual and primal "
+        "simplex across threads without changing their iterations",
+        advanced, &simplex_parallel_iteration, false);
+    records.push_back(record_bool);
+
     record_bool =
         new OptionRecordBool("output_flag", "Enables or disables solver output",
                              advanced, &output_flag, true);
@@ -992,6 +1030,14 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_race_concurrency",
+        "Number of MIP solvers with different random seeds racing on the "
+        "model, sharing improving solutions: the first to complete its search "
+        "determines the result",
+        advanced, &mip_race_concurrency, 1, 1, kHighsIInf);
+    records.push_back(record_int);
+
     record_int =
         new OptionRecordInt("mip_report_level", "MIP solver reporting level",
                             now_advanced, &mip_report_level, 0, 1, 2);
@@ -1031,6 +1077,15 @@ class HighsOptions : public HighsOptionsStruct {
         &ipm_iteration_limit, 0, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "ipx_kkt_solver",
+        "KKT solver for IPM solver: 0 => conjugate residuals with diagonal "
+        "then basis preconditioning; 1 => supernodal sparse Cholesky "
+        "factorization of the normal matrix",
+        advanced, &ipx_kkt_solver, kIpxKktSolverMin, kIpxKktSolverCr,
+        kIpxKktSolverMax);
+    records.push_back(record_int);
+
     record_bool = new OptionRecordBool(
         "pdlp_native_termination",
         "Use native termination for PDLP solver: Default = false", advanced,
@@ -1115,6 +1170,19 @@ class HighsOptions : public HighsOptionsStruct {
                                        advanced, &mps_parser_type_free, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "mps_parser_mapped",
+        "Use a memory map, and any available threads, in the free format MPS "
+        "file reader",
+        advanced, &mps_parser_mapped, true);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "lp_parser_streaming",
+        "Use the single pass streaming reader for LP files", advanced,
+        &lp_parser_streaming, true);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("keep_n_rows",
                             "For multiple N-rows in MPS files: delete rows / "
@@ -1212,6 +1280,14 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsInf);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "simplex_extend_invert",
+        "Extend the simplex basis matrix factorization when rows or columns "
+        "are added to the LP, and keep it when nonbasic matrix coefficients "
+        "are changed",
+        advanced, &simplex_extend_invert, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "dual_steepest_edge_weight_error_tolerance",
         "Tolerance on dual steepest edge weight errors", advanced,
@@ -1225,6 +1301,20 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsInf);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "dual_steepest_edge_weight_block",
+        "Compute exact dual steepest edge weights for blocks of rows, in "
+        "parallel when threads are available",
+        advanced, &dual_steepest_edge_weight_block, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "dual_steepest_edge_weight_keep",
+        "Keep dual steepest edge weights when rows or columns are added to "
+        "the LP",
+        advanced, &dual_steepest_edge_weight_keep, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "dual_simplex_cost_perturbation_multiplier",
         "Dual simplex cost perturbation multiplier: 0 => no perturbation",
@@ -1239,6 +1329,12 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsInf);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "primal_simplex_hyper_chuzc",
+        "Use hyper-sparse CHUZC in phase 2 of the primal simplex solver",
+        advanced, &primal_simplex_hyper_chuzc, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "dual_simplex_pivot_growth_tolerance",
         "Dual simplex pivot growth tolerance", advanced,
@@ -1293,6 +1389,13 @@ class HighsOptions : public HighsOptionsStruct {
         kDefaultPivotTolerance, kMaxPivotTolerance);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "factor_reach_cache",
+        "Cache the reach of hyper-sparse RHS patterns in matrix "
+        "factorization solves",
+        advanced, &factor_reach_cache, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "start_crossover_tolerance",
         "Tolerance to be satisfied before IPM crossover will start", advanced,
@@ -187,26 +187,73 @@ HighsStatus getRangingData(HighsRanging& ranging,
   vector<HighsInt> jci_dec(numRow, -1);
 
   // Major "theta" loop
+  //
+  // Unless the updated columns are expected to be sparse, they are
+  // formed in blocks, traversing the INVERT once for each block. The
+  // expected density is updated as the columns are formed
+  double expected_density = ekk_instance.info_.col_aq_density;
+  const HighsInt kMaxBlockSize = 16;
+  vector<HighsInt> block_col;
+  vector<double> block;
+  HighsInt block_count = 0;
+  HighsInt block_k = 0;
   for (HighsInt j = 0; j < numTotal; j++) {
     // Skip basic column
     if (!Nflag_[j]) continue;
 
-    // Form updated column
-    column.clear();
-    matrix.collectAj(column, j, 1);
-
-    const double expected_density = ekk_instance.info_.col_aq_density;
-    ekk_instance.ftran(column, expected_density);
+    if (block_k == block_count) {
+      block_count = 0;
+      block_k = 0;
+      if (kMaxBlockSize * expected_density >= kBlockTranMinDensity) {
+        // Form the updated columns for this and the next nonbasic
+        // columns
+        block_col.clear();
+        for (HighsInt jj = j;
+             jj < numTotal && (HighsInt)block_col.size() < kMaxBlockSize;
+             jj++)
+          if (Nflag_[jj]) block_col.push_back(jj);
+        block_count = block_col.size();
+        block.assign(numRow * block_count, 0);
+        for (HighsInt k = 0; k < block_count; k++) {
+          column.clear();
+          matrix.collectAj(column, block_col[k], 1);
+          for (HighsInt iX = 0; iX < column.count; iX++) {
+            const HighsInt iRow = column.index[iX];
+            block[iRow * block_count + k] = column.array[iRow];
+          }
+        }
+        ekk_instance.ftranBlock(block, block_count, expected_density);
+      }
+    }
     HighsInt nWork = 0;
-    for (HighsInt k = 0; k < column.count; k++) {
-      HighsInt iRow = column.index[k];
-      double alpha = column.array[iRow];
-      if (fabs(alpha) > tol_a) {
-        iWork_[nWork] = iRow;
-        dWork_[nWork] = alpha;
-        nWork++;
+    if (block_count == 0) {
+      // Form updated column
+      column.clear();
+      matrix.collectAj(column, j, 1);
+      ekk_instance.ftran(column, expected_density);
+      for (HighsInt k = 0; k < column.count; k++) {
+        HighsInt iRow = column.index[k];
+        double alpha = column.array[iRow];
+        if (fabs(alpha) > tol_a) {
+          iWork_[nWork] = iRow;
+          dWork_[nWork] = alpha;
+          nWork++;
+        }
+      }
+    } else {
+      assert(block_col[block_k] == j);
+      for (HighsInt iRow = 0; iRow < numRow; iRow++) {
+        double alpha = block[iRow * block_count + block_k];
+        if (fabs(alpha) > tol_a) {
+          iWork_[nWork] = iRow;
+          dWork_[nWork] = alpha;
+          nWork++;
+        }
       }
+      block_k++;
     }
+    expected_density = kRunningAverageMultiplier * nWork / numRow +
+                       (1 - kRunningAverageMultiplier) * expected_density;
     // Standard primal ratio test
     double myt_inc = +THETA_INF;
     double myt_dec = -THETA_INF;
@@ -12,8 +12,12 @@
  * @brief Class-independent utilities for HiGHS
  */
 
+#include <atomic>
+#include <memory>
+
 #include "ipm/IpxWrapper.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsParallel.h"
 #include "pdlp/CupdlpWrapper.h"
 #include "simplex/HApp.h"
 
@@ -45,6 +49,12 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
     return_status = interpretCallStatus(options.log_options, call_status,
                                         return_status, "solveUnconstrainedLp");
     if (return_status == HighsStatus::kError) return return_status;
+  } else if (options.solver == kConcurrentString && !options.run_centring) {
+    // Race simplex, IPM and PDLP
+    call_status = solveLpConcurrent(solver_object);
+    return_status = interpretCallStatus(options.log_options, call_status,
+                                        return_status, "solveLpConcurrent");
+    if (return_status == HighsStatus::kError) return return_status;
   } else if (options.solver == kIpmString || options.run_centring ||
              options.solver == kPdlpString) {
     // Use IPM or PDLP
@@ -200,6 +210,138 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
   return return_status;
 }
 
+// Data for one of the solvers racing in solveLpConcurrent. Other than
+// for simplex, which solves the incumbent LP, each solver has its own
+// copy of the LP and the data that solveLp modifies
+struct HighsLpRacer {
+  std::string solver;
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsInfo highs_info;
+  HEkk ekk_instance;
+  HighsCallback callback;
+  HighsOptions options;
+  HighsTimer timer;
+  HighsStatus return_status = HighsStatus::kError;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+};
+
+// Races dual simplex, IPX and PDLP on the LP, with as many solvers as
+// there are threads. The first solver to determine the model status
+// interrupts the others, and its solution and basis are returned
+HighsStatus solveLpConcurrent(HighsLpSolverObject& solver_object) {
+  HighsOptions& options = solver_object.options_;
+  const std::vector<std::string> racer_solver = {kSimplexString, kIpmString,
+                                                 kPdlpString};
+  const HighsInt num_racer =
+      std::min(HighsInt(racer_solver.size()),
+               HighsInt(highs::parallel::num_threads()));
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent solve racing %d solver%s\n", int(num_racer),
+               num_racer > 1 ? "s" : "");
+
+  // The solvers are interrupted via the simplex, IPM and PDLP
+  // interrupt callbacks once there is a winner
+  std::atomic<HighsInt> winner(-1);
+  std::atomic<bool> race_over(false);
+  HighsCallbackFunctionType race_interrupt =
+      [&race_over](int, const std::string&, const HighsCallbackDataOut*,
+                   HighsCallbackDataIn* data_in, void*) {
+        data_in->user_interrupt = race_over.load(std::memory_order_relaxed);
+      };
+  const double time_limit =
+      options.time_limit - solver_object.timer_.readRunHighsClock();
+
+  std::vector<std::unique_ptr<HighsLpRacer>> racer;
+  for (HighsInt iRacer = 0; iRacer < num_racer; iRacer++) {
+    racer.emplace_back(new HighsLpRacer());
+    HighsLpRacer& this_racer = *racer.back();
+    this_racer.solver = racer_solver[iRacer];
+    this_racer.callback.clear();
+    this_racer.callback.user_callback = race_interrupt;
+    this_racer.callback.active[kCallbackSimplexInterrupt] = true;
+    this_racer.callback.active[kCallbackIpmInterrupt] = true;
+    this_racer.callback.active[kCallbackPdlpInterrupt] = true;
+    this_racer.options = options;
+    this_racer.options.solver = this_racer.solver;
+    if (iRacer == 0) continue;
+    // Only simplex logs, and the other solvers have their own copy of
+    // the LP and their own timer
+    this_racer.options.output_flag = false;
+    this_racer.options.time_limit = time_limit;
+    this_racer.timer.startRunHighsClock();
+    this_racer.lp = solver_object.lp_;
+    this_racer.basis = solver_object.basis_;
+    this_racer.highs_info = solver_object.highs_info_;
+  }
+
+  auto finishRace = [&](HighsInt iRacer) {
+    const HighsModelStatus model_status = racer[iRacer]->model_status;
+    const bool determined =
+        racer[iRacer]->return_status != HighsStatus::kError &&
+        (model_status == HighsModelStatus::kOptimal ||
+         model_status == HighsModelStatus::kInfeasible ||
+         model_status == HighsModelStatus::kUnbounded ||
+         model_status == HighsModelStatus::kObjectiveBound ||
+         model_status == HighsModelStatus::kObjectiveTarget ||
+         (model_status == HighsModelStatus::kUnboundedOrInfeasible &&
+          options.allow_unbounded_or_infeasible));
+    if (!determined) return;
+    HighsInt no_winner = -1;
+    if (winner.compare_exchange_strong(no_winner, iRacer))
+      race_over.store(true, std::memory_order_relaxed);
+  };
+
+  highs::parallel::TaskGroup tg;
+  for (HighsInt iRacer = 1; iRacer < num_racer; iRacer++) {
+    tg.spawn([&, iRacer]() {
+      if (race_over.load(std::memory_order_relaxed)) return;
+      HighsLpRacer& this_racer = *racer[iRacer];
+      HighsLpSolverObject racer_object(
+          this_racer.lp, this_racer.basis, this_racer.solution,
+          this_racer.highs_info, this_racer.ekk_instance, this_racer.callback,
+          this_racer.options, this_racer.timer);
+      this_racer.return_status = solveLp(racer_object, "");
+      this_racer.model_status = racer_object.model_status_;
+      finishRace(iRacer);
+    });
+  }
+  // Simplex runs in this thread on the incumbent LP, so that it can
+  // exploit (and update) any simplex basis and factorization
+  HighsLpRacer& simplex_racer = *racer[0];
+  HighsLpSolverObject simplex_object(
+      solver_object.lp_, solver_object.basis_, solver_object.solution_,
+      solver_object.highs_info_, solver_object.ekk_instance_,
+      simplex_racer.callback, simplex_racer.options, solver_object.timer_);
+  simplex_racer.return_status = solveLp(simplex_object, "Concurrent simplex");
+  simplex_racer.model_status = simplex_object.model_status_;
+  finishRace(0);
+  tg.taskWait();
+  // Restore the EKK pointers to the callback and options of the
+  // incumbent solver object
+  solver_object.ekk_instance_.setPointers(&solver_object.callback_, &options,
+                                          &solver_object.timer_);
+
+  // If no solver has determined the model status, the simplex
+  // outcome is returned
+  const HighsInt race_winner = std::max(HighsInt(0), winner.load());
+  HighsLpRacer& winning_racer = *racer[race_winner];
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Concurrent solve %s %s\n",
+               winner.load() < 0 ? "returns result of" : "won by",
+               winning_racer.solver.c_str());
+  if (race_winner > 0) {
+    solver_object.solution_ = std::move(winning_racer.solution);
+    solver_object.basis_ = std::move(winning_racer.basis);
+    solver_object.highs_info_ = winning_racer.highs_info;
+    // The simplex data correspond to an interrupted solve
+    solver_object.ekk_instance_.invalidate();
+  }
+  solver_object.model_status_ = winning_racer.model_status;
+  return winning_racer.return_status;
+}
+
 // Solves an unconstrained LP without scaling, setting HighsBasis, HighsSolution
 // and HighsInfo
 HighsStatus solveUnconstrainedLp(HighsLpSolverObject& solver_object) {
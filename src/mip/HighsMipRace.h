@@ -0,0 +1,123 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipRace.h
+ * @brief Data shared by concurrent MIP solvers racing on the same model
+ */
+#ifndef MIP_HIGHS_MIP_RACE_H_
+#define MIP_HIGHS_MIP_RACE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "lp_data/HConst.h"
+
+// Each racer is a complete HighsMipSolver with its own presolve, search,
+// LP relaxation and domain, started with a different random seed. The
+// racers exchange improving solutions, given in the space of the original
+// model so that they are independent of each racer's presolve, and the
+// first racer to complete its search ends the race for all others.
+class HighsMipRace {
+ public:
+  struct Incumbent {
+    double objective = kHighsInf;
+    std::vector<double> solution;
+    double bound_violation = 0;
+    double integrality_violation = 0;
+    double row_violation = 0;
+  };
+
+  struct Result {
+    HighsModelStatus model_status = HighsModelStatus::kNotset;
+    double dual_bound = -kHighsInf;
+    int64_t node_count = 0;
+    int64_t total_lp_iterations = 0;
+  };
+
+ private:
+  std::mutex mutex_;
+  std::atomic<int64_t> incumbent_version_;
+  std::atomic<bool> terminated_;
+  HighsInt num_racer_;
+  HighsInt winner_;
+  ObjSense sense_;
+  Incumbent incumbent_;
+  Result winner_result_;
+
+ public:
+  HighsMipRace(HighsInt num_racer, ObjSense sense)
+      : incumbent_version_(0),
+        terminated_(false),
+        num_racer_(num_racer),
+        winner_(-1),
+        sense_(sense) {}
+
+  HighsInt numRacer() const { return num_racer_; }
+
+  bool terminated() const {
+    return terminated_.load(std::memory_order_acquire);
+  }
+
+  HighsInt winner() const { return winner_; }
+
+  // Offer an improving solution in the original space. It is only recorded
+  // if it is better than the current race incumbent
+  void updateIncumbent(double objective, const std::vector<double>& solution,
+                       double bound_violation, double integrality_violation,
+                       double row_violation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (incumbent_.objective != kHighsInf &&
+        (HighsInt)sense_ * objective >=
+            (HighsInt)sense_ * incumbent_.objective)
+      return;
+    incumbent_.objective = objective;
+    incumbent_.solution = solution;
+    incumbent_.bound_violation = bound_violation;
+    incumbent_.integrality_violation = integrality_violation;
+    incumbent_.row_violation = row_violation;
+    incumbent_version_.fetch_add(1, std::memory_order_release);
+  }
+
+  // Copy the race incumbent if it has changed since version was last
+  // returned, in which case version is updated
+  bool getIncumbent(int64_t& version, Incumbent& incumbent) {
+    if (incumbent_version_.load(std::memory_order_acquire) == version)
+      return false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    version = incumbent_version_.load(std::memory_order_relaxed);
+    incumbent = incumbent_;
+    return true;
+  }
+
+  // Record that a racer has completed its search, returning true if it is
+  // the first to do so, in which case its result is recorded
+  bool finish(HighsInt racer, const Result& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const bool first = winner_ < 0;
+    if (first) {
+      winner_ = racer;
+      winner_result_ = result;
+    }
+    terminated_.store(true, std::memory_order_release);
+    return first;
+  }
+
+  // Stop all racers without declaring a winner
+  void terminate() { terminated_.store(true, std::memory_order_release); }
+
+  Result getWinnerResult() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return winner_result_;
+  }
+};
+
+#endif
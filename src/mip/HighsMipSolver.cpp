@@ -17,6 +17,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipRace.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSearch.h"
@@ -41,7 +42,10 @@ HighsMipSolver::HighsMipSolver(HighsCallback& callback,
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      race_(nullptr),
+      race_id_(0),
+      race_incumbent_version_(0) {
   if (solution.value_valid) {
     // MIP solver doesn't check row residuals, but they should be OK
     // so validate using assert
@@ -103,6 +107,11 @@ HighsMipSolver::HighsMipSolver(HighsCallback& callback,
 HighsMipSolver::~HighsMipSolver() = default;
 
 void HighsMipSolver::run() {
+  if (!submip && !race_ && options_mip_->mip_race_concurrency > 1 &&
+      highs::parallel::num_threads() > 1) {
+    runRace();
+    return;
+  }
   modelstatus_ = HighsModelStatus::kNotset;
   // Start the solve_clock for the timer that is local to the HighsMipSolver
   // instance
@@ -224,6 +233,7 @@ restart:
         search.flushStatistics();
       }
 
+      mipdata_->importRaceIncumbent();
       if (mipdata_->checkLimits()) {
         limit_reached = true;
         break;
@@ -432,6 +442,7 @@ restart:
           break;
         }
 
+        mipdata_->importRaceIncumbent();
         if (mipdata_->checkLimits()) {
           limit_reached = true;
           break;
@@ -498,16 +509,6 @@ restart:
 
 void HighsMipSolver::cleanupSolve() {
   timer_.start(timer_.postsolve_clock);
-  bool havesolution = solution_objective_ != kHighsInf;
-  bool feasible;
-  if (havesolution)
-    feasible =
-        bound_violation_ <= options_mip_->mip_feasibility_tolerance &&
-        integrality_violation_ <= options_mip_->mip_feasibility_tolerance &&
-        row_violation_ <= options_mip_->mip_feasibility_tolerance;
-  else
-    feasible = false;
-
   dual_bound_ = mipdata_->lower_bound;
   if (mipdata_->objectiveFunction.isIntegral()) {
     double rounded_lower_bound =
@@ -521,6 +522,18 @@ void HighsMipSolver::cleanupSolve() {
   primal_bound_ = mipdata_->upper_bound + model_->offset_;
   node_count_ = mipdata_->num_nodes;
   total_lp_iterations_ = mipdata_->total_lp_iterations;
+  if (race_) mipdata_->finishRace();
+
+  bool havesolution = solution_objective_ != kHighsInf;
+  bool feasible;
+  if (havesolution)
+    feasible =
+        bound_violation_ <= options_mip_->mip_feasibility_tolerance &&
+        integrality_violation_ <= options_mip_->mip_feasibility_tolerance &&
+        row_violation_ <= options_mip_->mip_feasibility_tolerance;
+  else
+    feasible = false;
+
   dual_bound_ = std::min(dual_bound_, primal_bound_);
 
   // adjust objective sense in case of maximization problem
@@ -627,6 +640,57 @@ void HighsMipSolver::cleanupSolve() {
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
 
+void HighsMipSolver::runRace() {
+  const HighsInt num_racer =
+      std::min(options_mip_->mip_race_concurrency,
+               HighsInt(highs::parallel::num_threads()));
+  HighsMipRace race(num_racer, orig_model_->sense_);
+  highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+               "Racing %" HIGHSINT_FORMAT " MIP solvers\n", num_racer);
+
+  // Racers must not write to the log or solution file, or call user
+  // callbacks, so each has its own options and (inactive) callback
+  HighsSolution start_solution;
+  if (solution_objective_ != kHighsInf) {
+    start_solution.col_value = solution_;
+    start_solution.value_valid = true;
+    calculateRowValuesQuad(*orig_model_, start_solution);
+  }
+  std::vector<std::unique_ptr<HighsOptions>> racer_options;
+  std::vector<std::unique_ptr<HighsCallback>> racer_callback;
+  std::vector<std::unique_ptr<HighsMipSolver>> racer;
+  for (HighsInt iRacer = 1; iRacer < num_racer; iRacer++) {
+    racer_options.emplace_back(new HighsOptions(*options_mip_));
+    HighsOptions& options = *racer_options.back();
+    options.random_seed += iRacer;
+    options.output_flag = false;
+    options.mip_improving_solution_save = false;
+    options.mip_improving_solution_file = "";
+    racer_callback.emplace_back(new HighsCallback());
+    racer.emplace_back(new HighsMipSolver(*racer_callback.back(), options,
+                                          *orig_model_, start_solution));
+    racer.back()->race_ = &race;
+    racer.back()->race_id_ = iRacer;
+  }
+
+  race_ = &race;
+  race_id_ = 0;
+  {
+    highs::parallel::TaskGroup tg;
+    for (HighsInt iRacer = 1; iRacer < num_racer; iRacer++) {
+      HighsMipSolver* racer_solver = racer[iRacer - 1].get();
+      tg.spawn([&race, racer_solver]() {
+        if (!race.terminated()) racer_solver->run();
+      });
+    }
+    run();
+    race.terminate();
+    tg.cancel();
+    tg.taskWait();
+  }
+  race_ = nullptr;
+}
+
 void HighsMipSolver::runPresolve(const HighsInt presolve_reduction_limit) {
   // Start the solve_clock for the timer that is local to the HighsMipSolver
   // instance
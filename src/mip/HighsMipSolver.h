@@ -20,6 +20,7 @@ class HighsCutPool;
 struct HighsPseudocostInitialization;
 class HighsCliqueTable;
 class HighsImplications;
+class HighsMipRace;
 
 class HighsMipSolver {
  public:
@@ -50,10 +51,18 @@ class HighsMipSolver {
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
 
+  // Set when this solver is one of several racing on the same model, with
+  // race_id_ = 0 for the solver that returns the result to HiGHS
+  HighsMipRace* race_;
+  HighsInt race_id_;
+  int64_t race_incumbent_version_;
+
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
   void run();
 
+  void runRace();
+
   HighsInt numCol() const { return model_->num_col_; }
 
   HighsInt numRow() const { return model_->num_row_; }
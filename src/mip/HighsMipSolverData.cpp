@@ -15,6 +15,7 @@
 // #include "lp_data/HighsLpUtils.h"
 #include "../extern/pdqsort/pdqsort.h"
 #include "lp_data/HighsModelUtils.h"
+#include "mip/HighsMipRace.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsRedcostFixing.h"
 #include "parallel/HighsParallel.h"
@@ -1108,40 +1109,118 @@ bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
     if (solobj >= upper_bound) return false;
     upper_bound = solobj;
     incumbent = sol;
-    double new_upper_limit = computeNewUpperLimit(solobj, 0.0, 0.0);
-
-    if (!mipsolver.submip) saveReportMipSolution(new_upper_limit);
-    if (new_upper_limit < upper_limit) {
-      ++numImprovingSols;
-      upper_limit = new_upper_limit;
-      optimality_limit =
-          computeNewUpperLimit(solobj, mipsolver.options_mip_->mip_abs_gap,
-                               mipsolver.options_mip_->mip_rel_gap);
-      nodequeue.setOptimalityLimit(optimality_limit);
-      debugSolution.newIncumbentFound();
-      domain.propagate();
-      if (!domain.infeasible()) redcostfixing.propagateRootRedcost(mipsolver);
-
-      if (domain.infeasible()) {
-        pruned_treeweight = 1.0;
-        nodequeue.clear();
-        return true;
-      }
-      cliquetable.extractObjCliques(mipsolver);
-      if (domain.infeasible()) {
-        pruned_treeweight = 1.0;
-        nodequeue.clear();
-        return true;
-      }
-      pruned_treeweight += nodequeue.performBounding(upper_limit);
-      printDisplayLine(source);
-    }
+    if (mipsolver.race_)
+      mipsolver.race_->updateIncumbent(
+          mipsolver.solution_objective_, mipsolver.solution_,
+          mipsolver.bound_violation_, mipsolver.integrality_violation_,
+          mipsolver.row_violation_);
+    updateUpperLimit(solobj, source);
   } else if (incumbent.empty())
     incumbent = sol;
 
   return true;
 }
 
+void HighsMipSolverData::updateUpperLimit(double solobj, char source) {
+  double new_upper_limit = computeNewUpperLimit(solobj, 0.0, 0.0);
+
+  if (!mipsolver.submip) saveReportMipSolution(new_upper_limit);
+  if (new_upper_limit < upper_limit) {
+    ++numImprovingSols;
+    upper_limit = new_upper_limit;
+    optimality_limit =
+        computeNewUpperLimit(solobj, mipsolver.options_mip_->mip_abs_gap,
+                             mipsolver.options_mip_->mip_rel_gap);
+    nodequeue.setOptimalityLimit(optimality_limit);
+    debugSolution.newIncumbentFound();
+    domain.propagate();
+    if (!domain.infeasible()) redcostfixing.propagateRootRedcost(mipsolver);
+
+    if (domain.infeasible()) {
+      pruned_treeweight = 1.0;
+      nodequeue.clear();
+      return;
+    }
+    cliquetable.extractObjCliques(mipsolver);
+    if (domain.infeasible()) {
+      pruned_treeweight = 1.0;
+      nodequeue.clear();
+      return;
+    }
+    pruned_treeweight += nodequeue.performBounding(upper_limit);
+    printDisplayLine(source);
+  }
+}
+
+void HighsMipSolverData::importRaceIncumbent() {
+  HighsMipRace* race = mipsolver.race_;
+  if (!race) return;
+  HighsMipRace::Incumbent race_incumbent;
+  if (!race->getIncumbent(mipsolver.race_incumbent_version_, race_incumbent))
+    return;
+  if (race_incumbent.objective == kHighsInf) return;
+  // the race incumbent is in the original space, so transform its
+  // objective value as for a MIP start
+  double solobj =
+      race_incumbent.objective * (int)mipsolver.orig_model_->sense_ -
+      mipsolver.model_->offset_;
+  if (solobj >= upper_bound) return;
+
+  mipsolver.solution_ = std::move(race_incumbent.solution);
+  mipsolver.solution_objective_ = race_incumbent.objective;
+  mipsolver.bound_violation_ = race_incumbent.bound_violation;
+  mipsolver.integrality_violation_ = race_incumbent.integrality_violation;
+  mipsolver.row_violation_ = race_incumbent.row_violation;
+  upper_bound = solobj;
+  incumbent = postSolveStack.getReducedPrimalSolution(mipsolver.solution_);
+  updateUpperLimit(solobj, 'X');
+}
+
+void HighsMipSolverData::finishRace() {
+  HighsMipRace* race = mipsolver.race_;
+  assert(race);
+  // Values are in the minimization sense, including the offset
+  HighsMipRace::Result result;
+  result.model_status = mipsolver.modelstatus_;
+  result.dual_bound = mipsolver.dual_bound_;
+  result.node_count = mipsolver.node_count_;
+  result.total_lp_iterations = mipsolver.total_lp_iterations_;
+  const bool winner = race->finish(mipsolver.race_id_, result);
+  if (mipsolver.race_id_ != 0) return;
+
+  if (!winner) {
+    // Another racer completed its search first, so its result is taken
+    result = race->getWinnerResult();
+    mipsolver.modelstatus_ = result.model_status;
+    mipsolver.dual_bound_ = result.dual_bound;
+    mipsolver.node_count_ = result.node_count;
+    mipsolver.total_lp_iterations_ = result.total_lp_iterations;
+  }
+  highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+               "\nMIP race won by solver %" HIGHSINT_FORMAT "\n",
+               race->winner());
+
+  // A better solution may have been found by a racer after this solver
+  // last imported the race incumbent
+  HighsMipRace::Incumbent race_incumbent;
+  int64_t version = -1;
+  race->getIncumbent(version, race_incumbent);
+  const int sense = (int)mipsolver.orig_model_->sense_;
+  if (race_incumbent.objective != kHighsInf &&
+      (mipsolver.solution_objective_ == kHighsInf ||
+       sense * race_incumbent.objective <
+           sense * mipsolver.solution_objective_)) {
+    mipsolver.solution_ = std::move(race_incumbent.solution);
+    mipsolver.solution_objective_ = race_incumbent.objective;
+    mipsolver.bound_violation_ = race_incumbent.bound_violation;
+    mipsolver.integrality_violation_ = race_incumbent.integrality_violation;
+    mipsolver.row_violation_ = race_incumbent.row_violation;
+  }
+  if (mipsolver.solution_objective_ != kHighsInf)
+    mipsolver.primal_bound_ =
+        std::min(mipsolver.primal_bound_, sense * mipsolver.solution_objective_);
+}
+
 static std::array<char, 22> convertToPrintString(int64_t val) {
   double l = std::log10(std::max(1.0, double(val)));
   std::array<char, 22> printString;
@@ -1840,6 +1919,16 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     }
   }
 
+  // Possible termination due to another racer completing its search
+  if (mipsolver.race_ && mipsolver.race_->terminated()) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "MIP race terminated\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kInterrupt;
+    }
+    return true;
+  }
+
   if (options.mip_max_nodes != kHighsIInf &&
       num_nodes + nodeOffset >= options.mip_max_nodes) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
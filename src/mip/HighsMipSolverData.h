@@ -212,6 +212,9 @@ struct HighsMipSolverData {
   HighsLpRelaxation::Status evaluateRootLp();
   void evaluateRootNode();
   bool addIncumbent(const std::vector<double>& sol, double solobj, char source);
+  void updateUpperLimit(double solobj, char source);
+  void importRaceIncumbent();
+  void finishRace();
 
   const std::vector<double>& getSolution() const;
 
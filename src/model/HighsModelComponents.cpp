@@ -0,0 +1,248 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file model/HighsModelComponents.cpp
+ * @brief Detection of the independent components of a model, and of
+ * any bordered block-diagonal structure
+ */
+#include "model/HighsModelComponents.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "util/HighsDisjointSets.h"
+
+namespace {
+
+// A model is only considered to be decomposed if no block has more
+// than this fraction of the columns
+const double kMaxBlockColFraction = 0.75;
+
+// Limit on the fraction of the rows that may be linking rows
+const double kMaxLinkingRowFraction = 0.05;
+
+// Form the blocks of columns coupled by the rows that are not linking
+// rows, and by the off-diagonal Hessian entries. For each row that is
+// not a linking row, row_col is its first column, or -1 if it has
+// none. Returns the number of blocks
+HighsInt formBlocks(const HighsSparseMatrix& matrix,
+                    const HighsHessian& hessian,
+                    const std::vector<int8_t>& linking_row,
+                    std::vector<HighsInt>& col_block,
+                    std::vector<HighsInt>& row_col,
+                    HighsInt& max_block_size) {
+  const HighsInt num_col = matrix.num_col_;
+  // With the minimal representative, the representative of each
+  // column is the first column in its block
+  HighsDisjointSets<true> sets(num_col);
+  row_col.assign(matrix.num_row_, -1);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    for (HighsInt iEl = matrix.start_[iCol]; iEl < matrix.start_[iCol + 1];
+         iEl++) {
+      const HighsInt iRow = matrix.index_[iEl];
+      if (linking_row[iRow]) continue;
+      if (row_col[iRow] < 0) {
+        row_col[iRow] = iCol;
+      } else {
+        sets.merge(row_col[iRow], iCol);
+      }
+    }
+  }
+  for (HighsInt iCol = 0; iCol < hessian.dim_; iCol++) {
+    for (HighsInt iEl = hessian.start_[iCol]; iEl < hessian.start_[iCol + 1];
+         iEl++) {
+      if (hessian.index_[iEl] != iCol) sets.merge(hessian.index_[iEl], iCol);
+    }
+  }
+  col_block.resize(num_col);
+  std::vector<HighsInt> block_size;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const HighsInt repr = sets.getSet(iCol);
+    assert(repr <= iCol);
+    if (repr == iCol) {
+      col_block[iCol] = block_size.size();
+      block_size.push_back(0);
+    } else {
+      col_block[iCol] = col_block[repr];
+    }
+    block_size[col_block[iCol]]++;
+  }
+  max_block_size = 0;
+  for (const HighsInt size : block_size)
+    max_block_size = std::max(size, max_block_size);
+  return block_size.size();
+}
+
+}  // namespace
+
+void HighsBlockStructure::clear() {
+  this->num_block = 0;
+  this->num_linking_row = 0;
+  this->col_block.clear();
+  this->row_block.clear();
+}
+
+void getBlockStructure(const HighsModel& model, const bool detect_linking_rows,
+                       HighsBlockStructure& structure) {
+  structure.clear();
+  const HighsLp& lp = model.lp_;
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const HighsSparseMatrix* matrix = &lp.a_matrix_;
+  HighsSparseMatrix colwise_matrix;
+  if (!matrix->isColwise()) {
+    colwise_matrix = lp.a_matrix_;
+    colwise_matrix.ensureColwise();
+    matrix = &colwise_matrix;
+  }
+  std::vector<int8_t> linking_row(num_row, 0);
+  std::vector<HighsInt> row_col;
+  HighsInt max_block_size;
+  structure.num_block = formBlocks(*matrix, model.hessian_, linking_row,
+                                   structure.col_block, row_col,
+                                   max_block_size);
+  const HighsInt max_decomposed_block_size = kMaxBlockColFraction * num_col;
+  if (detect_linking_rows && max_block_size > max_decomposed_block_size) {
+    // Remove the densest rows, doubling their number until what
+    // remains decomposes
+    std::vector<HighsInt> row_count(num_row, 0);
+    for (HighsInt iEl = 0; iEl < matrix->numNz(); iEl++)
+      row_count[matrix->index_[iEl]]++;
+    std::vector<HighsInt> candidate;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      if (row_count[iRow] > 1) candidate.push_back(iRow);
+    std::sort(candidate.begin(), candidate.end(),
+              [&row_count](const HighsInt row0, const HighsInt row1) {
+                return row_count[row0] > row_count[row1] ||
+                       (row_count[row0] == row_count[row1] && row0 < row1);
+              });
+    const HighsInt max_num_linking =
+        std::min(HighsInt(candidate.size()),
+                 std::max(HighsInt{1},
+                          HighsInt(kMaxLinkingRowFraction * num_row)));
+    std::vector<HighsInt> col_block;
+    bool decomposed = false;
+    HighsInt num_linking = 0;
+    for (HighsInt limit = 1; num_linking < max_num_linking; limit *= 2) {
+      for (; num_linking < std::min(limit, max_num_linking); num_linking++)
+        linking_row[candidate[num_linking]] = 1;
+      const HighsInt num_block = formBlocks(
+          *matrix, model.hessian_, linking_row, col_block, row_col,
+          max_block_size);
+      if (max_block_size <= max_decomposed_block_size) {
+        structure.num_block = num_block;
+        structure.col_block = std::move(col_block);
+        decomposed = true;
+        break;
+      }
+    }
+    if (!decomposed && num_linking > 0) {
+      linking_row.assign(num_row, 0);
+      formBlocks(*matrix, model.hessian_, linking_row, structure.col_block,
+                 row_col, max_block_size);
+    }
+  }
+  // Any model with rows has at least one block, to which empty rows
+  // are assigned
+  if (num_row > 0) structure.num_block = std::max(HighsInt{1},
+                                                  structure.num_block);
+  structure.row_block.assign(num_row, 0);
+  const HighsInt kUnassigned = -2;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    if (linking_row[iRow]) {
+      structure.row_block[iRow] = kUnassigned;
+    } else if (row_col[iRow] >= 0) {
+      structure.row_block[iRow] = structure.col_block[row_col[iRow]];
+    }
+  }
+  // Rows removed as linking rows whose columns all lie in one block
+  // are assigned to that block
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const HighsInt block = structure.col_block[iCol];
+    for (HighsInt iEl = matrix->start_[iCol]; iEl < matrix->start_[iCol + 1];
+         iEl++) {
+      const HighsInt iRow = matrix->index_[iEl];
+      if (!linking_row[iRow]) continue;
+      if (structure.row_block[iRow] == kUnassigned) {
+        structure.row_block[iRow] = block;
+      } else if (structure.row_block[iRow] != block) {
+        structure.row_block[iRow] = -1;
+      }
+    }
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow++)
+    if (structure.row_block[iRow] < 0) structure.num_linking_row++;
+}
+
+void extractComponentModel(const HighsModel& model,
+                           const std::vector<HighsInt>& col_index,
+                           const std::vector<HighsInt>& row_index,
+                           const std::vector<HighsInt>& local_col,
+                           const std::vector<HighsInt>& local_row,
+                           HighsModel& component) {
+  const HighsLp& lp = model.lp_;
+  const HighsSparseMatrix& matrix = lp.a_matrix_;
+  assert(matrix.isColwise());
+  component.clear();
+  HighsLp& component_lp = component.lp_;
+  const HighsInt num_col = col_index.size();
+  const HighsInt num_row = row_index.size();
+  component_lp.num_col_ = num_col;
+  component_lp.num_row_ = num_row;
+  component_lp.sense_ = lp.sense_;
+  component_lp.col_cost_.resize(num_col);
+  component_lp.col_lower_.resize(num_col);
+  component_lp.col_upper_.resize(num_col);
+  const bool have_integrality = lp.integrality_.size() > 0;
+  if (have_integrality) component_lp.integrality_.resize(num_col);
+  HighsSparseMatrix& component_matrix = component_lp.a_matrix_;
+  component_matrix.format_ = MatrixFormat::kColwise;
+  component_matrix.num_col_ = num_col;
+  component_matrix.num_row_ = num_row;
+  component_matrix.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const HighsInt col = col_index[iCol];
+    component_lp.col_cost_[iCol] = lp.col_cost_[col];
+    component_lp.col_lower_[iCol] = lp.col_lower_[col];
+    component_lp.col_upper_[iCol] = lp.col_upper_[col];
+    if (have_integrality)
+      component_lp.integrality_[iCol] = lp.integrality_[col];
+    for (HighsInt iEl = matrix.start_[col]; iEl < matrix.start_[col + 1];
+         iEl++) {
+      assert(row_index[local_row[matrix.index_[iEl]]] == matrix.index_[iEl]);
+      component_matrix.index_.push_back(local_row[matrix.index_[iEl]]);
+      component_matrix.value_.push_back(matrix.value_[iEl]);
+    }
+    component_matrix.start_.push_back(component_matrix.index_.size());
+  }
+  component_lp.row_lower_.resize(num_row);
+  component_lp.row_upper_.resize(num_row);
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    component_lp.row_lower_[iRow] = lp.row_lower_[row_index[iRow]];
+    component_lp.row_upper_[iRow] = lp.row_upper_[row_index[iRow]];
+  }
+  const HighsHessian& hessian = model.hessian_;
+  if (hessian.dim_ > 0) {
+    HighsHessian& component_hessian = component.hessian_;
+    component_hessian.dim_ = num_col;
+    component_hessian.format_ = hessian.format_;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      const HighsInt col = col_index[iCol];
+      if (col < hessian.dim_) {
+        for (HighsInt iEl = hessian.start_[col]; iEl < hessian.start_[col + 1];
+             iEl++) {
+          component_hessian.index_.push_back(local_col[hessian.index_[iEl]]);
+          component_hessian.value_.push_back(hessian.value_[iEl]);
+        }
+      }
+      component_hessian.start_.push_back(component_hessian.index_.size());
+    }
+  }
+}
@@ -0,0 +1,44 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file model/HighsModelComponents.h
+ * @brief Detection of the independent components of a model, and of
+ * any bordered block-diagonal structure
+ */
+#ifndef MODEL_HIGHSMODELCOMPONENTS_H_
+#define MODEL_HIGHSMODELCOMPONENTS_H_
+
+#include <vector>
+
+#include "lp_data/HStruct.h"
+#include "model/HighsModel.h"
+
+// Get the blocks of columns coupled by the constraint matrix and
+// off-diagonal Hessian entries. Blocks are numbered in order of their
+// first column, empty columns form blocks of their own, and empty
+// rows are assigned to block 0. If the model is not decomposed by
+// this, and detect_linking_rows is true, dense rows are removed
+// until what remains decomposes. Any such rows are linking rows, and
+// have block -1
+void getBlockStructure(const HighsModel& model, const bool detect_linking_rows,
+                       HighsBlockStructure& structure);
+
+// Extract the model defined by the (increasing) column and row
+// indices of a component. For each column and row in the component,
+// local_col and local_row give its position in col_index and
+// row_index
+void extractComponentModel(const HighsModel& model,
+                           const std::vector<HighsInt>& col_index,
+                           const std::vector<HighsInt>& row_index,
+                           const std::vector<HighsInt>& local_col,
+                           const std::vector<HighsInt>& local_row,
+                           HighsModel& component);
+
+#endif  // MODEL_HIGHSMODELCOMPONENTS_H_
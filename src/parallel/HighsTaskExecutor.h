@@ -166,6 +166,8 @@ class HighsTaskExecutor {
       }
 
       executorHandle.ptr.reset();
+      // the worker deque of this thread has been destroyed
+      threadLocalWorkerDeque() = nullptr;
     }
   }
 
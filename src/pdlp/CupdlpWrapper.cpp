@@ -23,6 +23,8 @@ void getUserParamsFromOptions(const HighsOptions& options,
 void analysePdlpSolution(const HighsOptions& options, const HighsLp& lp,
                          const HighsSolution& highs_solution);
 
+cupdlp_int pdlpInterruptCheck(void* callback_data, cupdlp_int pdlp_num_iter);
+
 HighsStatus solveLpCupdlp(HighsLpSolverObject& solver_object) {
   return solveLpCupdlp(solver_object.options_, solver_object.timer_,
                        solver_object.lp_, solver_object.basis_,
@@ -153,6 +155,10 @@ HighsStatus solveLpCupdlp(const HighsOptions& options, HighsTimer& timer,
   w->timers->dPresolveTime = 0;  // presolve_time;
   cupdlp_copy_vec(w->rowScale, scaling->rowScale, cupdlp_float, nRows);
   cupdlp_copy_vec(w->colScale, scaling->colScale, cupdlp_float, nCols);
+  if (callback.user_callback && callback.active[kCallbackPdlpInterrupt]) {
+    w->interruptCheck = pdlpInterruptCheck;
+    w->interruptData = &callback;
+  }
 
   // CUPDLP_CALL(LP_SolvePDHG(prob, cupdlp_NULL, cupdlp_NULL, cupdlp_NULL,
   // cupdlp_NULL));
@@ -198,6 +204,8 @@ HighsStatus solveLpCupdlp(const HighsOptions& options, HighsTimer& timer,
     model_status = pdlp_num_iter >= intParam[N_ITER_LIM] - 1
                        ? HighsModelStatus::kIterationLimit
                        : HighsModelStatus::kTimeLimit;
+  } else if (pdlp_model_status == INTERRUPT) {
+    model_status = HighsModelStatus::kInterrupt;
   } else if (pdlp_model_status == FEASIBLE) {
     assert(111 == 666);
     model_status = HighsModelStatus::kUnknown;
@@ -686,3 +694,10 @@ cupdlp_int getCupdlpLogLevel(const HighsOptions& options) {
   }
   return 0;
 }
+
+cupdlp_int pdlpInterruptCheck(void* callback_data, cupdlp_int pdlp_num_iter) {
+  HighsCallback& callback = *static_cast<HighsCallback*>(callback_data);
+  callback.clearHighsCallbackDataOut();
+  callback.data_out.pdlp_iteration_count = pdlp_num_iter;
+  return callback.callbackAction(kCallbackPdlpInterrupt, "PDLP interrupt");
+}
@@ -59,6 +59,7 @@ typedef enum {
   INFEASIBLE_OR_UNBOUNDED,
   TIMELIMIT_OR_ITERLIMIT,
   FEASIBLE,
+  INTERRUPT,
 } termination_code;
 
 typedef enum {
@@ -408,6 +409,11 @@ struct CUPDLP_WORK {
 
   cupdlp_float *rowScale;
   cupdlp_float *colScale;
+
+  // Optional check for an interrupt, called with interruptData and
+  // the iteration count whenever termination is checked
+  cupdlp_int (*interruptCheck)(void *, cupdlp_int);
+  void *interruptData;
 #ifndef CUPDLP_CPU
   // CUDAmv *MV;
   cusparseHandle_t cusparsehandle;
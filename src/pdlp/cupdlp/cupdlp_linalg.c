@@ -1,6 +1,8 @@
 
 #include "cupdlp_linalg.h"
 
+#include "cupdlp_parallel.h"
+
 /**
  * The function `ScatterCol` performs a scatter operation on a specific
  * column of a matrix.
@@ -59,6 +61,15 @@ void AxCPU(CUPDLPwork *w, cupdlp_float *ax, const cupdlp_float *x) {
   }
   */
 
+  // With the matrix also held row-wise, each entry of ax is an independent
+  // inner product, so they can be computed in parallel
+  CUPDLPcsr *csr = lp->data->csr_matrix;
+  if (csr) {
+    cupdlp_par_csr_Ax(lp->data->nRows, csr->rowMatBeg, csr->rowMatIdx,
+                      csr->rowMatElem, x, ax);
+    return;
+  }
+
   memset(ax, 0, sizeof(cupdlp_float) * lp->data->nRows);
 
   for (cupdlp_int iCol = 0; iCol < lp->data->nCols; ++iCol) {
@@ -98,6 +109,13 @@ void ATyCPU(CUPDLPwork *w, cupdlp_float *aty, const cupdlp_float *y) {
   }
   */
 
+  CUPDLPcsc *csc = lp->data->csc_matrix;
+  if (csc) {
+    cupdlp_par_csc_ATy(lp->data->nCols, csc->colMatBeg, csc->colMatIdx,
+                       csc->colMatElem, y, aty);
+    return;
+  }
+
   memset(aty, 0, sizeof(cupdlp_float) * lp->data->nCols);
   for (cupdlp_int iRow = 0; iRow < lp->data->nRows; ++iRow) {
     ScatterRow(w, iRow, y[iRow], aty);
@@ -112,13 +130,7 @@ double nrm2(cupdlp_int n, const double *x, cupdlp_int incx) {
 #ifdef USE_MY_BLAS
   assert(incx == 1);
 
-  double nrm = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    nrm += x[i] * x[i];
-  }
-
-  return sqrt(nrm);
+  return sqrt(cupdlp_par_twoNormSquared(n, x));
 #else
   return dnrm2(n, x, incx);
 #endif
@@ -128,14 +140,7 @@ double nrminf(cupdlp_int n, const double *x, cupdlp_int incx) {
 #ifdef USE_MY_BLAS
   assert(incx == 1);
 
-  double nrm = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    double tmp = fabs(x[i]);
-    if (tmp > nrm) nrm = tmp;
-  }
-
-  return nrm;
+  return cupdlp_par_infNorm(n, x);
 #else
   return dnrm2(n, x, incx);
 #endif
@@ -187,16 +192,12 @@ double GenNorm(double *x, cupdlp_int n, cupdlp_float p) {
 
 /* x = x .* y*/
 void cupdlp_cdot(cupdlp_float *x, const cupdlp_float *y, const cupdlp_int len) {
-  for (int i = 0; i < len; i++) {
-    x[i] *= y[i];
-  }
+  cupdlp_par_edot(len, x, y);
 }
 
 /* x = x ./ y*/
 void cupdlp_cdiv(cupdlp_float *x, const cupdlp_float *y, const cupdlp_int len) {
-  for (int i = 0; i < len; i++) {
-    x[i] /= y[i];
-  }
+  cupdlp_par_ediv(len, x, y);
 }
 
 /* xout = weight * x */
@@ -212,33 +213,25 @@ void cupdlp_cdiv(cupdlp_float *x, const cupdlp_float *y, const cupdlp_int len) {
 /* xout = max(x, lb), lb is vector */
 void cupdlp_projLowerBound(cupdlp_float *x, const cupdlp_float *lb,
                            const cupdlp_int len) {
-  for (int i = 0; i < len; i++) {
-    x[i] = x[i] > lb[i] ? x[i] : lb[i];
-  }
+  cupdlp_par_projLowerBound(len, x, lb);
 }
 
 /* xout = min(x, ub), ub is vector */
 void cupdlp_projUpperBound(cupdlp_float *x, const cupdlp_float *ub,
                            const cupdlp_int len) {
-  for (int i = 0; i < len; i++) {
-    x[i] = x[i] < ub[i] ? x[i] : ub[i];
-  }
+  cupdlp_par_projUpperBound(len, x, ub);
 }
 
 /* xout = max(x, lb), lb is number */
 void cupdlp_projSameLowerBound(cupdlp_float *x, const cupdlp_float lb,
                                const cupdlp_int len) {
-  for (int i = 0; i < len; i++) {
-    x[i] = x[i] > lb ? x[i] : lb;
-  }
+  cupdlp_par_projSameLowerBound(len, x, lb);
 }
 
 /* xout = min(x, ub), ub is number */
 void cupdlp_projSameUpperBound(cupdlp_float *x, const cupdlp_float ub,
                                const cupdlp_int len) {
-  for (int i = 0; i < len; i++) {
-    x[i] = x[i] < ub ? x[i] : ub;
-  }
+  cupdlp_par_projSameUpperBound(len, x, ub);
 }
 
 /* xout = max(x, 0) */
@@ -256,12 +249,7 @@ void cupdlp_projNegative(cupdlp_float *x, const cupdlp_int len) {
 // const cupdlp_int len)
 cupdlp_float diffTwoNormSquared(cupdlp_float *x, cupdlp_float *y,
                                 const cupdlp_int len) {
-  cupdlp_float res = 0.0;
-  for (int i = 0; i < len; i++) {
-    cupdlp_float tmp = x[i] - y[i];
-    res += tmp * tmp;
-  }
-  return res;
+  return cupdlp_par_diffTwoNormSquared(len, x, y);
 }
 
 /* ||x - y||_2 */
@@ -316,13 +304,7 @@ double dot(cupdlp_int n, const cupdlp_float *x, cupdlp_int incx, const cupdlp_fl
 #ifdef USE_MY_BLAS
   assert(incx == 1 && incy == 1);
 
-  double dres = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    dres += x[i] * y[i];
-  }
-
-  return dres;
+  return cupdlp_par_dot(n, x, y);
 #else
   return ddot(n, x, incx, y, incy);
 #endif
@@ -341,9 +323,7 @@ void AddToVector(cupdlp_float *x, const cupdlp_float weight,
                  const cupdlp_float *y, const cupdlp_int n) {
 #ifdef USE_MY_BLAS
 
-  for (int i = 0; i < n; ++i) {
-    x[i] += weight * y[i];
-  }
+  cupdlp_par_axpy(n, weight, y, x);
 
 #else
   return ddot(n, x, incx, y, incy);
@@ -354,9 +334,7 @@ void AddToVector(cupdlp_float *x, const cupdlp_float weight,
 void ScaleVector(cupdlp_float weight, cupdlp_float *x, cupdlp_int n) {
 #ifdef USE_MY_BLAS
 
-  for (int i = 0; i < n; ++i) {
-    x[i] *= weight;
-  }
+  cupdlp_par_scale(n, weight, x);
 
 #else
   return ddot(n, x, incx, y, incy);
@@ -629,20 +607,28 @@ void cupdlp_twoNormSquared(CUPDLPwork *w, const cupdlp_int n,
 void cupdlp_diffTwoNormSquared(CUPDLPwork *w, const cupdlp_float *x,
                                const cupdlp_float *y, const cupdlp_int len,
                                cupdlp_float *res) {
+#ifdef CUPDLP_CPU
+  *res = cupdlp_par_diffTwoNormSquared(len, x, y);
+#else
   CUPDLP_COPY_VEC(w->buffer2, x, cupdlp_float, len);
   cupdlp_float alpha = -1.0;
   cupdlp_axpy(w, len, &alpha, y, w->buffer2);
   cupdlp_twoNormSquared(w, len, w->buffer2, res);
+#endif
 }
 
 /* ||x - y||_2 */
 void cupdlp_diffTwoNorm(CUPDLPwork *w, const cupdlp_float *x,
                         const cupdlp_float *y, const cupdlp_int len,
                         cupdlp_float *res) {
+#ifdef CUPDLP_CPU
+  *res = sqrt(cupdlp_par_diffTwoNormSquared(len, x, y));
+#else
   CUPDLP_COPY_VEC(w->buffer2, x, cupdlp_float, len);
   cupdlp_float alpha = -1.0;
   cupdlp_axpy(w, len, &alpha, y, w->buffer2);
   cupdlp_twoNorm(w, len, w->buffer2, res);
+#endif
 }
 
 /* (x1 - x2)' (y1 - y2) */
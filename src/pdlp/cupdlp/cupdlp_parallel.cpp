@@ -0,0 +1,280 @@
+#include "cupdlp_parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "parallel/HighsParallel.h"
+
+namespace {
+
+// Minimum # vector entries or matrix nonzeros handled by a task
+const HighsInt kMinTaskSize = 16384;
+// # entries in the blocks over which reductions accumulate partial results
+const HighsInt kReductionBlockSize = 8192;
+
+bool useParallel(const cupdlp_int work) {
+  return work > kMinTaskSize && highs::parallel::num_threads() > 1;
+}
+
+// Applies f(start, end) to [0, n), in parallel when worthwhile
+template <typename F>
+void forEachRange(const cupdlp_int n, F&& f) {
+  if (useParallel(n))
+    highs::parallel::for_each(0, (HighsInt)n, f, kMinTaskSize);
+  else
+    f(0, (HighsInt)n);
+}
+
+// Evaluates f(start, end, partial) for consecutive blocks of [0, n), each
+// setting kNumValues partial results, and adds these to result in block order
+// so that the rounding does not depend on how blocks are assigned to threads.
+template <int kNumValues, typename F>
+void blockedReduce(const cupdlp_int n, cupdlp_float* result, F&& f) {
+  const HighsInt numBlocks =
+      std::max(HighsInt{1},
+               (HighsInt)((n + kReductionBlockSize - 1) / kReductionBlockSize));
+  if (numBlocks == 1) {
+    f(0, (HighsInt)n, result);
+    return;
+  }
+  std::vector<cupdlp_float> partial(kNumValues * numBlocks, 0.0);
+  auto reduceBlocks = [&](HighsInt blockStart, HighsInt blockEnd) {
+    for (HighsInt block = blockStart; block < blockEnd; block++) {
+      const HighsInt start = block * kReductionBlockSize;
+      const HighsInt end =
+          std::min((HighsInt)n, start + kReductionBlockSize);
+      f(start, end, &partial[kNumValues * block]);
+    }
+  };
+  if (useParallel(n))
+    highs::parallel::for_each(0, numBlocks, reduceBlocks,
+                              kMinTaskSize / kReductionBlockSize);
+  else
+    reduceBlocks(0, numBlocks);
+  for (HighsInt block = 0; block < numBlocks; block++)
+    for (int k = 0; k < kNumValues; k++)
+      result[k] += partial[kNumValues * block + k];
+}
+
+// Grain size in rows (columns) for a matrix-vector product so that tasks have
+// about kMinTaskSize nonzeros on average
+HighsInt spmvGrainSize(const cupdlp_int dim, const cupdlp_int nnz) {
+  if (nnz <= 0) return std::max(HighsInt{1}, (HighsInt)dim);
+  return std::max(HighsInt{1},
+                  (HighsInt)(((double)dim * kMinTaskSize) / (double)nnz));
+}
+
+}  // namespace
+
+extern "C" {
+
+void cupdlp_par_csr_Ax(const cupdlp_int nRows, const cupdlp_int* rowMatBeg,
+                       const cupdlp_int* rowMatIdx,
+                       const cupdlp_float* rowMatElem, const cupdlp_float* x,
+                       cupdlp_float* ax) {
+  auto rowProducts = [&](HighsInt start, HighsInt end) {
+    for (HighsInt iRow = start; iRow < end; iRow++) {
+      cupdlp_float sum = 0.0;
+      for (cupdlp_int p = rowMatBeg[iRow]; p < rowMatBeg[iRow + 1]; p++)
+        sum += rowMatElem[p] * x[rowMatIdx[p]];
+      ax[iRow] = sum;
+    }
+  };
+  const cupdlp_int nnz = rowMatBeg[nRows];
+  if (useParallel(nnz))
+    highs::parallel::for_each(0, (HighsInt)nRows, rowProducts,
+                              spmvGrainSize(nRows, nnz));
+  else
+    rowProducts(0, (HighsInt)nRows);
+}
+
+void cupdlp_par_csc_ATy(const cupdlp_int nCols, const cupdlp_int* colMatBeg,
+                        const cupdlp_int* colMatIdx,
+                        const cupdlp_float* colMatElem, const cupdlp_float* y,
+                        cupdlp_float* aty) {
+  auto colProducts = [&](HighsInt start, HighsInt end) {
+    for (HighsInt iCol = start; iCol < end; iCol++) {
+      cupdlp_float sum = 0.0;
+      for (cupdlp_int p = colMatBeg[iCol]; p < colMatBeg[iCol + 1]; p++)
+        sum += colMatElem[p] * y[colMatIdx[p]];
+      aty[iCol] = sum;
+    }
+  };
+  const cupdlp_int nnz = colMatBeg[nCols];
+  if (useParallel(nnz))
+    highs::parallel::for_each(0, (HighsInt)nCols, colProducts,
+                              spmvGrainSize(nCols, nnz));
+  else
+    colProducts(0, (HighsInt)nCols);
+}
+
+cupdlp_float cupdlp_par_dot(const cupdlp_int n, const cupdlp_float* x,
+                            const cupdlp_float* y) {
+  cupdlp_float result = 0.0;
+  blockedReduce<1>(n, &result,
+                   [&](HighsInt start, HighsInt end, cupdlp_float* partial) {
+                     cupdlp_float sum = 0.0;
+                     for (HighsInt i = start; i < end; i++) sum += x[i] * y[i];
+                     partial[0] = sum;
+                   });
+  return result;
+}
+
+cupdlp_float cupdlp_par_twoNormSquared(const cupdlp_int n,
+                                       const cupdlp_float* x) {
+  return cupdlp_par_dot(n, x, x);
+}
+
+cupdlp_float cupdlp_par_infNorm(const cupdlp_int n, const cupdlp_float* x) {
+  // The maximum does not depend on the order of evaluation, so the partial
+  // results are combined by taking their maximum rather than their sum
+  const HighsInt numBlocks =
+      std::max(HighsInt{1},
+               (HighsInt)((n + kReductionBlockSize - 1) / kReductionBlockSize));
+  std::vector<cupdlp_float> partial(numBlocks, 0.0);
+  auto maxBlocks = [&](HighsInt blockStart, HighsInt blockEnd) {
+    for (HighsInt block = blockStart; block < blockEnd; block++) {
+      const HighsInt end =
+          std::min((HighsInt)n, (block + 1) * kReductionBlockSize);
+      cupdlp_float nrm = 0.0;
+      for (HighsInt i = block * kReductionBlockSize; i < end; i++) {
+        cupdlp_float tmp = std::fabs(x[i]);
+        if (tmp > nrm) nrm = tmp;
+      }
+      partial[block] = nrm;
+    }
+  };
+  if (useParallel(n))
+    highs::parallel::for_each(0, numBlocks, maxBlocks,
+                              kMinTaskSize / kReductionBlockSize);
+  else
+    maxBlocks(0, numBlocks);
+  cupdlp_float nrm = 0.0;
+  for (HighsInt block = 0; block < numBlocks; block++)
+    if (partial[block] > nrm) nrm = partial[block];
+  return nrm;
+}
+
+cupdlp_float cupdlp_par_diffTwoNormSquared(const cupdlp_int n,
+                                           const cupdlp_float* x,
+                                           const cupdlp_float* y) {
+  cupdlp_float result = 0.0;
+  blockedReduce<1>(n, &result,
+                   [&](HighsInt start, HighsInt end, cupdlp_float* partial) {
+                     cupdlp_float sum = 0.0;
+                     for (HighsInt i = start; i < end; i++) {
+                       cupdlp_float tmp = x[i] - y[i];
+                       sum += tmp * tmp;
+                     }
+                     partial[0] = sum;
+                   });
+  return result;
+}
+
+void cupdlp_par_diffTwoNormSquaredAndDotDiff(
+    const cupdlp_int n, const cupdlp_float* x1, const cupdlp_float* x2,
+    const cupdlp_float* y1, const cupdlp_float* y2,
+    cupdlp_float* diffTwoNormSquared, cupdlp_float* diffDotDiff) {
+  cupdlp_float result[2] = {0.0, 0.0};
+  blockedReduce<2>(n, result,
+                   [&](HighsInt start, HighsInt end, cupdlp_float* partial) {
+                     cupdlp_float sumSquares = 0.0;
+                     cupdlp_float sumProducts = 0.0;
+                     for (HighsInt i = start; i < end; i++) {
+                       cupdlp_float dx = x1[i] - x2[i];
+                       sumSquares += dx * dx;
+                       sumProducts += dx * (y1[i] - y2[i]);
+                     }
+                     partial[0] = sumSquares;
+                     partial[1] = sumProducts;
+                   });
+  *diffTwoNormSquared = result[0];
+  *diffDotDiff = result[1];
+}
+
+void cupdlp_par_axpy(const cupdlp_int n, const cupdlp_float alpha,
+                     const cupdlp_float* x, cupdlp_float* y) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) y[i] += alpha * x[i];
+  });
+}
+
+void cupdlp_par_scale(const cupdlp_int n, const cupdlp_float weight,
+                      cupdlp_float* x) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] *= weight;
+  });
+}
+
+void cupdlp_par_edot(const cupdlp_int n, cupdlp_float* x,
+                     const cupdlp_float* y) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] *= y[i];
+  });
+}
+
+void cupdlp_par_ediv(const cupdlp_int n, cupdlp_float* x,
+                     const cupdlp_float* y) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] /= y[i];
+  });
+}
+
+void cupdlp_par_projLowerBound(const cupdlp_int n, cupdlp_float* x,
+                               const cupdlp_float* lb) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] = x[i] > lb[i] ? x[i] : lb[i];
+  });
+}
+
+void cupdlp_par_projUpperBound(const cupdlp_int n, cupdlp_float* x,
+                               const cupdlp_float* ub) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] = x[i] < ub[i] ? x[i] : ub[i];
+  });
+}
+
+void cupdlp_par_projSameLowerBound(const cupdlp_int n, cupdlp_float* x,
+                                   const cupdlp_float lb) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] = x[i] > lb ? x[i] : lb;
+  });
+}
+
+void cupdlp_par_projSameUpperBound(const cupdlp_int n, cupdlp_float* x,
+                                   const cupdlp_float ub) {
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) x[i] = x[i] < ub ? x[i] : ub;
+  });
+}
+
+// The fused updates evaluate the terms in the same order as the sequence of
+// copy and axpy operations that they replace, so the results are identical.
+void cupdlp_par_primalGradientStep(const cupdlp_int n, cupdlp_float* xUpdate,
+                                   const cupdlp_float* x,
+                                   const cupdlp_float* cost,
+                                   const cupdlp_float* aty,
+                                   const cupdlp_float dPrimalStep) {
+  const cupdlp_float alpha = -dPrimalStep;
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++)
+      xUpdate[i] = (x[i] + alpha * cost[i]) + dPrimalStep * aty[i];
+  });
+}
+
+void cupdlp_par_dualGradientStep(const cupdlp_int n, cupdlp_float* yUpdate,
+                                 const cupdlp_float* y,
+                                 const cupdlp_float* rhs,
+                                 const cupdlp_float* axUpdate,
+                                 const cupdlp_float* ax,
+                                 const cupdlp_float dDualStep) {
+  const cupdlp_float alpha = -2.0 * dDualStep;
+  forEachRange(n, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++)
+      yUpdate[i] =
+          ((y[i] + dDualStep * rhs[i]) + alpha * axUpdate[i]) + dDualStep * ax[i];
+  });
+}
+
+}  // extern "C"
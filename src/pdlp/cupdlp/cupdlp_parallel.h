@@ -0,0 +1,104 @@
+#ifndef CUPDLP_CUPDLP_PARALLEL_H
+#define CUPDLP_CUPDLP_PARALLEL_H
+
+#include "glbopts.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Multithreaded CPU kernels for cuPDLP, implemented using the HiGHS task
+// scheduler. Work is split into tasks only when the scheduler has more than
+// one thread and the vectors are long enough for this to pay off.
+//
+// Reductions accumulate partial results over blocks of fixed size and combine
+// them in block order, so results are independent of the number of
+// threads. For vectors no longer than one block, the result is identical to
+// that of a plain serial loop.
+
+/* ax = A * x, where A is held row-wise */
+void cupdlp_par_csr_Ax(const cupdlp_int nRows, const cupdlp_int *rowMatBeg,
+                       const cupdlp_int *rowMatIdx,
+                       const cupdlp_float *rowMatElem, const cupdlp_float *x,
+                       cupdlp_float *ax);
+
+/* aty = A' * y, where A is held column-wise */
+void cupdlp_par_csc_ATy(const cupdlp_int nCols, const cupdlp_int *colMatBeg,
+                        const cupdlp_int *colMatIdx,
+                        const cupdlp_float *colMatElem, const cupdlp_float *y,
+                        cupdlp_float *aty);
+
+/* x' * y */
+cupdlp_float cupdlp_par_dot(const cupdlp_int n, const cupdlp_float *x,
+                            const cupdlp_float *y);
+
+/* ||x||_2^2 */
+cupdlp_float cupdlp_par_twoNormSquared(const cupdlp_int n,
+                                       const cupdlp_float *x);
+
+/* ||x||_inf */
+cupdlp_float cupdlp_par_infNorm(const cupdlp_int n, const cupdlp_float *x);
+
+/* ||x - y||_2^2 */
+cupdlp_float cupdlp_par_diffTwoNormSquared(const cupdlp_int n,
+                                           const cupdlp_float *x,
+                                           const cupdlp_float *y);
+
+/* ||x1 - x2||_2^2 and (x1 - x2)' (y1 - y2) in a single pass */
+void cupdlp_par_diffTwoNormSquaredAndDotDiff(
+    const cupdlp_int n, const cupdlp_float *x1, const cupdlp_float *x2,
+    const cupdlp_float *y1, const cupdlp_float *y2,
+    cupdlp_float *diffTwoNormSquared, cupdlp_float *diffDotDiff);
+
+/* y = y + alpha * x */
+void cupdlp_par_axpy(const cupdlp_int n, const cupdlp_float alpha,
+                     const cupdlp_float *x, cupdlp_float *y);
+
+/* x = weight * x */
+void cupdlp_par_scale(const cupdlp_int n, const cupdlp_float weight,
+                      cupdlp_float *x);
+
+/* x = x .* y */
+void cupdlp_par_edot(const cupdlp_int n, cupdlp_float *x,
+                     const cupdlp_float *y);
+
+/* x = x ./ y */
+void cupdlp_par_ediv(const cupdlp_int n, cupdlp_float *x,
+                     const cupdlp_float *y);
+
+/* x = max(x, lb) */
+void cupdlp_par_projLowerBound(const cupdlp_int n, cupdlp_float *x,
+                               const cupdlp_float *lb);
+
+/* x = min(x, ub) */
+void cupdlp_par_projUpperBound(const cupdlp_int n, cupdlp_float *x,
+                               const cupdlp_float *ub);
+
+/* x = max(x, lb), lb is a number */
+void cupdlp_par_projSameLowerBound(const cupdlp_int n, cupdlp_float *x,
+                                   const cupdlp_float lb);
+
+/* x = min(x, ub), ub is a number */
+void cupdlp_par_projSameUpperBound(const cupdlp_int n, cupdlp_float *x,
+                                   const cupdlp_float ub);
+
+/* xUpdate = x - dPrimalStep * (cost - aty) */
+void cupdlp_par_primalGradientStep(const cupdlp_int n, cupdlp_float *xUpdate,
+                                   const cupdlp_float *x,
+                                   const cupdlp_float *cost,
+                                   const cupdlp_float *aty,
+                                   const cupdlp_float dPrimalStep);
+
+/* yUpdate = y + dDualStep * (rhs - 2 * axUpdate + ax) */
+void cupdlp_par_dualGradientStep(const cupdlp_int n, cupdlp_float *yUpdate,
+                                 const cupdlp_float *y,
+                                 const cupdlp_float *rhs,
+                                 const cupdlp_float *axUpdate,
+                                 const cupdlp_float *ax,
+                                 const cupdlp_float dDualStep);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // CUPDLP_CUPDLP_PARALLEL_H
@@ -885,6 +885,13 @@ cupdlp_retcode PDHG_Solve(CUPDLPwork *pdhg) {
         break;
       }
 
+      if (pdhg->interruptCheck &&
+          pdhg->interruptCheck(pdhg->interruptData, timers->nIter)) {
+        // cupdlp_printf("Interrupted.\n");
+        resobj->termCode = INTERRUPT;
+        break;
+      }
+
       PDHG_Restart_Iterate(pdhg);
     }
 
@@ -925,6 +932,9 @@ cupdlp_retcode PDHG_Solve(CUPDLPwork *pdhg) {
         cupdlp_printf("Iteration limit reached.\n");
       }
       break;
+    case INTERRUPT:
+      cupdlp_printf("Interrupted.\n");
+      break;
     case INFEASIBLE_OR_UNBOUNDED:
       if (resobj->primalCode == INFEASIBLE && resobj->dualCode == FEASIBLE) {
         cupdlp_printf("Infeasible or unbounded: primal infeasible.");
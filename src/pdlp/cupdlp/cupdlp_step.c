@@ -6,6 +6,7 @@
 
 #include "cupdlp_defs.h"
 #include "cupdlp_linalg.h"
+#include "cupdlp_parallel.h"
 #include "cupdlp_proj.h"
 // #include "cupdlp_scaling.h"
 #include "cupdlp_solver.h"
@@ -20,6 +21,10 @@ void PDHG_primalGradientStep(CUPDLPwork *work, cupdlp_float dPrimalStepSize) {
 #if !defined(CUPDLP_CPU) & USE_KERNELS
   cupdlp_pgrad_cuda(iterates->xUpdate->data, iterates->x->data, problem->cost,
                     iterates->aty->data, dPrimalStepSize, problem->nCols);
+#elif defined(CUPDLP_CPU)
+  cupdlp_par_primalGradientStep(problem->nCols, iterates->xUpdate->data,
+                                iterates->x->data, problem->cost,
+                                iterates->aty->data, dPrimalStepSize);
 #else
 
   // cupdlp_copy(iterates->xUpdate, iterates->x, cupdlp_float, problem->nCols);
@@ -48,6 +53,11 @@ void PDHG_dualGradientStep(CUPDLPwork *work, cupdlp_float dDualStepSize) {
   cupdlp_dgrad_cuda(iterates->yUpdate->data, iterates->y->data, problem->rhs,
                     iterates->ax->data, iterates->axUpdate->data, dDualStepSize,
                     problem->nRows);
+#elif defined(CUPDLP_CPU)
+  cupdlp_par_dualGradientStep(problem->nRows, iterates->yUpdate->data,
+                              iterates->y->data, problem->rhs,
+                              iterates->axUpdate->data, iterates->ax->data,
+                              dDualStepSize);
 #else
 
   // cupdlp_copy(iterates->yUpdate, iterates->y, cupdlp_float, problem->nRows);
@@ -212,6 +222,20 @@ cupdlp_retcode PDHG_Update_Iterate_Adaptive_Step_Size(CUPDLPwork *pdhg) {
 
 #if !defined(CUPDLP_CPU) & USE_KERNELS
     cupdlp_compute_interaction_and_movement(pdhg, &dMovement, &dInteraction);
+#elif defined(CUPDLP_CPU)
+    // \Deltax is needed for both the primal movement and the interaction, so
+    // they are computed in a single pass
+    cupdlp_float dX = 0.0;
+    cupdlp_par_diffTwoNormSquaredAndDotDiff(
+        problem->nCols, iterates->x->data, iterates->xUpdate->data,
+        iterates->aty->data, iterates->atyUpdate->data, &dX, &dInteraction);
+    dX *= 0.5 * sqrt(stepsize->dBeta);
+
+    cupdlp_float dY = 0.0;
+    cupdlp_diffTwoNormSquared(pdhg, iterates->y->data, iterates->yUpdate->data,
+                              problem->nRows, &dY);
+    dY /= 2.0 * sqrt(stepsize->dBeta);
+    dMovement = dX + dY;
 #else
     cupdlp_float dX = 0.0;
     cupdlp_diffTwoNormSquared(pdhg, iterates->x->data, iterates->xUpdate->data,
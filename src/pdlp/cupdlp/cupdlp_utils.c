@@ -1038,6 +1038,9 @@ cupdlp_retcode PDHG_Alloc(CUPDLPwork *w) {
   CUPDLP_INIT_ZERO_DOUBLE_VEC(w->colScale, w->problem->data->nCols);
   CUPDLP_INIT_ZERO_DOUBLE_VEC(w->rowScale, w->problem->data->nRows);
 
+  w->interruptCheck = cupdlp_NULL;
+  w->interruptData = cupdlp_NULL;
+
   CUPDLP_CALL(settings_Alloc(w->settings));
   CUPDLP_CALL(resobj_Alloc(w->resobj, w->problem, w->problem->data->nCols,
                            w->problem->data->nRows));
@@ -1563,7 +1566,8 @@ const char *termCodeNames[] = {"OPTIMAL",
                                "UNBOUNDED",
                                "INFEASIBLE_OR_UNBOUNDED",
                                "TIMELIMIT_OR_ITERLIMIT",
-                               "FEASIBLE"};
+                               "FEASIBLE",
+                               "INTERRUPT"};
 const char *termIterateNames[] = {
     "LAST_ITERATE",
     "AVERAGE_ITERATE",
@@ -26,6 +26,7 @@
 #include "mip/HighsImplications.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsObjectiveFunction.h"
+#include "parallel/HighsParallel.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "test/DevKkt.h"
 #include "util/HFactor.h"
@@ -46,6 +47,12 @@
 
 namespace presolve {
 
+// Minimum number of nonzeros for which the hash values of rows and columns in
+// detectParallelRowsAndCols are computed in parallel, and the approximate
+// number of nonzeros handled by each task
+const HighsInt kMinParallelHashNnz = 100000;
+const HighsInt kParallelHashTaskNnz = 8192;
+
 #ifndef NDEBUG
 void HPresolve::debugPrintRow(HighsPostsolveStack& postsolve_stack,
                               HighsInt row) {
@@ -5442,60 +5449,158 @@ HPresolve::Result HPresolve::detectParallelRowsAndCols(
   rowHashes.assign(rowsize.begin(), rowsize.end());
   colHashes.assign(colsize.begin(), colsize.end());
 
-  // Step 1: Determine scales for rows and columns and remove column singletons
-  // from the initial row hashes which are initialized with the row sizes
-  for (HighsInt i = 0; i != nnz; ++i) {
-    if (Avalue[i] == 0.0) continue;
-    assert(!colDeleted[Acol[i]]);
-    if (colsize[Acol[i]] == 1) {
-      colMax[Acol[i]].first = Avalue[i];
-      --rowHashes[Arow[i]];
-      numRowSingletons[Arow[i]] += 1;
-      continue;
-    }
-    double absVal = std::abs(Avalue[i]);
-    double absRowMax = std::abs(rowMax[Arow[i]].first);
-
-    // among the largest values which are equal in tolerance
-    // we use the nonzero with the smallest row/column index for the column/row
-    // scale so that we ensure that duplicate rows/columns are scaled to have
-    // the same sign
-    if (absVal >= absRowMax - options->small_matrix_value) {
+  // among the largest values which are equal in tolerance
+  // we use the nonzero with the smallest row/column index for the column/row
+  // scale so that we ensure that duplicate rows/columns are scaled to have
+  // the same sign
+  auto updateScale = [&](std::pair<double, HighsInt>& scale, double value,
+                         HighsInt index) {
+    double absVal = std::abs(value);
+    double absMax = std::abs(scale.first);
+    if (absVal >= absMax - options->small_matrix_value) {
       // we are greater or equal with tolerances, check if we are either
       // strictly larger or equal with a smaller index and remember the signed
       // nonzero if one of those things is the case
-      if (absVal > absRowMax + options->small_matrix_value ||
-          Acol[i] < rowMax[Arow[i]].second) {
-        rowMax[Arow[i]].first = Avalue[i];
-        rowMax[Arow[i]].second = Acol[i];
+      if (absVal > absMax + options->small_matrix_value ||
+          index < scale.second) {
+        scale.first = value;
+        scale.second = index;
       }
     }
+  };
 
-    double absColMax = std::abs(colMax[Acol[i]].first);
-    if (absVal >= absColMax - options->small_matrix_value) {
-      if (absVal > absColMax + options->small_matrix_value ||
-          Arow[i] < colMax[Acol[i]].second) {
+  // When the global scheduler has several threads, the scales and hash values
+  // of the rows and columns of a large matrix are computed in parallel. The
+  // nonzeros of each row and column are then visited in order of position, as
+  // in the serial loops, and the hash values do not depend on the order of
+  // their contributions, so the results are identical
+  const bool parallelHashing =
+      nnz >= kMinParallelHashNnz &&
+      HighsTaskExecutor::getThisWorkerDeque() != nullptr &&
+      highs::parallel::num_threads() > 1;
+
+  if (!parallelHashing) {
+    // Step 1: Determine scales for rows and columns and remove column
+    // singletons from the initial row hashes which are initialized with the
+    // row sizes
+    for (HighsInt i = 0; i != nnz; ++i) {
+      if (Avalue[i] == 0.0) continue;
+      assert(!colDeleted[Acol[i]]);
+      if (colsize[Acol[i]] == 1) {
         colMax[Acol[i]].first = Avalue[i];
-        colMax[Acol[i]].second = Arow[i];
+        --rowHashes[Arow[i]];
+        numRowSingletons[Arow[i]] += 1;
+        continue;
       }
+      updateScale(rowMax[Arow[i]], Avalue[i], Acol[i]);
+      updateScale(colMax[Acol[i]], Avalue[i], Arow[i]);
     }
-  }
 
-  // Step 2: Compute hash values for rows and columns excluding singleton
-  // columns
-  for (HighsInt i = 0; i != nnz; ++i) {
-    if (Avalue[i] == 0.0) continue;
-    assert(!rowDeleted[Arow[i]] && !colDeleted[Acol[i]]);
-    if (colsize[Acol[i]] == 1) {
-      colHashes[Acol[i]] = Arow[i];
-    } else {
-      HighsHashHelpers::sparse_combine(rowHashes[Arow[i]], Acol[i],
-                                       HighsHashHelpers::double_hash_code(
-                                           Avalue[i] / rowMax[Arow[i]].first));
-      HighsHashHelpers::sparse_combine(colHashes[Acol[i]], Arow[i],
-                                       HighsHashHelpers::double_hash_code(
-                                           Avalue[i] / colMax[Acol[i]].first));
+    // Step 2: Compute hash values for rows and columns excluding singleton
+    // columns
+    for (HighsInt i = 0; i != nnz; ++i) {
+      if (Avalue[i] == 0.0) continue;
+      assert(!rowDeleted[Arow[i]] && !colDeleted[Acol[i]]);
+      if (colsize[Acol[i]] == 1) {
+        colHashes[Acol[i]] = Arow[i];
+      } else {
+        HighsHashHelpers::sparse_combine(rowHashes[Arow[i]], Acol[i],
+                                         HighsHashHelpers::double_hash_code(
+                                             Avalue[i] / rowMax[Arow[i]].first));
+        HighsHashHelpers::sparse_combine(colHashes[Acol[i]], Arow[i],
+                                         HighsHashHelpers::double_hash_code(
+                                             Avalue[i] / colMax[Acol[i]].first));
+      }
+    }
+  } else {
+    // Bucket the positions of the nonzeros by row and by column in
+    // increasing order
+    const HighsInt numRow = rowsize.size();
+    const HighsInt numCol = colsize.size();
+    std::vector<HighsInt> rowStart(numRow + 1, 0);
+    std::vector<HighsInt> colStart(numCol + 1, 0);
+    for (HighsInt i = 0; i != nnz; ++i) {
+      if (Avalue[i] == 0.0) continue;
+      ++rowStart[Arow[i] + 1];
+      ++colStart[Acol[i] + 1];
     }
+    for (HighsInt row = 0; row != numRow; ++row)
+      rowStart[row + 1] += rowStart[row];
+    for (HighsInt col = 0; col != numCol; ++col)
+      colStart[col + 1] += colStart[col];
+    std::vector<HighsInt> rowPos(rowStart[numRow]);
+    std::vector<HighsInt> colPos(colStart[numCol]);
+    {
+      std::vector<HighsInt> rowNext(rowStart.begin(), rowStart.end() - 1);
+      std::vector<HighsInt> colNext(colStart.begin(), colStart.end() - 1);
+      for (HighsInt i = 0; i != nnz; ++i) {
+        if (Avalue[i] == 0.0) continue;
+        rowPos[rowNext[Arow[i]]++] = i;
+        colPos[colNext[Acol[i]]++] = i;
+      }
+    }
+
+    // Steps 1 and 2 for the rows, counting the column singletons
+    std::vector<HighsInt> rowNumSingletons(numRow, 0);
+    highs::parallel::for_each(
+        0, numRow,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt row = start; row != end; ++row) {
+            for (HighsInt k = rowStart[row]; k != rowStart[row + 1]; ++k) {
+              HighsInt i = rowPos[k];
+              assert(!rowDeleted[row] && !colDeleted[Acol[i]]);
+              if (colsize[Acol[i]] == 1) {
+                --rowHashes[row];
+                ++rowNumSingletons[row];
+              } else {
+                updateScale(rowMax[row], Avalue[i], Acol[i]);
+              }
+            }
+            for (HighsInt k = rowStart[row]; k != rowStart[row + 1]; ++k) {
+              HighsInt i = rowPos[k];
+              if (colsize[Acol[i]] == 1) continue;
+              HighsHashHelpers::sparse_combine(
+                  rowHashes[row], Acol[i],
+                  HighsHashHelpers::double_hash_code(Avalue[i] /
+                                                     rowMax[row].first));
+            }
+          }
+        },
+        std::max(HighsInt{1},
+                 HighsInt(int64_t{numRow} * kParallelHashTaskNnz /
+                          (int64_t{rowStart[numRow]} + 1))));
+
+    // Steps 1 and 2 for the columns
+    highs::parallel::for_each(
+        0, numCol,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt col = start; col != end; ++col) {
+            if (colsize[col] == 1) {
+              HighsInt i = colPos[colStart[col]];
+              colMax[col].first = Avalue[i];
+              colHashes[col] = Arow[i];
+              continue;
+            }
+            for (HighsInt k = colStart[col]; k != colStart[col + 1]; ++k) {
+              HighsInt i = colPos[k];
+              updateScale(colMax[col], Avalue[i], Arow[i]);
+            }
+            for (HighsInt k = colStart[col]; k != colStart[col + 1]; ++k) {
+              HighsInt i = colPos[k];
+              HighsHashHelpers::sparse_combine(
+                  colHashes[col], Arow[i],
+                  HighsHashHelpers::double_hash_code(Avalue[i] /
+                                                     colMax[col].first));
+            }
+          }
+        },
+        std::max(HighsInt{1},
+                 HighsInt(int64_t{numCol} * kParallelHashTaskNnz /
+                          (int64_t{colStart[numCol]} + 1))));
+
+    for (HighsInt row = 0; row != numRow; ++row)
+      if (rowNumSingletons[row] != 0)
+        numRowSingletons[row] = rowNumSingletons[row];
   }
 
   // Step 3: Loop over the rows and columns and put them into buckets using the
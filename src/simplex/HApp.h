@@ -129,9 +129,12 @@ inline HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
   // considering computing scaling factors if there are none - and
   // then move to EKK
   const bool new_scaling = considerScaling(options, incumbent_lp);
-  // If new scaling is performed, the hot start information is
-  // no longer valid
-  if (new_scaling) ekk_instance.clearHotStart();
+  // If new scaling is performed, the hot start information and any
+  // kept dual steepest edge weights are no longer valid
+  if (new_scaling) {
+    ekk_instance.clearHotStart();
+    ekk_instance.kept_dual_edge_weight_.clear();
+  }
   // Move the LP to EKK, updating other EKK pointers and any simplex
   // NLA pointers, since they may have moved if the LP has been
   // modified
@@ -17,6 +17,7 @@
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsCombinable.h"
 #include "parallel/HighsParallel.h"
 #include "simplex/HEkkDual.h"
 #include "simplex/HEkkPrimal.h"
@@ -107,6 +108,7 @@ void HEkk::clearEkkDualize() {
 void HEkk::clearEkkDualEdgeWeightData() {
   this->dual_edge_weight_.clear();
   this->scattered_dual_edge_weight_.clear();
+  this->kept_dual_edge_weight_.clear();
 }
 
 void HEkk::clearEkkData() {
@@ -312,6 +314,7 @@ void HEkk::invalidateBasisArtifacts() {
   // Invalidate the artifacts of the basis of the simplex LP
   this->status_.has_ar_matrix = false;
   this->status_.has_dual_steepest_edge_weights = false;
+  this->kept_dual_edge_weight_.clear();
   this->status_.has_invert = false;
   this->status_.has_fresh_invert = false;
   this->status_.has_fresh_rebuild = false;
@@ -349,13 +352,7 @@ void HEkk::updateStatus(LpAction action) {
       //    this->invalidateBasisArtifacts();
       break;
     case LpAction::kNewRows:
-      if (kExtendInvertWhenAddingRows) {
-        // Just clear Ekk data
-        this->clearEkkData();
-      } else {
-        // Clear everything
-        this->clear();
-      }
+      this->clear();
       this->clearHotStart();
       //    this->invalidateBasisArtifacts();
       break;
@@ -397,6 +394,17 @@ void HEkk::updateStatus(LpAction action) {
       this->status_.has_dual_objective_value = false;
       this->status_.has_primal_objective_value = false;
       break;
+    case LpAction::kKeepInvert:
+      // The basis matrix is unchanged, or its factorization has been
+      // extended, so keep the simplex basis and NLA. Data that depend
+      // on the dimensions of the LP, or the variable indices, are not
+      // valid
+      this->clearEkkDataStatus();
+      this->info_.valid_backtracking_basis_ = false;
+      this->simplex_nla_.frozenBasisClearAllData();
+      this->clearBadBasisChange();
+      this->clearHotStart();
+      break;
     default:
       break;
   }
@@ -429,6 +437,18 @@ void HEkk::ftran(HVector& rhs, const double expected_density) {
   simplex_nla_.ftran(rhs, expected_density);
 }
 
+void HEkk::btranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                      const double expected_density) {
+  assert(status_.has_nla);
+  simplex_nla_.btranBlock(block, num_rhs, expected_density);
+}
+
+void HEkk::ftranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                      const double expected_density) {
+  assert(status_.has_nla);
+  simplex_nla_.ftranBlock(block, num_rhs, expected_density);
+}
+
 void HEkk::moveLp(HighsLpSolverObject& solver_object) {
   // Move the incumbent LP to EKK
   HighsLp& incumbent_lp = solver_object.lp_;
@@ -1139,6 +1159,15 @@ HighsStatus HEkk::solve(const bool force_phase2) {
   // Can model_status_ = HighsModelStatus::kNotset be returned?
   assert(model_status_ != HighsModelStatus::kNotset);
 
+  if (simplex_nla_.factor_.getReachCache()) {
+    simplex_nla_.factor_.getReachCacheCount(analysis_.num_reach_cache_lookup,
+                                            analysis_.num_reach_cache_hit);
+    highsLogDev(options_->log_options, HighsLogType::kInfo,
+                "Reach cache: %" HIGHSINT_FORMAT " hits from %" HIGHSINT_FORMAT
+                " hyper-sparse solves\n",
+                analysis_.num_reach_cache_hit,
+                analysis_.num_reach_cache_lookup);
+  }
   if (analysis_.analyse_simplex_summary_data) analysis_.summaryReport();
   if (analysis_.analyse_factor_data) analysis_.reportInvertFormData();
   if (analysis_.analyse_factor_time) analysis_.reportFactorTimer();
@@ -1287,8 +1316,41 @@ void HEkk::addCols(const HighsLp& lp,
   //  }
   //  if (valid_simplex_lp)
   //    assert(ekk_instance_.lp_.dimensionsOk("addCols - simplex"));
-  if (this->status_.has_nla) this->simplex_nla_.addCols(&lp);
-  this->updateStatus(LpAction::kNewCols);
+  // The basis matrix is unchanged by new nonbasic columns so, if the
+  // dual steepest edge weights are to be kept, the basic variables'
+  // weights are those of their rows. The simplex basis has already
+  // been extended by the new columns, so any weights kept when rows
+  // were added must be shifted for the logicals
+  const HighsInt num_new_col = scaled_a_matrix.num_col_;
+  std::vector<double> kept_dual_edge_weight;
+  if (this->status_.has_dual_steepest_edge_weights &&
+      this->status_.has_basis && this->basisDimensionsOk(lp) && options_ &&
+      options_->dual_steepest_edge_weight_keep) {
+    const HighsInt num_row = lp.num_row_;
+    assert((HighsInt)this->dual_edge_weight_.size() >= num_row);
+    kept_dual_edge_weight.assign(lp.num_col_ + num_row, 0);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      kept_dual_edge_weight[basis_.basicIndex_[iRow]] =
+          this->dual_edge_weight_[iRow];
+  } else if (this->kept_dual_edge_weight_.size()) {
+    const HighsInt num_col = lp.num_col_ - num_new_col;
+    kept_dual_edge_weight.assign(this->kept_dual_edge_weight_.size() +
+                                     num_new_col,
+                                 0);
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      kept_dual_edge_weight[iCol] = this->kept_dual_edge_weight_[iCol];
+    for (HighsInt iVar = num_col;
+         iVar < (HighsInt)this->kept_dual_edge_weight_.size(); iVar++)
+      kept_dual_edge_weight[num_new_col + iVar] =
+          this->kept_dual_edge_weight_[iVar];
+  }
+  if (this->extendInvertOk(lp, 0)) {
+    this->simplex_nla_.addCols(&lp);
+    this->updateStatus(LpAction::kKeepInvert);
+  } else {
+    this->updateStatus(LpAction::kNewCols);
+  }
+  this->kept_dual_edge_weight_ = std::move(kept_dual_edge_weight);
 }
 
 void HEkk::addRows(const HighsLp& lp,
@@ -1303,17 +1365,70 @@ void HEkk::addRows(const HighsLp& lp,
   //  }
   //  if (valid_simplex_lp)
   //    assert(ekk_instance_.lp_.dimensionsOk("addRows - simplex"));
-  if (kExtendInvertWhenAddingRows && this->status_.has_nla) {
-    this->simplex_nla_.addRows(&lp, basis_.basicIndex_.data(),
-                               &scaled_ar_matrix);
-    setNlaPointersForTrans(lp);
-    this->debugNlaCheckInvert("HEkk::addRows - on entry",
-                              kHighsDebugLevelExpensive + 1);
+  // The basis matrix is extended by the rows of the new constraints
+  // and the columns of their logicals so, if the logicals are basic,
+  // the dual steepest edge weights of the current basic variables are
+  // unchanged. Keep them, or any kept when rows were previously
+  // added. The simplex basis has already been extended by the basic
+  // logicals of the new rows
+  std::vector<double> kept_dual_edge_weight;
+  if (this->status_.has_dual_steepest_edge_weights &&
+      this->status_.has_basis && options_ &&
+      options_->dual_steepest_edge_weight_keep) {
+    const HighsInt num_row = lp.num_row_ - scaled_ar_matrix.num_row_;
+    assert((HighsInt)this->dual_edge_weight_.size() >= num_row);
+    kept_dual_edge_weight.assign(lp.num_col_ + num_row, 0);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      kept_dual_edge_weight[basis_.basicIndex_[iRow]] =
+          this->dual_edge_weight_[iRow];
+  } else {
+    kept_dual_edge_weight.swap(this->kept_dual_edge_weight_);
   }
   // Update the number of rows in the simplex LP so that it's
   // consistent with simplex basis information
   this->lp_.num_row_ = lp.num_row_;
-  this->updateStatus(LpAction::kNewRows);
+  if (this->extendInvertOk(lp, scaled_ar_matrix.num_row_)) {
+    // Extend the factorization of the basis matrix by the new rows
+    // and their basic logicals
+    this->simplex_nla_.addRows(&lp, basis_.basicIndex_.data(),
+                               &scaled_ar_matrix);
+    setNlaPointersForTrans(lp);
+    this->debugNlaCheckInvert("HEkk::addRows - after extending INVERT");
+    highsLogDev(options_->log_options, HighsLogType::kDetailed,
+                "HEkk::addRows: Extended INVERT by %d rows to dimension %d\n",
+                (int)scaled_ar_matrix.num_row_, (int)lp.num_row_);
+    this->updateStatus(LpAction::kKeepInvert);
+  } else {
+    this->updateStatus(LpAction::kNewRows);
+  }
+  this->kept_dual_edge_weight_ = std::move(kept_dual_edge_weight);
+}
+
+bool HEkk::basisDimensionsOk(const HighsLp& lp) const {
+  // The simplex basis is only extended when columns or rows are added
+  // if there is a valid HiGHS basis
+  return (HighsInt)this->basis_.basicIndex_.size() == lp.num_row_ &&
+         (HighsInt)this->basis_.nonbasicFlag_.size() ==
+             lp.num_col_ + lp.num_row_;
+}
+
+bool HEkk::extendInvertOk(const HighsLp& lp,
+                          const HighsInt num_new_row) const {
+  // The factorization of the basis matrix can be extended by new
+  // nonbasic columns, and by new rows whose logicals are basic, until
+  // the number of rows added since INVERT exceeds a fraction of its
+  // dimension
+  if (!options_ || !options_->simplex_extend_invert) return false;
+  if (!this->status_.has_basis || !this->status_.has_nla ||
+      !this->status_.has_invert)
+    return false;
+  if (this->status_.is_dualized || this->status_.is_permuted) return false;
+  if (!this->basisDimensionsOk(lp)) return false;
+  const HighsInt num_extended_row =
+      this->simplex_nla_.num_extended_row_ + num_new_row;
+  const HighsInt invert_num_row =
+      this->simplex_nla_.factor_.num_row - this->simplex_nla_.num_extended_row_;
+  return num_extended_row <= kExtendInvertMaxRowFraction * invert_num_row;
 }
 
 void HEkk::deleteCols(const HighsIndexCollection& index_collection) {
@@ -1401,6 +1516,34 @@ HighsSolution HEkk::getSolution() {
   return solution;
 }
 
+HighsSolution HEkk::getUnscaledSolution() const {
+  HighsSolution solution;
+  solution.col_value.resize(lp_.num_col_);
+  solution.col_dual.resize(lp_.num_col_);
+  solution.row_value.resize(lp_.num_row_);
+  solution.row_dual.resize(lp_.num_row_);
+  std::vector<double> value = info_.workValue_;
+  std::vector<double> dual = info_.workDual_;
+  for (HighsInt iRow = 0; iRow < lp_.num_row_; iRow++) {
+    value[basis_.basicIndex_[iRow]] = info_.baseValue_[iRow];
+    dual[basis_.basicIndex_[iRow]] = 0;
+  }
+  for (HighsInt iCol = 0; iCol < lp_.num_col_; iCol++) {
+    solution.col_value[iCol] = value[iCol];
+    solution.col_dual[iCol] = (HighsInt)lp_.sense_ * dual[iCol];
+  }
+  for (HighsInt iRow = 0; iRow < lp_.num_row_; iRow++) {
+    solution.row_value[iRow] = -value[lp_.num_col_ + iRow];
+    // @FlipRowDual negate RHS
+    solution.row_dual[iRow] =
+        -(HighsInt)lp_.sense_ * dual[lp_.num_col_ + iRow];
+  }
+  if (lp_.is_scaled_) unscaleSolution(solution, lp_.scale_);
+  solution.value_valid = true;
+  solution.dual_valid = true;
+  return solution;
+}
+
 HighsBasis HEkk::getHighsBasis(HighsLp& use_lp) const {
   HighsInt num_col = use_lp.num_col_;
   HighsInt num_row = use_lp.num_row_;
@@ -1625,6 +1768,24 @@ void HEkk::initialiseForSolve() {
   updateSimplexOptions();
   initialiseSimplexLpRandomVectors();
   initialisePartitionedRowwiseMatrix();  // Timed
+  if (simplex_nla_.num_extended_row_) {
+    // The factorization has been extended by new rows, so check its
+    // accuracy, and refactor if the solution error is too large
+    const double error_tolerance =
+        options_->rebuild_refactor_solution_error_tolerance;
+    const double solution_error =
+        error_tolerance > 0 ? factorSolveError() : 0;
+    if (solution_error > error_tolerance) {
+      highsLogDev(options_->log_options, HighsLogType::kDetailed,
+                  "HEkk::initialiseForSolve: Extended INVERT has solution "
+                  "error %g, so refactor\n",
+                  solution_error);
+      clearNlaInvertStatus();
+      const HighsStatus refactor_status = initialiseSimplexLpBasisAndFactor();
+      assert(refactor_status == HighsStatus::kOk);
+      initialisePartitionedRowwiseMatrix();
+    }
+  }
   allocateWorkAndBaseArrays();
   initialiseCost(SimplexAlgorithm::kPrimal, kSolvePhaseUnknown, false);
   initialiseBound(SimplexAlgorithm::kPrimal, kSolvePhaseUnknown, false);
@@ -1774,6 +1935,13 @@ void HEkk::chooseSimplexStrategyThreads(const HighsOptions& options,
 
   // Set the concurrency to be used to be the maximum number
   info.num_concurrency = info.max_concurrency;
+  // The serial dual and primal simplex can partition the loops of
+  // their iterations across threads, performing the same iterations
+  info.parallel_iteration = options.simplex_parallel_iteration &&
+                            (simplex_strategy == kSimplexStrategyDual ||
+                             simplex_strategy == kSimplexStrategyPrimal) &&
+                            max_threads > 1 &&
+                            HighsTaskExecutor::getThisWorkerDeque() != nullptr;
   // Give a warning if the concurrency to be used is less than the
   // minimum concurrency allowed
   if (info.num_concurrency < simplex_min_concurrency) {
@@ -2037,6 +2205,13 @@ HighsInt HEkk::computeFactor() {
   clearBadBasisChange();
   highsAssert(lpFactorRowCompatible(),
               "HEkk::computeFactor: lpFactorRowCompatible");
+  if (simplex_nla_.num_extended_row_ || simplex_nla_.num_extended_col_) {
+    // The factorization has been extended since INVERT, so HFactor
+    // must be set up for the dimensions and matrix of the current LP
+    simplex_nla_.setup(&lp_, basis_.basicIndex_.data(), options_, timer_,
+                       &analysis_, getScaledAMatrixPointer(),
+                       info_.factor_pivot_threshold);
+  }
   // Perform INVERT
   analysis_.simplexTimerStart(InvertClock);
   const HighsInt rank_deficiency = simplex_nla_.invert();
@@ -2078,12 +2253,21 @@ void HEkk::computeDualSteepestEdgeWeights(const bool initial) {
     analysis_.simplexTimerStart(SimplexIzDseWtClock);
     analysis_.simplexTimerStart(DseIzClock);
   }
+  const double start_time = timer_->getWallTime();
   const HighsInt num_row = lp_.num_row_;
-  HVector row_ep;
-  row_ep.setup(num_row);
   assert((HighsInt)dual_edge_weight_.size() >= num_row);
-  for (HighsInt iRow = 0; iRow < num_row; iRow++)
-    dual_edge_weight_[iRow] = computeDualSteepestEdgeWeight(iRow, row_ep);
+  if (options_->dual_steepest_edge_weight_block) {
+    std::vector<HighsInt> row(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) row[iRow] = iRow;
+    computeDualSteepestEdgeWeightBlocks(row);
+  } else {
+    HVector row_ep;
+    row_ep.setup(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      dual_edge_weight_[iRow] = computeDualSteepestEdgeWeight(iRow, row_ep);
+  }
+  analysis_.num_dual_edge_weight_computed += num_row;
+  analysis_.dual_edge_weight_time += timer_->getWallTime() - start_time;
   if (analysis_.analyse_simplex_time) {
     analysis_.simplexTimerStop(SimplexIzDseWtClock);
     analysis_.simplexTimerStop(DseIzClock);
@@ -2110,6 +2294,150 @@ double HEkk::computeDualSteepestEdgeWeight(const HighsInt iRow,
   return row_ep.norm2();
 }
 
+// Workspace for computing blocks of exact DSE weights
+struct DualEdgeWeightWork {
+  std::vector<double> block;
+  HVector row_ep;
+};
+
+void HEkk::computeDualSteepestEdgeWeightBlocks(
+    const std::vector<HighsInt>& row) {
+  // Compute the exact DSE weights for the given rows in blocks, using
+  // a BTRAN with multiple RHS unless the rows of the inverse are
+  // expected to be sparse. The blocks are independent, so they are
+  // computed in parallel when threads are available. Since they
+  // don't depend on the number of threads, neither do the weights
+  const HighsInt num_row = lp_.num_row_;
+  const HighsInt num_weight = row.size();
+  // Compute the weights for the first block one at a time, so that
+  // the density of the rows of the inverse is known for the rest
+  const HighsInt num_first = std::min(kDualEdgeWeightBlockSize, num_weight);
+  HVector row_ep;
+  row_ep.setup(num_row);
+  for (HighsInt k = 0; k < num_first; k++)
+    dual_edge_weight_[row[k]] = computeDualSteepestEdgeWeight(row[k], row_ep);
+  const HighsInt num_block =
+      (num_weight - num_first + kDualEdgeWeightBlockSize - 1) /
+      kDualEdgeWeightBlockSize;
+  if (num_block == 0) return;
+  const double expected_density = info_.row_ep_density;
+  const bool use_block =
+      kDualEdgeWeightBlockSize * expected_density >= kBlockTranMinDensity;
+  std::vector<HighsInt> result_count(num_weight);
+  auto computeBlock = [&](const HighsInt iBlock, DualEdgeWeightWork& work) {
+    const HighsInt from = num_first + iBlock * kDualEdgeWeightBlockSize;
+    const HighsInt num_rhs =
+        std::min(kDualEdgeWeightBlockSize, num_weight - from);
+    if (use_block) {
+      std::vector<double>& block = work.block;
+      block.assign(num_row * num_rhs, 0);
+      for (HighsInt k = 0; k < num_rhs; k++)
+        block[row[from + k] * num_rhs + k] = 1;
+      simplex_nla_.btranBlockInScaledSpace(block, num_rhs, expected_density);
+      double weight[kDualEdgeWeightBlockSize] = {};
+      HighsInt count[kDualEdgeWeightBlockSize] = {};
+      for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+        const double* value = &block[iRow * num_rhs];
+        for (HighsInt k = 0; k < num_rhs; k++) {
+          if (!value[k]) continue;
+          weight[k] += value[k] * value[k];
+          count[k]++;
+        }
+      }
+      for (HighsInt k = 0; k < num_rhs; k++) {
+        dual_edge_weight_[row[from + k]] = weight[k];
+        result_count[from + k] = count[k];
+      }
+    } else {
+      HVector& local_row_ep = work.row_ep;
+      if ((HighsInt)local_row_ep.array.size() != num_row)
+        local_row_ep.setup(num_row);
+      for (HighsInt k = 0; k < num_rhs; k++) {
+        const HighsInt iRow = row[from + k];
+        local_row_ep.clear();
+        local_row_ep.count = 1;
+        local_row_ep.index[0] = iRow;
+        local_row_ep.array[iRow] = 1;
+        local_row_ep.packFlag = false;
+        simplex_nla_.btranInScaledSpace(local_row_ep, expected_density);
+        dual_edge_weight_[iRow] = local_row_ep.norm2();
+        result_count[from + k] = local_row_ep.count;
+      }
+    }
+  };
+  const bool parallel = num_block > 1 &&
+                        HighsTaskExecutor::getThisWorkerDeque() != nullptr &&
+                        highs::parallel::num_threads() > 1;
+  if (parallel) {
+    auto work = makeHighsCombinable<DualEdgeWeightWork>(
+        []() { return DualEdgeWeightWork(); });
+    highs::parallel::for_each(
+        0, num_block,
+        [&](HighsInt from_block, HighsInt to_block) {
+          DualEdgeWeightWork& local_work = work.local();
+          for (HighsInt iBlock = from_block; iBlock < to_block; iBlock++)
+            computeBlock(iBlock, local_work);
+        },
+        1);
+  } else {
+    DualEdgeWeightWork work;
+    for (HighsInt iBlock = 0; iBlock < num_block; iBlock++)
+      computeBlock(iBlock, work);
+  }
+  // Update the density of the rows of the inverse in order
+  for (HighsInt k = num_first; k < num_weight; k++)
+    updateOperationResultDensity((1.0 * result_count[k]) / num_row,
+                                 info_.row_ep_density);
+}
+
+bool HEkk::useKeptDualSteepestEdgeWeights() {
+  // DSE weights were kept when rows were added to the LP. They are
+  // the weights of the current basic variables other than logicals
+  // of the new rows if the remaining basic variables are those for
+  // which the weights were kept, in which case only the weights of
+  // the new logicals need to be computed
+  const HighsInt num_kept = kept_dual_edge_weight_.size();
+  if (!num_kept) return false;
+  const double start_time = timer_->getWallTime();
+  const HighsInt num_row = lp_.num_row_;
+  const HighsInt num_kept_row = num_kept - lp_.num_col_;
+  bool valid = !status_.is_dualized && !status_.is_permuted &&
+               num_kept_row >= 0 && num_kept_row <= num_row;
+  std::vector<HighsInt> new_row;
+  for (HighsInt iRow = 0; valid && iRow < num_row; iRow++) {
+    const HighsInt iVar = basis_.basicIndex_[iRow];
+    if (iVar >= num_kept) {
+      new_row.push_back(iRow);
+    } else if (kept_dual_edge_weight_[iVar] > 0) {
+      dual_edge_weight_[iRow] = kept_dual_edge_weight_[iVar];
+    } else {
+      valid = false;
+    }
+  }
+  kept_dual_edge_weight_.clear();
+  if (!valid || num_row - (HighsInt)new_row.size() != num_kept_row)
+    return false;
+  if (options_->dual_steepest_edge_weight_block) {
+    computeDualSteepestEdgeWeightBlocks(new_row);
+  } else {
+    HVector row_ep;
+    row_ep.setup(num_row);
+    for (const HighsInt iRow : new_row)
+      dual_edge_weight_[iRow] = computeDualSteepestEdgeWeight(iRow, row_ep);
+  }
+  const HighsInt num_new_row = new_row.size();
+  analysis_.num_dual_edge_weight_kept += num_kept_row;
+  analysis_.num_dual_edge_weight_computed += num_new_row;
+  const double time = timer_->getWallTime() - start_time;
+  analysis_.dual_edge_weight_time += time;
+  highsLogDev(options_->log_options, HighsLogType::kDetailed,
+              "Kept %" HIGHSINT_FORMAT
+              " DSE weights and computed %" HIGHSINT_FORMAT
+              " for new rows in %gs\n",
+              num_kept_row, num_new_row, time);
+  return true;
+}
+
 // Update the DSE weights
 void HEkk::updateDualSteepestEdgeWeights(
     const HighsInt row_out, const HighsInt variable_in, const HVector* column,
@@ -2874,16 +3202,22 @@ void HEkk::tableauRowPrice(const bool quad_precision, const HVector& row_ep,
     }
   }
   row_ap.clear();
+  const bool parallel = info_.parallel_iteration && !quad_precision;
   if (use_col_price) {
     // Perform column-wise PRICE
-    lp_.a_matrix_.priceByColumn(quad_precision, row_ap, row_ep, debug_report);
+    if (parallel) {
+      lp_.a_matrix_.parallelPriceByColumn(row_ap, row_ep);
+    } else {
+      lp_.a_matrix_.priceByColumn(quad_precision, row_ap, row_ep,
+                                  debug_report);
+    }
   } else if (use_row_price_w_switch) {
     // Perform hyper-sparse row-wise PRICE, but switch if the density of row_ap
     // becomes extreme
     const double switch_density = kHyperPriceDensity;
     ar_matrix_.priceByRowWithSwitch(quad_precision, row_ap, row_ep,
                                     info_.row_ap_density, 0, switch_density,
-                                    debug_report);
+                                    debug_report, parallel);
   } else {
     // Perform hyper-sparse row-wise PRICE
     ar_matrix_.priceByRow(quad_precision, row_ap, row_ep, debug_report);
@@ -89,6 +89,10 @@ class HEkk {
   void clearHotStart();
   void btran(HVector& rhs, const double expected_density);
   void ftran(HVector& rhs, const double expected_density);
+  void btranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                  const double expected_density);
+  void ftranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                  const double expected_density);
 
   void moveLp(HighsLpSolverObject& solver_object);
   void setPointers(HighsCallback* callback, HighsOptions* options,
@@ -131,6 +135,9 @@ class HEkk {
                          HVector& residual, double& residual_norm);
 
   HighsSolution getSolution();
+  // The unscaled solution, formed without modifying the simplex data
+  // so that the solver can continue
+  HighsSolution getUnscaledSolution() const;
   HighsBasis getHighsBasis(HighsLp& use_lp) const;
 
   const SimplexBasis& getSimplexBasis() { return basis_; }
@@ -168,6 +175,10 @@ class HEkk {
 
   // Data members
   HighsCallback* callback_;
+  // If defined, called with the unscaled solution when the dual
+  // simplex solver uses primal simplex to clean up, and run
+  // concurrently with it
+  std::function<void(const HighsSolution&)> cleanup_callback_;
   HighsOptions* options_;
   HighsTimer* timer_;
   HighsSimplexAnalysis analysis_;
@@ -182,6 +193,9 @@ class HEkk {
   HighsRandom random_;
   std::vector<double> dual_edge_weight_;
   std::vector<double> scattered_dual_edge_weight_;
+  // Dual steepest edge weights of the basic variables, indexed by
+  // variable, kept when rows are added to the LP
+  std::vector<double> kept_dual_edge_weight_;
 
   bool simplex_in_scaled_space_;
   HighsSparseMatrix ar_matrix_;
@@ -263,6 +277,10 @@ class HEkk {
   HighsInt computeFactor();
   void computeDualSteepestEdgeWeights(const bool initial = false);
   double computeDualSteepestEdgeWeight(const HighsInt iRow, HVector& row_ep);
+  void computeDualSteepestEdgeWeightBlocks(const std::vector<HighsInt>& row);
+  bool useKeptDualSteepestEdgeWeights();
+  bool basisDimensionsOk(const HighsLp& lp) const;
+  bool extendInvertOk(const HighsLp& lp, const HighsInt num_new_row) const;
   void updateDualSteepestEdgeWeights(const HighsInt row_out,
                                      const HighsInt variable_in,
                                      const HVector* column,
@@ -158,7 +158,14 @@ HighsStatus HEkkDual::solve(const bool pass_force_phase2) {
         status.has_dual_steepest_edge_weights = true;
       } else {
         // Non-logical basis
-        if (near_optimal) {
+        if (ekk_instance_.useKeptDualSteepestEdgeWeights()) {
+          // Weights kept when rows were added to the LP are valid, so
+          // use them even if the basis is near-optimal
+          highsLogDev(options.log_options, HighsLogType::kDetailed,
+                      "Basis is not logical, but steepest edge weights have "
+                      "been kept\n");
+          status.has_dual_steepest_edge_weights = true;
+        } else if (near_optimal) {
           // Use Devex rather than compute steepest edge weights
           highsLogDev(
               options.log_options, HighsLogType::kDetailed,
@@ -360,7 +367,24 @@ HighsStatus HEkkDual::solve(const bool pass_force_phase2) {
           info.primal_simplex_bound_perturbation_multiplier;
       info.primal_simplex_bound_perturbation_multiplier = 0;
       HEkkPrimal primal_solver(ekk_instance_);
-      HighsStatus call_status = primal_solver.solve(true);
+      HighsStatus call_status;
+      if (ekk_instance_.cleanup_callback_ &&
+          solve_phase == kSolvePhaseOptimalCleanup &&
+          !ekk_instance_.status_.is_dualized &&
+          !ekk_instance_.status_.is_permuted) {
+        // Give the cleanup callback the primal feasible solution
+        // before cleanup, and run it concurrently with primal simplex
+        const HighsSolution cleanup_solution =
+            ekk_instance_.getUnscaledSolution();
+        highs::parallel::TaskGroup cleanup_tg;
+        cleanup_tg.spawn([&]() {
+          ekk_instance_.cleanup_callback_(cleanup_solution);
+        });
+        call_status = primal_solver.solve(true);
+        cleanup_tg.taskWait();
+      } else {
+        call_status = primal_solver.solve(true);
+      }
       // Restore any bound perturbation
       info.primal_simplex_bound_perturbation_multiplier =
           save_primal_simplex_bound_perturbation_multiplier;
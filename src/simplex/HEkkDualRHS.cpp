@@ -19,7 +19,9 @@
 #include <set>
 
 #include "../extern/pdqsort/pdqsort.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HighsSimd.h"
 
 using std::fill_n;
 using std::make_pair;
@@ -27,6 +29,27 @@ using std::min;
 using std::nth_element;
 using std::pair;
 
+// Scan the rows in positions [from, to) of work_index for CHUZR in
+// SPARSE mode
+static HighsInt chooseMeritSparse(const HighsInt* work_index,
+                                  const double* infeasibility,
+                                  const double* edge_weight,
+                                  const HighsInt from, const HighsInt to,
+                                  double& best_merit, HighsInt best_index) {
+  for (HighsInt i = from; i < to; i++) {
+    HighsInt iRow = work_index[i];
+    if (infeasibility[iRow] > kHighsZero) {
+      const double myInfeas = infeasibility[iRow];
+      const double myWeight = edge_weight[iRow];
+      if (best_merit * myWeight < myInfeas) {
+        best_merit = myInfeas / myWeight;
+        best_index = iRow;
+      }
+    }
+  }
+  return best_index;
+}
+
 void HEkkDualRHS::setup() {
   const HighsInt numRow = ekk_instance_.lp_.num_row_;
   workMark.resize(numRow);
@@ -63,20 +86,17 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
     HighsInt randomStart = ekk_instance_.random_.integer(numRow);
     double bestMerit = 0;
     HighsInt bestIndex = -1;
-    for (HighsInt section = 0; section < 2; section++) {
-      const HighsInt start = (section == 0) ? randomStart : 0;
-      const HighsInt end = (section == 0) ? numRow : randomStart;
-      for (HighsInt iRow = start; iRow < end; iRow++) {
-        if (work_infeasibility[iRow] > kHighsZero) {
-          const double myInfeas = work_infeasibility[iRow];
-          const double myWeight = edge_weight[iRow];
-          //	  printf("Dense: Row %4" HIGHSINT_FORMAT " weight = %g\n", iRow,
-          // myWeight);
-          if (bestMerit * myWeight < myInfeas) {
-            bestMerit = myInfeas / myWeight;
-            bestIndex = iRow;
-          }
-        }
+    if (ekk_instance_.info_.parallel_iteration &&
+        numRow >= 2 * kParallelIterationGrain) {
+      const bool dense = true;
+      bestIndex = parallelChooseNormal(numRow, randomStart, dense, bestMerit);
+    } else {
+      for (HighsInt section = 0; section < 2; section++) {
+        const HighsInt start = (section == 0) ? randomStart : 0;
+        const HighsInt end = (section == 0) ? numRow : randomStart;
+        bestIndex = highsSimdChooseMerit(work_infeasibility.data(),
+                                         edge_weight.data(), start, end,
+                                         bestMerit, bestIndex);
       }
     }
     *chIndex = bestIndex;
@@ -86,24 +106,19 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
     double bestMerit = 0;
     HighsInt bestIndex = -1;
     std::vector<double>& edge_weight = ekk_instance_.dual_edge_weight_;
-    for (HighsInt section = 0; section < 2; section++) {
-      const HighsInt start = (section == 0) ? randomStart : 0;
-      const HighsInt end = (section == 0) ? workCount : randomStart;
-      for (HighsInt i = start; i < end; i++) {
-        HighsInt iRow = workIndex[i];
-        if (work_infeasibility[iRow] > kHighsZero) {
-          const double myInfeas = work_infeasibility[iRow];
-          const double myWeight = edge_weight[iRow];
-          /*
-          const double myMerit = myInfeas / myWeight;
-          printf("CHUZR: iRow = %6" HIGHSINT_FORMAT "; Infeas = %11.4g; Weight =
-          %11.4g; Merit = %11.4g\n", iRow, myInfeas, myWeight, myMerit);
-          */
-          if (bestMerit * myWeight < myInfeas) {
-            bestMerit = myInfeas / myWeight;
-            bestIndex = iRow;
-          }
-        }
+    if (ekk_instance_.info_.parallel_iteration &&
+        workCount >= 2 * kParallelIterationGrain) {
+      const bool dense = false;
+      bestIndex =
+          parallelChooseNormal(workCount, randomStart, dense, bestMerit);
+    } else {
+      for (HighsInt section = 0; section < 2; section++) {
+        const HighsInt start = (section == 0) ? randomStart : 0;
+        const HighsInt end = (section == 0) ? workCount : randomStart;
+        bestIndex = chooseMeritSparse(workIndex.data(),
+                                      work_infeasibility.data(),
+                                      edge_weight.data(), start, end,
+                                      bestMerit, bestIndex);
       }
     }
 
@@ -124,6 +139,62 @@ void HEkkDualRHS::chooseNormal(HighsInt* chIndex) {
   if (!keep_timer_running) analysis->simplexTimerStop(ChuzrDualClock);
 }
 
+HighsInt HEkkDualRHS::parallelChooseNormal(const HighsInt count,
+                                           const HighsInt random_start,
+                                           const bool dense,
+                                           double& best_merit) {
+  // The scan from random_start is split into chunks of consecutive
+  // positions, each of which forms at most two ranges of positions
+  const double* infeasibility = work_infeasibility.data();
+  const double* edge_weight = ekk_instance_.dual_edge_weight_.data();
+  const HighsInt grain = kParallelIterationGrain;
+  const HighsInt num_chunk = (count + grain - 1) / grain;
+  auto chunkRanges = [&](const HighsInt chunk, HighsInt* from, HighsInt* to) {
+    const HighsInt length = min(grain, count - chunk * grain);
+    from[0] = random_start + chunk * grain;
+    if (from[0] >= count) from[0] -= count;
+    to[0] = min(count, from[0] + length);
+    from[1] = 0;
+    to[1] = length - (to[0] - from[0]);
+  };
+  auto scanRange = [&](const HighsInt from, const HighsInt to,
+                       double& merit, const HighsInt index) -> HighsInt {
+    if (dense)
+      return highsSimdChooseMerit(infeasibility, edge_weight, from, to,
+                                  merit, index);
+    return chooseMeritSparse(workIndex.data(), infeasibility, edge_weight,
+                             from, to, merit, index);
+  };
+  // In parallel, scan each chunk from a merit of zero. The resulting
+  // merit is the greatest merit in the chunk, up to rounding errors
+  std::vector<double> chunk_merit(num_chunk, 0);
+  highs::parallel::for_each(
+      0, num_chunk,
+      [&](HighsInt from_chunk, HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++) {
+          HighsInt from[2], to[2];
+          chunkRanges(chunk, from, to);
+          for (HighsInt range = 0; range < 2; range++)
+            scanRange(from[range], to[range], chunk_merit[chunk], -1);
+        }
+      },
+      1);
+  // Scan the chunks in order, skipping those whose merit is smaller
+  // than the best merit by more than any rounding errors, since none
+  // of their rows would be chosen. The row chosen is thus that of the
+  // serial scan
+  const double merit_margin = 1 + 1e-9;
+  HighsInt best_index = -1;
+  for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+    if (chunk_merit[chunk] * merit_margin < best_merit) continue;
+    HighsInt from[2], to[2];
+    chunkRanges(chunk, from, to);
+    for (HighsInt range = 0; range < 2; range++)
+      best_index = scanRange(from[range], to[range], best_merit, best_index);
+  }
+  return best_index;
+}
+
 void HEkkDualRHS::chooseMultiGlobal(HighsInt* chIndex, HighsInt* chCount,
                                     HighsInt chLimit) {
   analysis->simplexTimerStart(ChuzrDualClock);
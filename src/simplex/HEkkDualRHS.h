@@ -45,6 +45,17 @@ class HEkkDualRHS {
       HighsInt* chIndex  //!< Row index of variable chosen to leave the basis
   );
 
+  /**
+   * @brief Choose the same row as chooseNormal, partitioning its scan
+   * across threads
+   */
+  HighsInt parallelChooseNormal(
+      const HighsInt count,         //!< Number of rows to scan
+      const HighsInt random_start,  //!< Position from which to scan
+      const bool dense,        //!< Scan all rows, rather than workIndex
+      double& best_merit       //!< Merit of the row chosen
+  );
+
   /**
    * @brief Choose a set of row indices of good variables to leave the basis
    * (Multiple CHUZR)
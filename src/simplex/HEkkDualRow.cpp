@@ -17,9 +17,11 @@
 #include <iostream>
 
 #include "../extern/pdqsort/pdqsort.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HSimplexDebug.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsCDouble.h"
+#include "util/HighsSimd.h"
 #include "util/HighsSort.h"
 
 using std::make_pair;
@@ -70,14 +72,21 @@ void HEkkDualRow::chooseMakepack(const HVector* row, const HighsInt offset) {
    * Offset of numCol is used when packing row_ep
    */
   const HighsInt rowCount = row->count;
-  const HighsInt* rowIndex = row->index.data();
-  const double* rowArray = row->array.data();
-  for (HighsInt i = 0; i < rowCount; i++) {
-    const HighsInt index = rowIndex[i];
-    const double value = rowArray[index];
-    packIndex[packCount] = index + offset;
-    packValue[packCount++] = value;
+  if (ekk_instance_.info_.parallel_iteration &&
+      rowCount >= 2 * kParallelIterationGrain) {
+    highs::parallel::for_each(
+        0, rowCount,
+        [&](HighsInt from, HighsInt to) {
+          highsSimdGatherPack(row->array.data(), &row->index[from], to - from,
+                              offset, &packIndex[packCount + from],
+                              &packValue[packCount + from]);
+        },
+        kParallelIterationGrain);
+  } else {
+    highsSimdGatherPack(row->array.data(), row->index.data(), rowCount,
+                        offset, &packIndex[packCount], &packValue[packCount]);
   }
+  packCount += rowCount;
 }
 
 void HEkkDualRow::choosePossible() {
@@ -93,15 +102,44 @@ void HEkkDualRow::choosePossible() {
   workTheta = kHighsInf;
   workCount = 0;
 
-  for (HighsInt i = 0; i < packCount; i++) {
-    const HighsInt iCol = packIndex[i];
-    const HighsInt move = workMove[iCol];
-    const double alpha = packValue[i] * move_out * move;
-    if (alpha > Ta) {
-      workData[workCount++] = make_pair(iCol, alpha);
-      const double relax = workDual[iCol] * move + Td;
-      if (workTheta * alpha > relax) workTheta = relax / alpha;
+  // Filter the candidates, and then find the bound on theta for them
+  if (ekk_instance_.info_.parallel_iteration &&
+      packCount >= 2 * kParallelIterationGrain) {
+    // Filter each chunk of candidates in parallel into the
+    // corresponding positions of workData, and then close the gaps,
+    // retaining the order of the candidates
+    const HighsInt grain = kParallelIterationGrain;
+    const HighsInt num_chunk = (packCount + grain - 1) / grain;
+    std::vector<HighsInt> chunk_count(num_chunk);
+    highs::parallel::for_each(
+        0, num_chunk,
+        [&](HighsInt from_chunk, HighsInt to_chunk) {
+          for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++) {
+            const HighsInt from = chunk * grain;
+            chunk_count[chunk] = highsSimdFilterPossible(
+                &packIndex[from], &packValue[from],
+                min(grain, packCount - from), workMove, move_out, Ta,
+                &workData[from]);
+          }
+        },
+        1);
+    for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+      const HighsInt from = chunk * grain;
+      std::copy(&workData[from], &workData[from] + chunk_count[chunk],
+                &workData[workCount]);
+      workCount += chunk_count[chunk];
     }
+  } else {
+    workCount = highsSimdFilterPossible(packIndex.data(), packValue.data(),
+                                        packCount, workMove, move_out, Ta,
+                                        workData.data());
+  }
+  for (HighsInt i = 0; i < workCount; i++) {
+    const HighsInt iCol = workData[i].first;
+    const double alpha = workData[i].second;
+    const HighsInt move = workMove[iCol];
+    const double relax = workDual[iCol] * move + Td;
+    if (workTheta * alpha > relax) workTheta = relax / alpha;
   }
 }
 
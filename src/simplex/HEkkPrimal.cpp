@@ -14,6 +14,7 @@
 #include "simplex/HEkkPrimal.h"
 
 #include "../extern/pdqsort/pdqsort.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HEkkDual.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsSort.h"
@@ -791,7 +792,7 @@ void HEkkPrimal::rebuild() {
   if (solve_phase == kSolvePhase1) {
     use_hyper_chuzc = false;
   } else {
-    use_hyper_chuzc = false;  // true;
+    use_hyper_chuzc = ekk_instance_.options_->primal_simplex_hyper_chuzc;
   }
   hyperChooseColumnClear();
 
@@ -848,7 +849,13 @@ void HEkkPrimal::iterate() {
   if (solve_phase == kSolvePhase1) {
     phase1ChooseRow();
     assert(row_out != kNoRowSought);
-    if (row_out == kNoRowChosen) {
+    // No row is chosen when a boxed entering variable is to be
+    // flipped
+    const HighsSimplexInfo& info = ekk_instance_.info_;
+    const bool boxed_in =
+        info.workUpper_[variable_in] - info.workLower_[variable_in] <
+        kHighsInf;
+    if (row_out == kNoRowChosen && !boxed_in) {
       highsLogDev(ekk_instance_.options_->log_options, HighsLogType::kError,
                   "Primal phase 1 choose row failed\n");
       solve_phase = kSolvePhaseError;
@@ -865,9 +872,8 @@ void HEkkPrimal::iterate() {
   //
   // rebuild_reason = kRebuildReasonPossiblyPrimalUnbounded is set
   // in phase 2 if there's no pivot or bound swap. In phase 1 there is
-  // always a pivot at this stage since row_out < 0 is trapped (above)
-  // as an error.
-  assert(solve_phase == kSolvePhase2 || row_out >= 0);
+  // always a pivot or bound swap at this stage since row_out < 0 is
+  // otherwise trapped (above) as an error.
   considerBoundSwap();
   if (rebuild_reason == kRebuildReasonPossiblyPrimalUnbounded) return;
   assert(!rebuild_reason);
@@ -931,9 +937,11 @@ void HEkkPrimal::chuzc() {
   vector<double>& workDual = ekk_instance_.info_.workDual_;
   ekk_instance_.applyTabooVariableIn(workDual, 0);
   if (use_hyper_chuzc) {
-    // Perform hyper-sparse CHUZC and then check result using full CHUZC
+    // Perform hyper-sparse CHUZC and then, when debugging, check the
+    // result using full CHUZC
     if (!done_next_chuzc) chooseColumn(true);
-    const bool check_hyper_chuzc = true;
+    const bool check_hyper_chuzc = ekk_instance_.options_->highs_debug_level >=
+                                   kHighsDebugLevelCostly;
     if (check_hyper_chuzc) {
       HighsInt hyper_sparse_variable_in = variable_in;
       chooseColumn(false);
@@ -1050,15 +1058,12 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
       }
     }
     // Now look at other columns
-    for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
-      double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
-      if (dual_infeasibility > dual_feasibility_tolerance &&
-          dual_infeasibility * dual_infeasibility >
-              best_measure * edge_weight_[iCol]) {
-        variable_in = iCol;
-        best_measure =
-            dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
-      }
+    if (ekk_instance_.info_.parallel_iteration &&
+        num_tot >= 2 * kParallelIterationGrain) {
+      parallelChooseColumn(best_measure);
+    } else {
+      variable_in =
+          chooseColumnMeasure(0, num_tot, best_measure, variable_in);
     }
     analysis->simplexTimerStop(ChuzcPrimalClock);
   }
@@ -1067,6 +1072,52 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
   //	 ekk_instance_.iteration_count_, variable_in, best_measure);
 }
 
+HighsInt HEkkPrimal::chooseColumnMeasure(const HighsInt from,
+                                         const HighsInt to,
+                                         double& best_measure,
+                                         HighsInt best_index) const {
+  const vector<int8_t>& nonbasicMove = ekk_instance_.basis_.nonbasicMove_;
+  const vector<double>& workDual = ekk_instance_.info_.workDual_;
+  for (HighsInt iCol = from; iCol < to; iCol++) {
+    double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+    if (dual_infeasibility > dual_feasibility_tolerance &&
+        dual_infeasibility * dual_infeasibility >
+            best_measure * edge_weight_[iCol]) {
+      best_index = iCol;
+      best_measure =
+          dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
+    }
+  }
+  return best_index;
+}
+
+void HEkkPrimal::parallelChooseColumn(double& best_measure) {
+  // In parallel, scan chunks of the variables from a measure of
+  // zero. The resulting measure is the greatest measure in the chunk,
+  // up to rounding errors
+  const HighsInt grain = kParallelIterationGrain;
+  const HighsInt num_chunk = (num_tot + grain - 1) / grain;
+  std::vector<double> chunk_measure(num_chunk, 0);
+  highs::parallel::for_each(
+      0, num_chunk,
+      [&](HighsInt from_chunk, HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++)
+          chooseColumnMeasure(chunk * grain, min(num_tot, (chunk + 1) * grain),
+                              chunk_measure[chunk], -1);
+      },
+      1);
+  // Scan the chunks in order, skipping those whose measure is smaller
+  // than the best measure by more than any rounding errors, so the
+  // variable chosen is that of the serial scan
+  const double measure_margin = 1 + 1e-9;
+  for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+    if (chunk_measure[chunk] * measure_margin < best_measure) continue;
+    variable_in =
+        chooseColumnMeasure(chunk * grain, min(num_tot, (chunk + 1) * grain),
+                            best_measure, variable_in);
+  }
+}
+
 bool HEkkPrimal::useVariableIn() {
   // rebuild_reason = kRebuildReasonPossiblySingularBasis is set if
   // numerical trouble is detected
@@ -1133,9 +1184,6 @@ bool HEkkPrimal::useVariableIn() {
 
 void HEkkPrimal::phase1ChooseRow() {
   const HighsSimplexInfo& info = ekk_instance_.info_;
-  const vector<double>& baseLower = info.baseLower_;
-  const vector<double>& baseUpper = info.baseUpper_;
-  const vector<double>& baseValue = info.baseValue_;
   analysis->simplexTimerStart(Chuzr1Clock);
   // Collect phase 1 theta lists
   //
@@ -1145,59 +1193,41 @@ void HEkkPrimal::phase1ChooseRow() {
                                                     : 1e-7;
   ph1SorterR.clear();
   ph1SorterT.clear();
-  for (HighsInt i = 0; i < col_aq.count; i++) {
-    HighsInt iRow = col_aq.index[i];
-    double dAlpha = col_aq.array[iRow] * move_in;
-
-    // When the basic variable x[i] decrease
-    if (dAlpha > +dPivotTol) {
-      // Whether it can become feasible by going below its upper bound
-      if (baseValue[iRow] > baseUpper[iRow] + primal_feasibility_tolerance) {
-        double dFeasTheta =
-            (baseValue[iRow] - baseUpper[iRow] - primal_feasibility_tolerance) /
-            dAlpha;
-        ph1SorterR.push_back(std::make_pair(dFeasTheta, iRow));
-        ph1SorterT.push_back(std::make_pair(dFeasTheta, iRow));
-      }
-      // Whether it can become infeasible (again) by going below its
-      // lower bound
-      if (baseValue[iRow] > baseLower[iRow] - primal_feasibility_tolerance &&
-          baseLower[iRow] > -kHighsInf) {
-        double dRelaxTheta =
-            (baseValue[iRow] - baseLower[iRow] + primal_feasibility_tolerance) /
-            dAlpha;
-        double dTightTheta = (baseValue[iRow] - baseLower[iRow]) / dAlpha;
-        ph1SorterR.push_back(std::make_pair(dRelaxTheta, iRow - num_row));
-        ph1SorterT.push_back(std::make_pair(dTightTheta, iRow - num_row));
-      }
-    }
-
-    // When the basic variable x[i] increase
-    if (dAlpha < -dPivotTol) {
-      // Whether it can become feasible by going above its lower bound
-      if (baseValue[iRow] < baseLower[iRow] - primal_feasibility_tolerance) {
-        double dFeasTheta =
-            (baseValue[iRow] - baseLower[iRow] + primal_feasibility_tolerance) /
-            dAlpha;
-        ph1SorterR.push_back(std::make_pair(dFeasTheta, iRow - num_row));
-        ph1SorterT.push_back(std::make_pair(dFeasTheta, iRow - num_row));
-      }
-      // Whether it can become infeasible (again) by going above its
-      // upper bound
-      if (baseValue[iRow] < baseUpper[iRow] + primal_feasibility_tolerance &&
-          baseUpper[iRow] < +kHighsInf) {
-        double dRelaxTheta =
-            (baseValue[iRow] - baseUpper[iRow] - primal_feasibility_tolerance) /
-            dAlpha;
-        double dTightTheta = (baseValue[iRow] - baseUpper[iRow]) / dAlpha;
-        ph1SorterR.push_back(std::make_pair(dRelaxTheta, iRow));
-        ph1SorterT.push_back(std::make_pair(dTightTheta, iRow));
-      }
+  const HighsInt grain = kParallelIterationGrain;
+  if (info.parallel_iteration && col_aq.count >= 2 * grain) {
+    // Collect the breakpoints of chunks of col_aq in parallel, and
+    // concatenate them in order
+    const HighsInt num_chunk = (col_aq.count + grain - 1) / grain;
+    vector<vector<pair<double, int> > > chunk_sorter_r(num_chunk);
+    vector<vector<pair<double, int> > > chunk_sorter_t(num_chunk);
+    highs::parallel::for_each(
+        0, num_chunk,
+        [&](HighsInt from_chunk, HighsInt to_chunk) {
+          for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++)
+            phase1ChooseRowBreakpoints(
+                dPivotTol, chunk * grain,
+                min(col_aq.count, (chunk + 1) * grain),
+                chunk_sorter_r[chunk], chunk_sorter_t[chunk]);
+        },
+        1);
+    for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+      ph1SorterR.insert(ph1SorterR.end(), chunk_sorter_r[chunk].begin(),
+                        chunk_sorter_r[chunk].end());
+      ph1SorterT.insert(ph1SorterT.end(), chunk_sorter_t[chunk].begin(),
+                        chunk_sorter_t[chunk].end());
     }
+  } else {
+    phase1ChooseRowBreakpoints(dPivotTol, 0, col_aq.count, ph1SorterR,
+                               ph1SorterT);
   }
 
   analysis->simplexTimerStop(Chuzr1Clock);
-  // When there are no candidates at all, we can leave it here
+  // The entering variable can't move further than its range, at
+  // which point it would be flipped
+  const double range_in =
+      info.workUpper_[variable_in] - info.workLower_[variable_in];
+  // When there are no candidates at all, we can leave it here, and
+  // any boxed entering variable is flipped
   if (ph1SorterR.empty()) {
     row_out = kNoRowChosen;
     variable_out = -1;
@@ -1214,6 +1244,9 @@ void HEkkPrimal::phase1ChooseRow() {
   double dGradient = fabs(theta_dual);
   for (size_t i = 0; i < ph1SorterR.size(); i++) {
     double dMyTheta = ph1SorterR.at(i).first;
+    // Stop when the entering variable would be flipped before
+    // reaching the break point
+    if (dMyTheta > range_in) break;
     HighsInt index = ph1SorterR.at(i).second;
     HighsInt iRow = index >= 0 ? index : index + num_row;
     dGradient -= fabs(col_aq.array[iRow]);
@@ -1223,6 +1256,15 @@ void HEkkPrimal::phase1ChooseRow() {
     }
     dMaxTheta = dMyTheta;
   }
+  if (dGradient > 0 && range_in < kHighsInf) {
+    // The infeasibilities decrease until the entering variable
+    // reaches its other bound, so take the long step of flipping it,
+    // rather than pivoting at a break point before it
+    row_out = kNoRowChosen;
+    variable_out = -1;
+    analysis->simplexTimerStop(Chuzr2Clock);
+    return;
+  }
 
   // Find out the biggest possible alpha for pivot
   pdqsort(ph1SorterT.begin(), ph1SorterT.end());
@@ -1261,11 +1303,68 @@ void HEkkPrimal::phase1ChooseRow() {
   analysis->simplexTimerStop(Chuzr2Clock);
 }
 
-void HEkkPrimal::chooseRow() {
-  HighsSimplexInfo& info = ekk_instance_.info_;
+void HEkkPrimal::phase1ChooseRowBreakpoints(
+    const double alpha_tolerance, const HighsInt from, const HighsInt to,
+    vector<pair<double, int> >& sorter_r,
+    vector<pair<double, int> >& sorter_t) const {
+  const HighsSimplexInfo& info = ekk_instance_.info_;
   const vector<double>& baseLower = info.baseLower_;
   const vector<double>& baseUpper = info.baseUpper_;
   const vector<double>& baseValue = info.baseValue_;
+  for (HighsInt i = from; i < to; i++) {
+    HighsInt iRow = col_aq.index[i];
+    double dAlpha = col_aq.array[iRow] * move_in;
+
+    // When the basic variable x[i] decrease
+    if (dAlpha > +alpha_tolerance) {
+      // Whether it can become feasible by going below its upper bound
+      if (baseValue[iRow] > baseUpper[iRow] + primal_feasibility_tolerance) {
+        double dFeasTheta =
+            (baseValue[iRow] - baseUpper[iRow] - primal_feasibility_tolerance) /
+            dAlpha;
+        sorter_r.push_back(std::make_pair(dFeasTheta, iRow));
+        sorter_t.push_back(std::make_pair(dFeasTheta, iRow));
+      }
+      // Whether it can become infeasible (again) by going below its
+      // lower bound
+      if (baseValue[iRow] > baseLower[iRow] - primal_feasibility_tolerance &&
+          baseLower[iRow] > -kHighsInf) {
+        double dRelaxTheta =
+            (baseValue[iRow] - baseLower[iRow] + primal_feasibility_tolerance) /
+            dAlpha;
+        double dTightTheta = (baseValue[iRow] - baseLower[iRow]) / dAlpha;
+        sorter_r.push_back(std::make_pair(dRelaxTheta, iRow - num_row));
+        sorter_t.push_back(std::make_pair(dTightTheta, iRow - num_row));
+      }
+    }
+
+    // When the basic variable x[i] increase
+    if (dAlpha < -alpha_tolerance) {
+      // Whether it can become feasible by going above its lower bound
+      if (baseValue[iRow] < baseLower[iRow] - primal_feasibility_tolerance) {
+        double dFeasTheta =
+            (baseValue[iRow] - baseLower[iRow] + primal_feasibility_tolerance) /
+            dAlpha;
+        sorter_r.push_back(std::make_pair(dFeasTheta, iRow - num_row));
+        sorter_t.push_back(std::make_pair(dFeasTheta, iRow - num_row));
+      }
+      // Whether it can become infeasible (again) by going above its
+      // upper bound
+      if (baseValue[iRow] < baseUpper[iRow] + primal_feasibility_tolerance &&
+          baseUpper[iRow] < +kHighsInf) {
+        double dRelaxTheta =
+            (baseValue[iRow] - baseUpper[iRow] - primal_feasibility_tolerance) /
+            dAlpha;
+        double dTightTheta = (baseValue[iRow] - baseUpper[iRow]) / dAlpha;
+        sorter_r.push_back(std::make_pair(dRelaxTheta, iRow));
+        sorter_t.push_back(std::make_pair(dTightTheta, iRow));
+      }
+    }
+  }
+}
+
+void HEkkPrimal::chooseRow() {
+  HighsSimplexInfo& info = ekk_instance_.info_;
   analysis->simplexTimerStart(Chuzr1Clock);
   // Initialize
   row_out = kNoRowChosen;
@@ -1275,49 +1374,130 @@ void HEkkPrimal::chooseRow() {
                     : info.update_count < 20 ? 1e-8
                                              : 1e-7;
 
-  double relaxTheta = 1e100;
+  if (info.parallel_iteration &&
+      col_aq.count >= 2 * kParallelIterationGrain) {
+    parallelChooseRow(alphaTol);
+  } else {
+    double relaxTheta = chooseRowRelaxTheta(alphaTol, 0, col_aq.count, 1e100);
+    analysis->simplexTimerStop(Chuzr1Clock);
+
+    analysis->simplexTimerStart(Chuzr2Clock);
+    double bestAlpha = 0;
+    row_out = chooseRowPivot(alphaTol, relaxTheta, 0, col_aq.count, bestAlpha,
+                             row_out);
+  }
+  analysis->simplexTimerStop(Chuzr2Clock);
+}
+
+double HEkkPrimal::chooseRowRelaxTheta(const double alpha_tolerance,
+                                       const HighsInt from, const HighsInt to,
+                                       double relax_theta) const {
+  const HighsSimplexInfo& info = ekk_instance_.info_;
+  const vector<double>& baseLower = info.baseLower_;
+  const vector<double>& baseUpper = info.baseUpper_;
+  const vector<double>& baseValue = info.baseValue_;
   double relaxSpace;
-  for (HighsInt i = 0; i < col_aq.count; i++) {
+  for (HighsInt i = from; i < to; i++) {
     HighsInt iRow = col_aq.index[i];
     double alpha = col_aq.array[iRow] * move_in;
-    if (alpha > alphaTol) {
+    if (alpha > alpha_tolerance) {
       relaxSpace =
           baseValue[iRow] - baseLower[iRow] + primal_feasibility_tolerance;
-      if (relaxSpace < relaxTheta * alpha) relaxTheta = relaxSpace / alpha;
-    } else if (alpha < -alphaTol) {
+      if (relaxSpace < relax_theta * alpha) relax_theta = relaxSpace / alpha;
+    } else if (alpha < -alpha_tolerance) {
       relaxSpace =
           baseValue[iRow] - baseUpper[iRow] - primal_feasibility_tolerance;
-      if (relaxSpace > relaxTheta * alpha) relaxTheta = relaxSpace / alpha;
+      if (relaxSpace > relax_theta * alpha) relax_theta = relaxSpace / alpha;
     }
   }
-  analysis->simplexTimerStop(Chuzr1Clock);
+  return relax_theta;
+}
 
-  analysis->simplexTimerStart(Chuzr2Clock);
-  double bestAlpha = 0;
-  for (HighsInt i = 0; i < col_aq.count; i++) {
+HighsInt HEkkPrimal::chooseRowPivot(const double alpha_tolerance,
+                                    const double relax_theta,
+                                    const HighsInt from, const HighsInt to,
+                                    double& best_alpha,
+                                    HighsInt best_row) const {
+  const HighsSimplexInfo& info = ekk_instance_.info_;
+  const vector<double>& baseLower = info.baseLower_;
+  const vector<double>& baseUpper = info.baseUpper_;
+  const vector<double>& baseValue = info.baseValue_;
+  for (HighsInt i = from; i < to; i++) {
     HighsInt iRow = col_aq.index[i];
     double alpha = col_aq.array[iRow] * move_in;
-    if (alpha > alphaTol) {
+    if (alpha > alpha_tolerance) {
       // Positive pivotal column entry
       double tightSpace = baseValue[iRow] - baseLower[iRow];
-      if (tightSpace < relaxTheta * alpha) {
-        if (bestAlpha < alpha) {
-          bestAlpha = alpha;
-          row_out = iRow;
+      if (tightSpace < relax_theta * alpha) {
+        if (best_alpha < alpha) {
+          best_alpha = alpha;
+          best_row = iRow;
         }
       }
-    } else if (alpha < -alphaTol) {
+    } else if (alpha < -alpha_tolerance) {
       // Negative pivotal column entry
       double tightSpace = baseValue[iRow] - baseUpper[iRow];
-      if (tightSpace > relaxTheta * alpha) {
-        if (bestAlpha < -alpha) {
-          bestAlpha = -alpha;
-          row_out = iRow;
+      if (tightSpace > relax_theta * alpha) {
+        if (best_alpha < -alpha) {
+          best_alpha = -alpha;
+          best_row = iRow;
         }
       }
     }
   }
-  analysis->simplexTimerStop(Chuzr2Clock);
+  return best_row;
+}
+
+void HEkkPrimal::parallelChooseRow(const double alpha_tolerance) {
+  const HighsInt count = col_aq.count;
+  const HighsInt grain = kParallelIterationGrain;
+  const HighsInt num_chunk = (count + grain - 1) / grain;
+  // In parallel, perform pass 1 on chunks of col_aq. The resulting
+  // theta is the least in the chunk, up to rounding errors. Then scan
+  // the chunks in order, skipping those whose theta exceeds the
+  // current theta by more than any rounding errors, so the theta is
+  // that of the serial pass
+  vector<double> chunk_theta(num_chunk);
+  highs::parallel::for_each(
+      0, num_chunk,
+      [&](HighsInt from_chunk, HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++)
+          chunk_theta[chunk] =
+              chooseRowRelaxTheta(alpha_tolerance, chunk * grain,
+                                  min(count, (chunk + 1) * grain), 1e100);
+      },
+      1);
+  double relax_theta = 1e100;
+  for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+    if (chunk_theta[chunk] - relax_theta > 1e-9 * fabs(relax_theta)) continue;
+    relax_theta =
+        chooseRowRelaxTheta(alpha_tolerance, chunk * grain,
+                            min(count, (chunk + 1) * grain), relax_theta);
+  }
+  analysis->simplexTimerStop(Chuzr1Clock);
+
+  analysis->simplexTimerStart(Chuzr2Clock);
+  // Pass 2 chooses the first pivot of greatest magnitude, so the
+  // chunks can be scanned in parallel and compared in order
+  vector<double> chunk_alpha(num_chunk, 0);
+  vector<HighsInt> chunk_row(num_chunk, kNoRowChosen);
+  highs::parallel::for_each(
+      0, num_chunk,
+      [&](HighsInt from_chunk, HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++)
+          chunk_row[chunk] = chooseRowPivot(
+              alpha_tolerance, relax_theta, chunk * grain,
+              min(count, (chunk + 1) * grain), chunk_alpha[chunk],
+              kNoRowChosen);
+      },
+      1);
+  double best_alpha = 0;
+  for (HighsInt chunk = 0; chunk < num_chunk; chunk++) {
+    if (best_alpha < chunk_alpha[chunk]) {
+      best_alpha = chunk_alpha[chunk];
+      row_out = chunk_row[chunk];
+    }
+  }
 }
 
 void HEkkPrimal::considerBoundSwap() {
@@ -1332,7 +1512,6 @@ void HEkkPrimal::considerBoundSwap() {
   // Compute the primal theta and see if we should have done a bound
   // flip instead
   if (row_out == kNoRowChosen) {
-    assert(solve_phase == kSolvePhase2);
     // No binding ratio in CHUZR, so flip or unbounded
     theta_primal = move_in * kHighsInf;
     move_out = 0;
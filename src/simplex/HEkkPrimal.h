@@ -52,9 +52,24 @@ class HEkkPrimal {
   void iterate();
   void chuzc();
   void chooseColumn(const bool hyper_sparse = false);
+  HighsInt chooseColumnMeasure(const HighsInt from, const HighsInt to,
+                               double& best_measure,
+                               HighsInt best_index) const;
+  void parallelChooseColumn(double& best_measure);
   bool useVariableIn();
   void phase1ChooseRow();
+  void phase1ChooseRowBreakpoints(const double alpha_tolerance,
+                                  const HighsInt from, const HighsInt to,
+                                  vector<pair<double, int> >& sorter_r,
+                                  vector<pair<double, int> >& sorter_t) const;
   void chooseRow();
+  double chooseRowRelaxTheta(const double alpha_tolerance, const HighsInt from,
+                             const HighsInt to, double relax_theta) const;
+  HighsInt chooseRowPivot(const double alpha_tolerance,
+                          const double relax_theta, const HighsInt from,
+                          const HighsInt to, double& best_alpha,
+                          HighsInt best_row) const;
+  void parallelChooseRow(const double alpha_tolerance);
 
   void considerBoundSwap();
   void assessPivot();
@@ -34,12 +34,15 @@ void HSimplexNla::setup(const HighsLp* lp, HighsInt* basic_index,
   this->timer_ = timer;
   this->analysis_ = analysis;
   this->report_ = false;
+  this->num_extended_row_ = 0;
+  this->num_extended_col_ = 0;
   this->factor_.setupGeneral(
       this->lp_->num_col_, this->lp_->num_row_, this->lp_->num_row_,
       factor_a_matrix->start_.data(), factor_a_matrix->index_.data(),
       factor_a_matrix->value_.data(), this->basic_index_,
       factor_pivot_threshold, this->options_->factor_pivot_tolerance,
       this->options_->highs_debug_level, &(this->options_->log_options));
+  this->factor_.setReachCache(this->options_->factor_reach_cache);
   assert(debugCheckData("After HSimplexNla::setup") == HighsDebugStatus::kOk);
 }
 
@@ -77,6 +80,8 @@ void HSimplexNla::clear() {
   analysis_ = NULL;
   report_ = false;
   build_synthetic_tick_ = 0;
+  num_extended_row_ = 0;
+  num_extended_col_ = 0;
   this->frozenBasisClearAllData();
 }
 
@@ -94,6 +99,8 @@ HighsInt HSimplexNla::invert() {
   // Must not have timed out
   assert(rank_deficiency >= 0);
   build_synthetic_tick_ = factor_.build_synthetic_tick;
+  num_extended_row_ = 0;
+  num_extended_col_ = 0;
   // Clear any frozen basis updates
   frozenBasisClearAllUpdate();
   return rank_deficiency;
@@ -113,6 +120,27 @@ void HSimplexNla::ftran(HVector& rhs, const double expected_density,
   applyBasisMatrixColScale(rhs);
 }
 
+void HSimplexNla::btranBlock(
+    std::vector<double>& block, const HighsInt num_rhs,
+    const double expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  applyBasisMatrixColScale(block, num_rhs);
+  btranBlockInScaledSpace(block, num_rhs, expected_density,
+                          factor_timer_clock_pointer);
+  applyBasisMatrixRowScale(block, num_rhs);
+}
+
+void HSimplexNla::ftranBlock(
+    std::vector<double>& block, const HighsInt num_rhs,
+    const double expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  applyBasisMatrixRowScale(block, num_rhs);
+  factor_.ftranBlock(block, num_rhs, expected_density,
+                     factor_timer_clock_pointer);
+  frozenTranBlock(block, num_rhs, false);
+  applyBasisMatrixColScale(block, num_rhs);
+}
+
 void HSimplexNla::btranInScaledSpace(
     HVector& rhs, const double expected_density,
     HighsTimerClock* factor_timer_clock_pointer) const {
@@ -120,6 +148,15 @@ void HSimplexNla::btranInScaledSpace(
   factor_.btranCall(rhs, expected_density, factor_timer_clock_pointer);
 }
 
+void HSimplexNla::btranBlockInScaledSpace(
+    std::vector<double>& block, const HighsInt num_rhs,
+    const double expected_density,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  frozenTranBlock(block, num_rhs, true);
+  factor_.btranBlock(block, num_rhs, expected_density,
+                     factor_timer_clock_pointer);
+}
+
 void HSimplexNla::ftranInScaledSpace(
     HVector& rhs, const double expected_density,
     HighsTimerClock* factor_timer_clock_pointer) const {
@@ -159,6 +196,32 @@ void HSimplexNla::frozenFtran(HVector& rhs) const {
   update_.ftran(rhs);
 }
 
+void HSimplexNla::frozenTranBlock(std::vector<double>& block,
+                                  const HighsInt num_rhs,
+                                  const bool transpose) const {
+  if (first_frozen_basis_id_ == kNoLink) return;
+  // Apply the product form updates to each RHS in turn
+  const HighsInt num_row = lp_->num_row_;
+  HVector rhs;
+  rhs.setup(num_row);
+  for (HighsInt k = 0; k < num_rhs; k++) {
+    rhs.clear();
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      const double value = block[iRow * num_rhs + k];
+      if (value == 0) continue;
+      rhs.index[rhs.count++] = iRow;
+      rhs.array[iRow] = value;
+    }
+    if (transpose) {
+      frozenBtran(rhs);
+    } else {
+      frozenFtran(rhs);
+    }
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      block[iRow * num_rhs + k] = rhs.array[iRow];
+  }
+}
+
 void HSimplexNla::update(HVector* aq, HVector* ep, HighsInt* iRow,
                          HighsInt* hint) {
   reportPackValue("  pack: aq Bf ", aq);
@@ -313,6 +376,33 @@ void HSimplexNla::applyBasisMatrixColScale(HVector& rhs) const {
   }
 }
 
+void HSimplexNla::applyBasisMatrixRowScale(std::vector<double>& block,
+                                           const HighsInt num_rhs) const {
+  if (scale_ == NULL) return;
+  const vector<double>& row_scale = scale_->row;
+  for (HighsInt iRow = 0; iRow < lp_->num_row_; iRow++) {
+    double* row = &block[iRow * num_rhs];
+    for (HighsInt k = 0; k < num_rhs; k++) row[k] *= row_scale[iRow];
+  }
+}
+
+void HSimplexNla::applyBasisMatrixColScale(std::vector<double>& block,
+                                           const HighsInt num_rhs) const {
+  if (scale_ == NULL) return;
+  const vector<double>& col_scale = scale_->col;
+  const vector<double>& row_scale = scale_->row;
+  for (HighsInt iCol = 0; iCol < lp_->num_row_; iCol++) {
+    double* row = &block[iCol * num_rhs];
+    HighsInt iVar = basic_index_[iCol];
+    if (iVar < lp_->num_col_) {
+      for (HighsInt k = 0; k < num_rhs; k++) row[k] *= col_scale[iVar];
+    } else {
+      const double scale = row_scale[iVar - lp_->num_col_];
+      for (HighsInt k = 0; k < num_rhs; k++) row[k] /= scale;
+    }
+  }
+}
+
 void HSimplexNla::unapplyBasisMatrixRowScale(HVector& rhs) const {
   if (scale_ == NULL) return;
   const vector<double>& row_scale = scale_->row;
@@ -333,6 +423,10 @@ void HSimplexNla::addCols(const HighsLp* updated_lp) {
   // resized. The HFactor matrix isn't needed until reinversion has to
   // be performed
   setLpAndScalePointers(updated_lp);
+  const HighsInt num_new_col = updated_lp->num_col_ - factor_.num_col;
+  assert(num_new_col >= 0);
+  factor_.addCols(num_new_col);
+  num_extended_col_ += num_new_col;
 }
 
 void HSimplexNla::addRows(const HighsLp* updated_lp, HighsInt* basic_index,
@@ -345,6 +439,7 @@ void HSimplexNla::addRows(const HighsLp* updated_lp, HighsInt* basic_index,
   basic_index_ = basic_index;
   factor_.basic_index = basic_index;
   factor_.addRows(scaled_ar_matrix);
+  num_extended_row_ += scaled_ar_matrix->num_row_;
 }
 
 bool HSimplexNla::sparseLoopStyle(const HighsInt count, const HighsInt dim,
@@ -79,14 +79,26 @@ class HSimplexNla {
              HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void ftran(HVector& rhs, const double expected_density,
              HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void btranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                  const double expected_density,
+                  HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void ftranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                  const double expected_density,
+                  HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void btranInScaledSpace(
       HVector& rhs, const double expected_density,
       HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+  void btranBlockInScaledSpace(
+      std::vector<double>& block, const HighsInt num_rhs,
+      const double expected_density,
+      HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void ftranInScaledSpace(
       HVector& rhs, const double expected_density,
       HighsTimerClock* factor_timer_clock_pointer = NULL) const;
   void frozenBtran(HVector& rhs) const;
   void frozenFtran(HVector& rhs) const;
+  void frozenTranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                       const bool transpose) const;
   void update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint);
 
   void frozenBasisClearAllData();
@@ -111,6 +123,10 @@ class HSimplexNla {
   void passScalePointer(const HighsScale* scale);
   void applyBasisMatrixColScale(HVector& rhs) const;
   void applyBasisMatrixRowScale(HVector& rhs) const;
+  void applyBasisMatrixColScale(std::vector<double>& block,
+                                const HighsInt num_rhs) const;
+  void applyBasisMatrixRowScale(std::vector<double>& block,
+                                const HighsInt num_rhs) const;
   void unapplyBasisMatrixRowScale(HVector& rhs) const;
   double rowEp2NormInScaledSpace(const HighsInt iRow,
                                  const HVector& row_ep) const;
@@ -167,6 +183,12 @@ class HSimplexNla {
   bool report_;
   double build_synthetic_tick_;
 
+  // Numbers of rows and columns by which the factorization has been
+  // extended since INVERT. If either is positive, HFactor must be set
+  // up again before INVERT
+  HighsInt num_extended_row_ = 0;
+  HighsInt num_extended_col_ = 0;
+
   // Frozen basis data
   HighsInt first_frozen_basis_id_ = kNoLink;
   HighsInt last_frozen_basis_id_ = kNoLink;
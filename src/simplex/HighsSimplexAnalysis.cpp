@@ -43,6 +43,9 @@ void HighsSimplexAnalysis::setup(const std::string lp_name, const HighsLp& lp,
       analyse_simplex_summary_data || analyse_simplex_runtime_data;
   last_user_log_time = -kHighsInf;
   delta_user_log_time = 5e0;
+  num_dual_edge_weight_computed = 0;
+  num_dual_edge_weight_kept = 0;
+  dual_edge_weight_time = 0;
 
   setupSimplexTime(options);
   setupFactorTime(options);
@@ -203,6 +206,8 @@ void HighsSimplexAnalysis::setup(const std::string lp_name, const HighsLp& lp,
     num_col_price = 0;
     num_row_price = 0;
     num_row_price_with_switch = 0;
+    num_reach_cache_lookup = 0;
+    num_reach_cache_hit = 0;
     num_primal_cycling_detections = 0;
     num_dual_cycling_detections = 0;
     // Initialise the dual simplex flip/shift records
@@ -825,6 +830,16 @@ void HighsSimplexAnalysis::summaryReport() {
                            AnIter.AnIterOpRsDim);
     }
   }
+  if (num_reach_cache_lookup > 0)
+    printf("\nReach cache: %" HIGHSINT_FORMAT " hits from %" HIGHSINT_FORMAT
+           " hyper-sparse solves (%3" HIGHSINT_FORMAT "%%)\n",
+           num_reach_cache_hit, num_reach_cache_lookup,
+           (100 * num_reach_cache_hit) / num_reach_cache_lookup);
+  if (num_dual_edge_weight_computed + num_dual_edge_weight_kept > 0)
+    printf("\nDual steepest edge weights: %" HIGHSINT_FORMAT
+           " computed and %" HIGHSINT_FORMAT " kept in %gs\n",
+           num_dual_edge_weight_computed, num_dual_edge_weight_kept,
+           dual_edge_weight_time);
   HighsInt NumInvert = 0;
 
   HighsInt last_rebuild_reason = kRebuildReasonCount - 1;
@@ -124,6 +124,11 @@ class HighsSimplexAnalysis {
         num_col_price(0),
         num_row_price(0),
         num_row_price_with_switch(0),
+        num_reach_cache_lookup(0),
+        num_reach_cache_hit(0),
+        num_dual_edge_weight_computed(0),
+        num_dual_edge_weight_kept(0),
+        dual_edge_weight_time(0.0),
         num_primal_cycling_detections(0),
         num_dual_cycling_detections(0),
         num_quad_chuzc(0),
@@ -352,6 +357,16 @@ class HighsSimplexAnalysis {
   HighsInt num_row_price;
   HighsInt num_row_price_with_switch;
 
+  // Records of the cached reach of hyper-sparse solves
+  HighsInt num_reach_cache_lookup;
+  HighsInt num_reach_cache_hit;
+
+  // Records of the exact dual steepest edge weights that have been
+  // computed or kept when rows were added, and the time to get them
+  HighsInt num_dual_edge_weight_computed;
+  HighsInt num_dual_edge_weight_kept;
+  double dual_edge_weight_time;
+
   HighsValueDistribution before_ftran_upper_sparse_density;
   HighsValueDistribution ftran_upper_sparse_density;
   HighsValueDistribution before_ftran_upper_hyper_density;
@@ -143,6 +143,18 @@ enum class EdgeWeightMode { kDantzig = 0, kDevex, kSteepestEdge, kCount };
 const HighsInt kDualTasksMinConcurrency = 3;
 const HighsInt kDualMultiMinConcurrency = 1;  // 2;
 
+// Minimum number of entries in each partition of a loop in CHUZR and
+// CHUZC when the iterations of the serial dual simplex are parallel
+const HighsInt kParallelIterationGrain = 4096;
+
+// Number of rows for which exact dual steepest edge weights are
+// computed together when they are computed in blocks
+const HighsInt kDualEdgeWeightBlockSize = 16;
+
+// Limit on the number of rows by which the factorization of the basis
+// matrix may be extended, relative to its dimension when it was formed
+const double kExtendInvertMaxRowFraction = 0.25;
+
 // Simplex nonbasicFlag status for columns and rows. Don't use enum
 // class since they are used as HighsInt to replace conditional
 // statements by multiplication
@@ -186,7 +198,8 @@ enum class LpAction {
   kScaledCol,
   kScaledRow,
   kHotStart,
-  kBacktracking
+  kBacktracking,
+  kKeepInvert
 };
 
 enum class BadBasisChangeReason {
@@ -231,6 +231,10 @@ struct HighsSimplexInfo {
   HighsInt num_concurrency = 1;
   HighsInt max_concurrency = kSimplexConcurrencyLimit;
 
+  // Whether CHUZR, PRICE and CHUZC of the serial dual simplex are
+  // partitioned across threads
+  bool parallel_iteration = false;
+
   // Info on PAMI iterations
   HighsInt multi_iteration = 0;
 
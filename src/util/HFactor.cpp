@@ -18,10 +18,12 @@
 
 #include "../extern/pdqsort/pdqsort.h"
 #include "lp_data/HConst.h"
+#include "parallel/HighsParallel.h"
 #include "util/FactorTimer.h"
 #include "util/HFactorDebug.h"
 #include "util/HVector.h"
 #include "util/HVectorBase.h"
+#include "util/HighsHash.h"
 #include "util/HighsTimer.h"
 
 // std::vector, std::max and std::min used in HFactor.h for local
@@ -65,7 +67,9 @@ static void solveHyper(const HighsInt h_size, const HighsInt* h_lookup,
                        const HighsInt* h_pivot_index,
                        const double* h_pivot_value, const HighsInt* h_start,
                        const HighsInt* h_end, const HighsInt* h_index,
-                       const double* h_value, HVector* rhs) {
+                       const double* h_value, HVector* rhs,
+                       HFactorReachCache* reach_cache = nullptr,
+                       const HighsInt reach_cache_solve = 0) {
   HighsInt rhs_count = rhs->count;
   HighsInt* rhs_index = rhs->index.data();
   double* rhs_array = rhs->array.data();
@@ -81,7 +85,18 @@ static void solveHyper(const HighsInt h_size, const HighsInt* h_lookup,
   HighsInt count_pivot = 0;
   HighsInt count_entry = 0;
 
-  for (HighsInt i = 0; i < rhs_count; i++) {
+  // The list depends only on the RHS pattern, so may be known
+  uint64_t reach_hash = 0;
+  bool reach_known = false;
+  if (reach_cache) {
+    reach_hash = HighsHashHelpers::vector_hash(rhs_index, rhs_count);
+    reach_known =
+        reach_cache->lookup(reach_cache_solve, reach_hash, rhs_index,
+                            rhs_count, list_index, list_count, count_pivot,
+                            count_entry);
+  }
+
+  for (HighsInt i = 0; i < rhs_count && !reach_known; i++) {
     // Skip touched index
     HighsInt i_trans =
         h_lookup[rhs_index[i]];  // XXX: this contains a bug iTran
@@ -118,6 +133,10 @@ static void solveHyper(const HighsInt h_size, const HighsInt* h_lookup,
     }
   }
 
+  if (reach_cache && !reach_known)
+    reach_cache->insert(reach_cache_solve, reach_hash, rhs_index, rhs_count,
+                        list_index, list_count, count_pivot, count_entry);
+
   rhs->synthetic_tick += count_pivot * 20 + count_entry * 10;
 
   // Solve with list
@@ -380,6 +399,7 @@ HighsInt HFactor::build(HighsTimerClock* factor_timer_clock_pointer) {
   // Start the timer
   factor_timer.start(FactorInvert, factor_timer_clock_pointer);
   build_synthetic_tick = 0;
+  dense_kernel_dim = 0;
   factor_timer.start(FactorInvertSimple, factor_timer_clock_pointer);
   // Build the L, U factor
   buildSimple();
@@ -520,6 +540,8 @@ void HFactor::update(HVector* aq, HVector* ep, HighsInt* iRow, HighsInt* hint) {
   // no longer corresponds to the current basis, it must be
   // invalidated
   this->refactor_info_.clear();
+  // Only U is changed by the update
+  reachCacheClear(false);
   // Special case
   if (aq->next) {
     updateCFT(aq, ep, iRow);
@@ -545,7 +567,78 @@ void HFactor::setTimeLimit(const double time_limit) {
   this->time_limit_ = time_limit;
 }
 
+void HFactor::setReachCache(const bool reach_cache) {
+  // Any existing cache is discarded, so the counts start from zero
+  reach_cache_.reset(reach_cache ? new HFactorReachCache() : nullptr);
+}
+
+void HFactor::getReachCacheCount(HighsInt& num_lookup,
+                                 HighsInt& num_hit) const {
+  num_lookup = 0;
+  num_hit = 0;
+  if (!reach_cache_) return;
+  std::lock_guard<std::mutex> lock(reach_cache_->mutex);
+  num_lookup = reach_cache_->num_lookup;
+  num_hit = reach_cache_->num_hit;
+}
+
+void HFactor::reachCacheClear(const bool clear_l) {
+  if (reach_cache_) reach_cache_->clear(clear_l);
+}
+
+bool HFactorReachCache::lookup(const HighsInt solve, const uint64_t hash,
+                               const HighsInt* pattern,
+                               const HighsInt pattern_count, HighsInt* reach,
+                               HighsInt& reach_count, HighsInt& count_pivot,
+                               HighsInt& count_entry) {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->num_lookup++;
+  std::vector<HFactorReachEntry>& solve_entry = this->entry[solve];
+  if (solve_entry.empty()) return false;
+  const HFactorReachEntry& known = solve_entry[hash % kReachCacheNumEntry];
+  // The hash is only a filter: the pattern must be the same
+  if (known.hash != hash || (HighsInt)known.pattern.size() != pattern_count ||
+      !std::equal(known.pattern.begin(), known.pattern.end(), pattern))
+    return false;
+  reach_count = known.reach.size();
+  std::copy(known.reach.begin(), known.reach.end(), reach);
+  count_pivot = known.count_pivot;
+  count_entry = known.count_entry;
+  this->num_hit++;
+  return true;
+}
+
+void HFactorReachCache::insert(const HighsInt solve, const uint64_t hash,
+                               const HighsInt* pattern,
+                               const HighsInt pattern_count,
+                               const HighsInt* reach,
+                               const HighsInt reach_count,
+                               const HighsInt count_pivot,
+                               const HighsInt count_entry) {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  std::vector<HFactorReachEntry>& solve_entry = this->entry[solve];
+  if (solve_entry.empty()) solve_entry.resize(kReachCacheNumEntry);
+  // Replace any pattern with the same hash slot
+  HFactorReachEntry& known = solve_entry[hash % kReachCacheNumEntry];
+  known.hash = hash;
+  known.pattern.assign(pattern, pattern + pattern_count);
+  known.reach.assign(reach, reach + reach_count);
+  known.count_pivot = count_pivot;
+  known.count_entry = count_entry;
+}
+
+void HFactorReachCache::clear(const bool clear_l) {
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (clear_l) {
+    this->entry[kReachCacheFtranL].clear();
+    this->entry[kReachCacheBtranL].clear();
+  }
+  this->entry[kReachCacheFtranU].clear();
+  this->entry[kReachCacheBtranU].clear();
+}
+
 void HFactor::luClear() {
+  reachCacheClear(true);
   l_start.clear();
   l_start.push_back(0);
   l_index.clear();
@@ -885,6 +978,9 @@ HighsInt HFactor::buildKernel() {
   double average_iteration_time = 0;
   const bool check_for_timeout = this->time_limit_ < kHighsInf;
   HighsInt search_k = 0;
+  // The dense factorization of the remaining kernel is only
+  // attempted once, and requires it to be square
+  bool try_dense_kernel = num_basic == num_row;
 
   const HighsInt check_nwork = -11;
   while (nwork-- > 0) {
@@ -911,6 +1007,30 @@ HighsInt HFactor::buildKernel() {
         return kBuildKernelReturnTimeout;
     }
 
+    // Determine whether every active row and column of the remaining
+    // kernel is dense enough for it to be factored as a dense matrix
+    const HighsInt remaining_dim = nwork + 1;
+    if (try_dense_kernel && remaining_dim >= kDenseKernelMinDim &&
+        remaining_dim <= kDenseKernelMaxDim) {
+      const HighsInt min_count =
+          std::ceil(kDenseKernelMinDensity * remaining_dim);
+      bool dense_kernel = true;
+      for (HighsInt count = 0; count < min_count; count++) {
+        if (col_link_first[count] >= 0 || row_link_first[count] >= 0) {
+          dense_kernel = false;
+          break;
+        }
+      }
+      if (dense_kernel) {
+        if (buildKernelDense(remaining_dim)) {
+          // As if the Markowitz pivoting had run to completion
+          nwork = -1;
+          break;
+        }
+        try_dense_kernel = false;
+      }
+    }
+
     /**
      * 1. Search for the pivot
      */
@@ -1262,6 +1382,138 @@ HighsInt HFactor::buildKernel() {
   return rank_deficiency;
 }
 
+bool HFactor::buildKernelDense(const HighsInt dim) {
+  // Factor the remaining dim x dim kernel as a dense matrix using
+  // partial pivoting. The kernel data structures are unchanged unless
+  // the factorization succeeds, so Markowitz pivoting can continue if
+  // the kernel is found to be singular
+  //
+  // Identify the active columns and rows, in increasing order
+  vector<HighsInt> dense_col;
+  for (HighsInt count = 1; count <= num_row; count++)
+    for (HighsInt j = col_link_first[count]; j != -1; j = col_link_next[j])
+      dense_col.push_back(j);
+  if ((HighsInt)dense_col.size() != dim) return false;
+  pdqsort(dense_col.begin(), dense_col.end());
+  vector<HighsInt> dense_row;
+  vector<HighsInt> row_local(num_row, -1);
+  for (const HighsInt iCol : dense_col) {
+    for (HighsInt k = mc_start[iCol]; k < mc_start[iCol] + mc_count_a[iCol];
+         k++) {
+      const HighsInt iRow = mc_index[k];
+      if (row_local[iRow] >= 0) continue;
+      row_local[iRow] = 0;
+      dense_row.push_back(iRow);
+    }
+  }
+  if ((HighsInt)dense_row.size() != dim) return false;
+  pdqsort(dense_row.begin(), dense_row.end());
+  for (HighsInt i = 0; i < dim; i++) row_local[dense_row[i]] = i;
+
+  // Form the kernel column-wise
+  vector<double> dense(dim * dim, 0);
+  for (HighsInt j = 0; j < dim; j++) {
+    const HighsInt iCol = dense_col[j];
+    double* column = &dense[j * dim];
+    for (HighsInt k = mc_start[iCol]; k < mc_start[iCol] + mc_count_a[iCol];
+         k++)
+      column[row_local[mc_index[k]]] = mc_value[k];
+  }
+
+  // Right-looking LU. Each column of the active submatrix is updated
+  // independently, and in the same way whatever the number of
+  // threads, so the factors are bitwise identical. The row
+  // interchanges are applied to the columns as they are updated
+  const bool run_parallel = HighsTaskExecutor::getThisWorkerDeque() !=
+                                nullptr &&
+                            highs::parallel::num_threads() > 1;
+  // Minimum number of entries updated by each parallel task
+  const HighsInt kMinTaskSize = 16384;
+  vector<HighsInt> row_order(dim);
+  for (HighsInt i = 0; i < dim; i++) row_order[i] = i;
+  double fake_eliminate = 0;
+  for (HighsInt k = 0; k < dim; k++) {
+    double* pivot_column = &dense[k * dim];
+    HighsInt pivot_k = k;
+    double max_value = fabs(pivot_column[k]);
+    for (HighsInt i = k + 1; i < dim; i++) {
+      if (fabs(pivot_column[i]) > max_value) {
+        max_value = fabs(pivot_column[i]);
+        pivot_k = i;
+      }
+    }
+    if (max_value < pivot_tolerance) return false;
+    if (pivot_k != k) {
+      // Interchange the rows in the pivotal column and the L columns
+      for (HighsInt j = 0; j <= k; j++)
+        std::swap(dense[j * dim + k], dense[j * dim + pivot_k]);
+      std::swap(row_order[k], row_order[pivot_k]);
+    }
+    const double pivot = pivot_column[k];
+    for (HighsInt i = k + 1; i < dim; i++) pivot_column[i] /= pivot;
+    auto updateColumns = [&](HighsInt from_col, HighsInt to_col) {
+      for (HighsInt j = from_col; j < to_col; j++) {
+        double* column = &dense[j * dim];
+        std::swap(column[k], column[pivot_k]);
+        const double multiplier = column[k];
+        if (multiplier == 0) continue;
+        for (HighsInt i = k + 1; i < dim; i++)
+          column[i] -= multiplier * pivot_column[i];
+      }
+    };
+    const HighsInt active_dim = dim - k - 1;
+    if (run_parallel && active_dim * active_dim >= 2 * kMinTaskSize) {
+      const HighsInt grain_size =
+          std::max(HighsInt{1}, kMinTaskSize / active_dim);
+      highs::parallel::for_each(k + 1, dim, updateColumns, grain_size);
+    } else {
+      updateColumns(k + 1, dim);
+    }
+    fake_eliminate += 1.0 * active_dim * active_dim;
+  }
+
+  // Store the factors as if they had been found by Markowitz
+  // pivoting: the pivotal column in the active rows goes to L, and
+  // the pivotal column in the rows already pivoted on goes to U
+  for (HighsInt k = 0; k < dim; k++) {
+    const HighsInt iCol = dense_col[k];
+    const HighsInt iRow = dense_row[row_order[k]];
+    const double* column = &dense[k * dim];
+    permute[iCol] = iRow;
+    assert(mc_var[iCol] == basic_index[iCol]);
+    this->refactor_info_.pivot_row.push_back(iRow);
+    this->refactor_info_.pivot_var.push_back(basic_index[iCol]);
+    this->refactor_info_.pivot_type.push_back(kPivotMarkowitz);
+
+    for (HighsInt i = k + 1; i < dim; i++) {
+      if (fabs(column[i]) < kHighsTiny) continue;
+      l_index.push_back(dense_row[row_order[i]]);
+      l_value.push_back(column[i]);
+    }
+    l_start.push_back(l_index.size());
+
+    const HighsInt end_N = mc_start[iCol] + mc_space[iCol];
+    for (HighsInt i = end_N - mc_count_n[iCol]; i < end_N; i++) {
+      u_index.push_back(mc_index[i]);
+      u_value.push_back(mc_value[i]);
+    }
+    for (HighsInt i = 0; i < k; i++) {
+      if (fabs(column[i]) < kHighsTiny) continue;
+      u_index.push_back(dense_row[row_order[i]]);
+      u_value.push_back(column[i]);
+    }
+    u_pivot_index.push_back(iRow);
+    u_pivot_value.push_back(column[k]);
+    u_start.push_back(u_index.size());
+  }
+  dense_kernel_dim = dim;
+  build_synthetic_tick += 1.0 * dim * dim * 40 + fake_eliminate * 80;
+  highsLogDev(log_options, HighsLogType::kVerbose,
+              "Factored kernel of dimension %d as a dense matrix\n",
+              (int)dim);
+  return true;
+}
+
 void HFactor::buildHandleRankDeficiency() {
   debugReportRankDeficiency(0, highs_debug_level, log_options, num_row, permute,
                             iwork, basic_index, rank_deficiency,
@@ -1579,7 +1831,8 @@ void HFactor::ftranL(HVector& rhs, const double expected_density,
     const HighsInt* l_index = this->l_index.data();
     const double* l_value = this->l_value.data();
     solveHyper(num_row, l_pivot_lookup.data(), l_pivot_index.data(), 0,
-               l_start.data(), &l_start[1], &l_index[0], &l_value[0], &rhs);
+               l_start.data(), &l_start[1], &l_index[0], &l_value[0], &rhs,
+               reach_cache_.get(), kReachCacheFtranL);
     factor_timer.stop(FactorFtranLowerHyper, factor_timer_clock_pointer);
   }
   factor_timer.stop(FactorFtranLower, factor_timer_clock_pointer);
@@ -1628,7 +1881,8 @@ void HFactor::btranL(HVector& rhs, const double expected_density,
     const HighsInt* lr_index = this->lr_index.data();
     const double* lr_value = this->lr_value.data();
     solveHyper(num_row, l_pivot_lookup.data(), l_pivot_index.data(), 0,
-               lr_start.data(), &lr_start[1], &lr_index[0], &lr_value[0], &rhs);
+               lr_start.data(), &lr_start[1], &lr_index[0], &lr_value[0], &rhs,
+               reach_cache_.get(), kReachCacheBtranL);
     factor_timer.stop(FactorBtranLowerHyper, factor_timer_clock_pointer);
   }
 
@@ -1745,7 +1999,8 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
     const double* u_value = this->u_value.data();
     solveHyper(num_row, u_pivot_lookup.data(), u_pivot_index.data(),
                u_pivot_value.data(), u_start.data(), u_last_p.data(),
-               &u_index[0], &u_value[0], &rhs);
+               &u_index[0], &u_value[0], &rhs, reach_cache_.get(),
+               kReachCacheFtranU);
     factor_timer.stop(use_clock, factor_timer_clock_pointer);
   }
   if (update_method == kUpdateMethodPf) {
@@ -1821,7 +2076,8 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
     factor_timer.start(FactorBtranUpperHyper, factor_timer_clock_pointer);
     solveHyper(num_row, u_pivot_lookup.data(), u_pivot_index.data(),
                u_pivot_value.data(), &ur_start[0], ur_lastp.data(),
-               &ur_index[0], &ur_value[0], &rhs);
+               &ur_index[0], &ur_value[0], &rhs, reach_cache_.get(),
+               kReachCacheBtranU);
     factor_timer.stop(FactorBtranUpperHyper, factor_timer_clock_pointer);
   }
 
@@ -2541,6 +2797,7 @@ InvertibleRepresentation HFactor::getInvert() const {
 }
 
 void HFactor::setInvert(const InvertibleRepresentation& invert) {
+  reachCacheClear(true);
   this->l_pivot_index = invert.l_pivot_index;
   this->l_pivot_lookup = invert.l_pivot_lookup;
   this->l_start = invert.l_start;
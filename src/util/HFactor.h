@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "io/HighsIO.h"
@@ -32,6 +33,51 @@ using std::vector;
 
 const HighsInt kBuildKernelReturnTimeout = -1;
 
+// Once every active row and column of a kernel of at least
+// kDenseKernelMinDim (and at most kDenseKernelMaxDim) has this
+// density, the rest of the kernel is factored as a dense matrix
+const double kDenseKernelMinDensity = 0.25;
+const HighsInt kDenseKernelMinDim = 64;
+const HighsInt kDenseKernelMaxDim = 4096;
+
+// The symbolic reach of hyper-sparse RHS patterns can be cached for
+// each triangular solve, so that repeated patterns skip the
+// depth-first search. The cache for each solve holds at most
+// kReachCacheNumEntry patterns
+enum ReachCacheSolve {
+  kReachCacheFtranL = 0,
+  kReachCacheBtranL,
+  kReachCacheFtranU,
+  kReachCacheBtranU,
+  kReachCacheNumSolve
+};
+const HighsInt kReachCacheNumEntry = 256;
+
+struct HFactorReachEntry {
+  uint64_t hash = 0;
+  std::vector<HighsInt> pattern;
+  std::vector<HighsInt> reach;
+  HighsInt count_pivot = 0;
+  HighsInt count_entry = 0;
+};
+
+struct HFactorReachCache {
+  // Solves may be performed concurrently with the same factor
+  std::mutex mutex;
+  std::vector<HFactorReachEntry> entry[kReachCacheNumSolve];
+  HighsInt num_lookup = 0;
+  HighsInt num_hit = 0;
+  bool lookup(const HighsInt solve, const uint64_t hash,
+              const HighsInt* pattern, const HighsInt pattern_count,
+              HighsInt* reach, HighsInt& reach_count, HighsInt& count_pivot,
+              HighsInt& count_entry);
+  void insert(const HighsInt solve, const uint64_t hash,
+              const HighsInt* pattern, const HighsInt pattern_count,
+              const HighsInt* reach, const HighsInt reach_count,
+              const HighsInt count_pivot, const HighsInt count_entry);
+  void clear(const bool clear_l);
+};
+
 struct InvertibleRepresentation {
   // Factor L
   std::vector<HighsInt> l_pivot_index;
@@ -113,6 +159,7 @@ class HFactor {
         invert_num_el(0),
         kernel_dim(0),
         kernel_num_el(0),
+        dense_kernel_dim(0),
         num_row(0),
         num_col(0),
         num_basic(0),
@@ -226,6 +273,23 @@ class HFactor {
   void btranCall(std::vector<double>& vector,
                  HighsTimerClock* factor_timer_clock_pointer = NULL);
 
+  /**
+   * @brief Solve \f$BX=R\f$ (FTRAN) for a block of num_rhs RHS
+   * stored row by row, so that the value for RHS k in row i is
+   * block[i*num_rhs+k]
+   */
+  void ftranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                  const double expected_density,
+                  HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
+  /**
+   * @brief Solve \f$B^TX=R\f$ (BTRAN) for a block of num_rhs RHS
+   * stored as for ftranBlock
+   */
+  void btranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                  const double expected_density,
+                  HighsTimerClock* factor_timer_clock_pointer = NULL) const;
+
   /**
    * @brief Update according to
    * \f$B'=B+(\mathbf{a}_q-B\mathbf{e}_p)\mathbf{e}_p^T\f$
@@ -328,6 +392,16 @@ class HFactor {
     this->debug_report_ = debug_report;
   }
 
+  /**
+   * @brief Cache the reach of hyper-sparse RHS patterns, so that
+   * repeated patterns skip the symbolic phase of the solve. The cache
+   * for L is cleared when INVERT is formed, and the cache for U is
+   * also cleared when INVERT is updated
+   */
+  void setReachCache(const bool reach_cache);
+  bool getReachCache() const { return reach_cache_ != nullptr; }
+  void getReachCacheCount(HighsInt& num_lookup, HighsInt& num_hit) const;
+
   // Information required to perform refactorization of the current
   // basis
   RefactorInfo refactor_info_;
@@ -337,6 +411,8 @@ class HFactor {
   HighsInt invert_num_el;
   HighsInt kernel_dim;
   HighsInt kernel_num_el;
+  // Dimension of the part of the kernel factored as a dense matrix
+  HighsInt dense_kernel_dim;
 
   /**
    * Data of the factor
@@ -457,16 +533,21 @@ class HFactor {
 
   HVector rhs_;
 
+  // Cache of the reach of hyper-sparse RHS patterns
+  std::unique_ptr<HFactorReachCache> reach_cache_;
+
   // Implementation
   void buildSimple();
   //    void buildKernel();
   HighsInt buildKernel();
+  bool buildKernelDense(const HighsInt dim);
   void buildHandleRankDeficiency();
   void buildReportRankDeficiency();
   void buildMarkSingC();
   void buildFinish();
   void zeroCol(const HighsInt iCol);
   void luClear();
+  void reachCacheClear(const bool clear_l);
   // Rebuild using refactor information
   HighsInt rebuild(HighsTimerClock* factor_timer_clock_pointer);
 
@@ -489,6 +570,17 @@ class HFactor {
 
   void ftranFT(HVector& vector) const;
   void btranFT(HVector& vector) const;
+  bool useBlockTran(const HighsInt num_rhs,
+                    const double expected_density) const;
+  void tranBlockByVector(std::vector<double>& block, const HighsInt num_rhs,
+                         const double expected_density, const bool transpose,
+                         HighsTimerClock* factor_timer_clock_pointer) const;
+  void ftranBlockL(double* block, const HighsInt num_rhs) const;
+  void ftranBlockFT(double* block, const HighsInt num_rhs) const;
+  void ftranBlockU(double* block, const HighsInt num_rhs) const;
+  void btranBlockU(double* block, const HighsInt num_rhs) const;
+  void btranBlockFT(double* block, const HighsInt num_rhs) const;
+  void btranBlockL(double* block, const HighsInt num_rhs) const;
   void ftranPF(HVector& vector) const;
   void btranPF(HVector& vector) const;
   void ftranMPF(HVector& vector) const;
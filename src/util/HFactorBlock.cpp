@@ -0,0 +1,188 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HFactorBlock.cpp
+ * @brief FTRAN and BTRAN for blocks of RHS
+ */
+#include <cassert>
+
+#include "util/FactorTimer.h"
+#include "util/HFactor.h"
+#include "util/HVectorBase.h"
+
+using std::fabs;
+
+// Zero the values of the pivotal row of a block that are tiny,
+// returning whether any are nonzero
+static bool blockPivotalRow(double* pivotal_row, const HighsInt num_rhs) {
+  bool nonzero = false;
+  for (HighsInt k = 0; k < num_rhs; k++) {
+    if (fabs(pivotal_row[k]) > kHighsTiny) {
+      nonzero = true;
+    } else {
+      pivotal_row[k] = 0;
+    }
+  }
+  return nonzero;
+}
+
+// Subtract a multiple of the pivotal row of a block from another row
+static void blockUpdateRow(double* row, const double* pivotal_row,
+                           const double value, const HighsInt num_rhs) {
+  for (HighsInt k = 0; k < num_rhs; k++) row[k] -= pivotal_row[k] * value;
+}
+
+void HFactor::ftranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                         const double expected_density,
+                         HighsTimerClock* factor_timer_clock_pointer) const {
+  assert((HighsInt)block.size() >= num_row * num_rhs);
+  if (!useBlockTran(num_rhs, expected_density)) {
+    tranBlockByVector(block, num_rhs, expected_density, false,
+                      factor_timer_clock_pointer);
+    return;
+  }
+  FactorTimer factor_timer;
+  factor_timer.start(FactorFtran, factor_timer_clock_pointer);
+  ftranBlockL(block.data(), num_rhs);
+  ftranBlockFT(block.data(), num_rhs);
+  ftranBlockU(block.data(), num_rhs);
+  factor_timer.stop(FactorFtran, factor_timer_clock_pointer);
+}
+
+void HFactor::btranBlock(std::vector<double>& block, const HighsInt num_rhs,
+                         const double expected_density,
+                         HighsTimerClock* factor_timer_clock_pointer) const {
+  assert((HighsInt)block.size() >= num_row * num_rhs);
+  if (!useBlockTran(num_rhs, expected_density)) {
+    tranBlockByVector(block, num_rhs, expected_density, true,
+                      factor_timer_clock_pointer);
+    return;
+  }
+  FactorTimer factor_timer;
+  factor_timer.start(FactorBtran, factor_timer_clock_pointer);
+  btranBlockU(block.data(), num_rhs);
+  btranBlockFT(block.data(), num_rhs);
+  btranBlockL(block.data(), num_rhs);
+  factor_timer.stop(FactorBtran, factor_timer_clock_pointer);
+}
+
+bool HFactor::useBlockTran(const HighsInt num_rhs,
+                           const double expected_density) const {
+  // Only the Forrest-Tomlin update is traversed for a block of RHS
+  if (update_method != kUpdateMethodFt) return false;
+  return num_rhs * expected_density >= kBlockTranMinDensity;
+}
+
+void HFactor::tranBlockByVector(
+    std::vector<double>& block, const HighsInt num_rhs,
+    const double expected_density, const bool transpose,
+    HighsTimerClock* factor_timer_clock_pointer) const {
+  HVector rhs;
+  rhs.setup(num_row);
+  for (HighsInt k = 0; k < num_rhs; k++) {
+    rhs.clear();
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      const double value = block[iRow * num_rhs + k];
+      if (value == 0) continue;
+      rhs.index[rhs.count++] = iRow;
+      rhs.array[iRow] = value;
+    }
+    if (transpose) {
+      btranCall(rhs, expected_density, factor_timer_clock_pointer);
+    } else {
+      ftranCall(rhs, expected_density, factor_timer_clock_pointer);
+    }
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      block[iRow * num_rhs + k] = rhs.array[iRow];
+  }
+}
+
+void HFactor::ftranBlockL(double* block, const HighsInt num_rhs) const {
+  for (HighsInt i = 0; i < num_row; i++) {
+    double* pivotal_row = &block[l_pivot_index[i] * num_rhs];
+    if (!blockPivotalRow(pivotal_row, num_rhs)) continue;
+    for (HighsInt k = l_start[i]; k < l_start[i + 1]; k++)
+      blockUpdateRow(&block[l_index[k] * num_rhs], pivotal_row, l_value[k],
+                     num_rhs);
+  }
+}
+
+void HFactor::ftranBlockFT(double* block, const HighsInt num_rhs) const {
+  // Each row ETA forms the new value of its pivotal row from the
+  // other rows, so accumulate it before storing it
+  const HighsInt pf_pivot_count = pf_pivot_index.size();
+  std::vector<double> value(num_rhs);
+  for (HighsInt i = 0; i < pf_pivot_count; i++) {
+    double* pivotal_row = &block[pf_pivot_index[i] * num_rhs];
+    value.assign(pivotal_row, pivotal_row + num_rhs);
+    for (HighsInt k = pf_start[i]; k < pf_start[i + 1]; k++)
+      blockUpdateRow(value.data(), &block[pf_index[k] * num_rhs], pf_value[k],
+                     num_rhs);
+    for (HighsInt k = 0; k < num_rhs; k++) pivotal_row[k] = value[k];
+  }
+}
+
+void HFactor::ftranBlockU(double* block, const HighsInt num_rhs) const {
+  const HighsInt u_pivot_count = u_pivot_index.size();
+  for (HighsInt i_logic = u_pivot_count - 1; i_logic >= 0; i_logic--) {
+    // Skip void
+    if (u_pivot_index[i_logic] == -1) continue;
+    double* pivotal_row = &block[u_pivot_index[i_logic] * num_rhs];
+    if (!blockPivotalRow(pivotal_row, num_rhs)) continue;
+    const double pivot_value = u_pivot_value[i_logic];
+    for (HighsInt k = 0; k < num_rhs; k++) pivotal_row[k] /= pivot_value;
+    for (HighsInt k = u_start[i_logic]; k < u_last_p[i_logic]; k++)
+      blockUpdateRow(&block[u_index[k] * num_rhs], pivotal_row, u_value[k],
+                     num_rhs);
+  }
+}
+
+void HFactor::btranBlockU(double* block, const HighsInt num_rhs) const {
+  const HighsInt u_pivot_count = u_pivot_index.size();
+  for (HighsInt i_logic = 0; i_logic < u_pivot_count; i_logic++) {
+    // Skip void
+    if (u_pivot_index[i_logic] == -1) continue;
+    double* pivotal_row = &block[u_pivot_index[i_logic] * num_rhs];
+    if (!blockPivotalRow(pivotal_row, num_rhs)) continue;
+    const double pivot_value = u_pivot_value[i_logic];
+    for (HighsInt k = 0; k < num_rhs; k++) pivotal_row[k] /= pivot_value;
+    for (HighsInt k = ur_start[i_logic]; k < ur_lastp[i_logic]; k++)
+      blockUpdateRow(&block[ur_index[k] * num_rhs], pivotal_row, ur_value[k],
+                     num_rhs);
+  }
+}
+
+void HFactor::btranBlockFT(double* block, const HighsInt num_rhs) const {
+  // Apply row ETA backward
+  const HighsInt pf_pivot_count = pf_pivot_index.size();
+  std::vector<double> multiplier(num_rhs);
+  for (HighsInt i = pf_pivot_count - 1; i >= 0; i--) {
+    const double* pivotal_row = &block[pf_pivot_index[i] * num_rhs];
+    bool nonzero = false;
+    for (HighsInt k = 0; k < num_rhs; k++) {
+      multiplier[k] = pivotal_row[k];
+      if (multiplier[k]) nonzero = true;
+    }
+    if (!nonzero) continue;
+    for (HighsInt k = pf_start[i]; k < pf_start[i + 1]; k++)
+      blockUpdateRow(&block[pf_index[k] * num_rhs], multiplier.data(),
+                     pf_value[k], num_rhs);
+  }
+}
+
+void HFactor::btranBlockL(double* block, const HighsInt num_rhs) const {
+  for (HighsInt i = num_row - 1; i >= 0; i--) {
+    double* pivotal_row = &block[l_pivot_index[i] * num_rhs];
+    if (!blockPivotalRow(pivotal_row, num_rhs)) continue;
+    for (HighsInt k = lr_start[i]; k < lr_start[i + 1]; k++)
+      blockUpdateRow(&block[lr_index[k] * num_rhs], pivotal_row, lr_value[k],
+                     num_rhs);
+  }
+}
@@ -52,6 +52,12 @@ const double kHyperCancel = 0.05;
  * hyper-sparse - only for reporting
  */
 const double kHyperResult = 0.10;
+/**
+ * Block TRANs traverse the factors once for all RHS when the number
+ * of RHS multiplied by their expected density is at least this, and
+ * otherwise perform a (possibly hyper-sparse) TRAN for each RHS
+ */
+const double kBlockTranMinDensity = 0.5;
 
 /**
  * Parameters for reinversion on synthetic clock
@@ -30,13 +30,9 @@ void HFactor::deleteNonbasicCols(const HighsInt num_deleted_col) {
 
 void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   invalidAMatrixAction();
-  assert(kExtendInvertWhenAddingRows);
+  reachCacheClear(true);
   HighsInt num_new_row = ar_matrix->num_row_;
   HighsInt new_num_row = num_row + num_new_row;
-  printf("Adding %" HIGHSINT_FORMAT
-         " new rows to HFactor instance: increasing dimension from "
-         "%" HIGHSINT_FORMAT " to %" HIGHSINT_FORMAT " \n",
-         num_new_row, num_row, new_num_row);
 
   // Need to know where (if) a column is basic
   vector<HighsInt> in_basis;
@@ -129,14 +125,17 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
     l_start[iCol] = l_matrix_new_num_nz;
   //
   // Insert the new entries, remembering to offset the index values by
-  // num_row, since new_lr_cols only has the new rows
+  // num_row, since new_lr_cols only has the new rows. Column iCol of L
+  // has pivot l_pivot_index[iCol], and the columns of new_lr_cols are
+  // indexed by pivot
   l_index.resize(l_matrix_new_num_nz);
   l_value.resize(l_matrix_new_num_nz);
   for (HighsInt iCol = num_row - 1; iCol >= 0; iCol--) {
     const HighsInt from_el = l_start[iCol + 1];
+    const HighsInt pivot = l_pivot_index[iCol];
     l_start[iCol + 1] = to_el;
-    for (HighsInt iEl = new_lr_cols.start_[iCol + 1] - 1;
-         iEl >= new_lr_cols.start_[iCol]; iEl--) {
+    for (HighsInt iEl = new_lr_cols.start_[pivot + 1] - 1;
+         iEl >= new_lr_cols.start_[pivot]; iEl--) {
       to_el--;
       l_index[to_el] = num_row + new_lr_cols.index_[iEl];
       l_value[to_el] = new_lr_cols.value_[iEl];
@@ -186,8 +185,6 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   // Need to refer to just the new UR vectors
   HighsInt ur_cur_num_vec = ur_start.size();
   HighsInt ur_new_num_vec = ur_cur_num_vec + num_new_row;
-  printf("\nUpdating UR vectors %d - %d\n", (int)ur_cur_num_vec,
-         (int)ur_new_num_vec - 1);
   // UR pointer
   //
   // Allow space to the start of new rows, including the start for the
@@ -214,10 +211,8 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
     HighsInt gap = ur_temp[iRow - 1] + ur_stuff_size;
     ur_start[iRow] = iStart + gap;
     iStart += gap;
-    printf("ur_start[%d] = %d; gap = %d; iStart = %d\n", (int)iRow,
-           (int)ur_start[iRow], (int)gap, (int)iStart);
   }
-  printf("ur_count_size = %d; iStart%d\n", (int)ur_count_size, (int)iStart);
+  assert(iStart == ur_count_size);
   // Lose the start for the fictitious ur_new_num_vec'th row
   ur_start.resize(ur_new_num_vec);
   // Resize ur_lastp and initialise its new entries to be the ur_start
@@ -226,7 +221,10 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   for (HighsInt iRow = ur_cur_num_vec; iRow < ur_new_num_vec; iRow++)
     ur_lastp[iRow] = ur_start[iRow];
   //
-  // Increase the number of rows in HFactor
+  // Increase the number of rows in HFactor, and the number of basic
+  // variables, since the logicals of the new rows are basic
   num_row += num_new_row;
+  num_basic += num_new_row;
+  rhs_.setup(num_row);
   //  reportLu(kReportLuBoth, true);
 }
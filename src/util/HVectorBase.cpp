@@ -20,6 +20,7 @@
 #include "lp_data/HConst.h"
 #include "stdio.h"  //Just for temporary printf
 #include "util/HighsCDouble.h"
+#include "util/HighsSimd.h"
 
 template <typename Real>
 void HVectorBase<Real>::setup(HighsInt size_) {
@@ -81,6 +82,18 @@ void HVectorBase<Real>::clearScalars() {
   this->next = 0;
 }
 
+// Zero values in a dense array that do not exceed kHighsTiny in
+// magnitude
+static void tightDense(std::vector<double>& array) {
+  highsSimdTight(array.data(), array.size());
+}
+
+static void tightDense(std::vector<HighsCDouble>& array) {
+  using std::abs;
+  for (size_t my_index = 0; my_index < array.size(); my_index++)
+    if (abs(array[my_index]) < kHighsTiny) array[my_index] = 0;
+}
+
 template <typename Real>
 void HVectorBase<Real>::tight() {
   /*
@@ -90,8 +103,7 @@ void HVectorBase<Real>::tight() {
   HighsInt totalCount = 0;
   using std::abs;
   if (count < 0) {
-    for (size_t my_index = 0; my_index < array.size(); my_index++)
-      if (abs(array[my_index]) < kHighsTiny) array[my_index] = 0;
+    tightDense(array);
   } else {
     for (HighsInt i = 0; i < count; i++) {
       const HighsInt my_index = index[i];
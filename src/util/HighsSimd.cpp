@@ -0,0 +1,546 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.cpp
+ * @brief Vectorized kernels for simplex pricing and CHUZC/CHUZR
+ */
+#include "util/HighsSimd.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "lp_data/HConst.h"
+
+#if defined(HIGHS_HAVE_AVX2_TARGET) || defined(HIGHS_HAVE_AVX512_TARGET)
+#include <immintrin.h>
+#endif
+
+// The vectorized kernels must round as the portable kernels do, so
+// multiplications and additions must not be contracted
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+using std::fabs;
+
+namespace {
+
+struct HighsSimdKernels {
+  HighsSimdLevel level;
+  void (*row_update)(double*, const HighsInt*, const double*, const HighsInt,
+                     const double);
+  double (*sparse_dot)(const double*, const HighsInt*, const double*,
+                       const HighsInt);
+  void (*gather_pack)(const double*, const HighsInt*, const HighsInt,
+                      const HighsInt, HighsInt*, double*);
+  HighsInt (*filter_possible)(const HighsInt*, const double*, const HighsInt,
+                              const int8_t*, const HighsInt, const double,
+                              std::pair<HighsInt, double>*);
+  HighsInt (*choose_merit)(const double*, const double*, const HighsInt,
+                           const HighsInt, double&, HighsInt);
+  void (*tight)(double*, const HighsInt);
+};
+
+// Portable kernels, and the scalar parts of the vectorized kernels
+
+void rowUpdatePortable(double* result, const HighsInt* index,
+                       const double* value, const HighsInt count,
+                       const double multiplier) {
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt iCol = index[k];
+    const double value1 = result[iCol] + multiplier * value[k];
+    result[iCol] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+}
+
+double sparseDotPortable(const double* array, const HighsInt* index,
+                         const double* value, const HighsInt count) {
+  double sum = 0;
+  for (HighsInt k = 0; k < count; k++) sum += array[index[k]] * value[k];
+  return sum;
+}
+
+void gatherPackPortable(const double* array, const HighsInt* index,
+                        const HighsInt count, const HighsInt offset,
+                        HighsInt* pack_index, double* pack_value) {
+  for (HighsInt k = 0; k < count; k++) {
+    pack_index[k] = index[k] + offset;
+    pack_value[k] = array[index[k]];
+  }
+}
+
+HighsInt filterPossiblePortable(const HighsInt* pack_index,
+                                const double* pack_value,
+                                const HighsInt pack_count, const int8_t* move,
+                                const HighsInt move_out,
+                                const double tolerance,
+                                std::pair<HighsInt, double>* possible) {
+  HighsInt num_possible = 0;
+  for (HighsInt k = 0; k < pack_count; k++) {
+    const HighsInt iCol = pack_index[k];
+    const double alpha = pack_value[k] * move_out * move[iCol];
+    if (alpha > tolerance)
+      possible[num_possible++] = std::make_pair(iCol, alpha);
+  }
+  return num_possible;
+}
+
+HighsInt chooseMeritPortable(const double* infeasibility,
+                             const double* weight, const HighsInt from,
+                             const HighsInt to, double& best_merit,
+                             HighsInt best_index) {
+  for (HighsInt iRow = from; iRow < to; iRow++) {
+    if (infeasibility[iRow] > kHighsZero) {
+      const double infeas = infeasibility[iRow];
+      const double row_weight = weight[iRow];
+      if (best_merit * row_weight < infeas) {
+        best_merit = infeas / row_weight;
+        best_index = iRow;
+      }
+    }
+  }
+  return best_index;
+}
+
+void tightPortable(double* array, const HighsInt size) {
+  for (HighsInt k = 0; k < size; k++)
+    if (fabs(array[k]) < kHighsTiny) array[k] = 0;
+}
+
+#ifdef HIGHS_HAVE_AVX2_TARGET
+#define HIGHS_AVX2 __attribute__((target("avx2")))
+
+HIGHS_AVX2 inline __m256d gatherAvx2(const double* array,
+                                     const HighsInt* index) {
+#ifdef HIGHSINT64
+  return _mm256_i64gather_pd(
+      array, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index)), 8);
+#else
+  return _mm256_i32gather_pd(
+      array, _mm_loadu_si128(reinterpret_cast<const __m128i*>(index)), 8);
+#endif
+}
+
+HIGHS_AVX2 inline __m256d absAvx2(const __m256d v) {
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+}
+
+HIGHS_AVX2 void rowUpdateAvx2(double* result, const HighsInt* index,
+                              const double* value, const HighsInt count,
+                              const double multiplier) {
+  // AVX2 has no scatter, so the results are stored one at a time
+  const __m256d v_multiplier = _mm256_set1_pd(multiplier);
+  const __m256d v_tiny = _mm256_set1_pd(kHighsTiny);
+  const __m256d v_zero = _mm256_set1_pd(kHighsZero);
+  double value1[4];
+  HighsInt k = 0;
+  for (; k + 4 <= count; k += 4) {
+    __m256d v = _mm256_add_pd(
+        gatherAvx2(result, &index[k]),
+        _mm256_mul_pd(v_multiplier, _mm256_loadu_pd(&value[k])));
+    v = _mm256_blendv_pd(v, v_zero,
+                         _mm256_cmp_pd(absAvx2(v), v_tiny, _CMP_LT_OQ));
+    _mm256_storeu_pd(value1, v);
+    for (HighsInt j = 0; j < 4; j++) result[index[k + j]] = value1[j];
+  }
+  rowUpdatePortable(result, &index[k], &value[k], count - k, multiplier);
+}
+
+HIGHS_AVX2 double sparseDotAvx2(const double* array, const HighsInt* index,
+                                const double* value, const HighsInt count) {
+  // The products are formed together, but summed in order
+  double product[4];
+  double sum = 0;
+  HighsInt k = 0;
+  for (; k + 4 <= count; k += 4) {
+    _mm256_storeu_pd(product, _mm256_mul_pd(gatherAvx2(array, &index[k]),
+                                            _mm256_loadu_pd(&value[k])));
+    sum += product[0];
+    sum += product[1];
+    sum += product[2];
+    sum += product[3];
+  }
+  for (; k < count; k++) sum += array[index[k]] * value[k];
+  return sum;
+}
+
+HIGHS_AVX2 void gatherPackAvx2(const double* array, const HighsInt* index,
+                               const HighsInt count, const HighsInt offset,
+                               HighsInt* pack_index, double* pack_value) {
+  HighsInt k = 0;
+#ifdef HIGHSINT64
+  const __m256i v_offset = _mm256_set1_epi64x(offset);
+  for (; k + 4 <= count; k += 4) {
+    const __m256i v_index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&index[k]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&pack_index[k]),
+                        _mm256_add_epi64(v_index, v_offset));
+    _mm256_storeu_pd(&pack_value[k], _mm256_i64gather_pd(array, v_index, 8));
+  }
+#else
+  const __m128i v_offset = _mm_set1_epi32(offset);
+  for (; k + 4 <= count; k += 4) {
+    const __m128i v_index =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&index[k]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&pack_index[k]),
+                     _mm_add_epi32(v_index, v_offset));
+    _mm256_storeu_pd(&pack_value[k], _mm256_i32gather_pd(array, v_index, 8));
+  }
+#endif
+  gatherPackPortable(array, &index[k], count - k, offset, &pack_index[k],
+                     &pack_value[k]);
+}
+
+HIGHS_AVX2 HighsInt filterPossibleAvx2(const HighsInt* pack_index,
+                                       const double* pack_value,
+                                       const HighsInt pack_count,
+                                       const int8_t* move,
+                                       const HighsInt move_out,
+                                       const double tolerance,
+                                       std::pair<HighsInt, double>* possible) {
+  const __m256d v_move_out = _mm256_set1_pd(move_out);
+  const __m256d v_tolerance = _mm256_set1_pd(tolerance);
+  double alpha[4];
+  HighsInt num_possible = 0;
+  HighsInt k = 0;
+  for (; k + 4 <= pack_count; k += 4) {
+    const __m256d v_move =
+        _mm256_set_pd(move[pack_index[k + 3]], move[pack_index[k + 2]],
+                      move[pack_index[k + 1]], move[pack_index[k]]);
+    const __m256d v_alpha = _mm256_mul_pd(
+        _mm256_mul_pd(_mm256_loadu_pd(&pack_value[k]), v_move_out), v_move);
+    int mask = _mm256_movemask_pd(
+        _mm256_cmp_pd(v_alpha, v_tolerance, _CMP_GT_OQ));
+    if (!mask) continue;
+    _mm256_storeu_pd(alpha, v_alpha);
+    for (HighsInt j = 0; j < 4; j++)
+      if (mask & (1 << j))
+        possible[num_possible++] = std::make_pair(pack_index[k + j], alpha[j]);
+  }
+  return num_possible +
+         filterPossiblePortable(&pack_index[k], &pack_value[k],
+                                pack_count - k, move, move_out, tolerance,
+                                &possible[num_possible]);
+}
+
+HIGHS_AVX2 HighsInt chooseMeritAvx2(const double* infeasibility,
+                                    const double* weight, const HighsInt from,
+                                    const HighsInt to, double& best_merit,
+                                    HighsInt best_index) {
+  // Blocks of rows are only scanned if, for the current best merit,
+  // one of them would be chosen
+  const __m256d v_zero = _mm256_set1_pd(kHighsZero);
+  HighsInt iRow = from;
+  for (; iRow + 4 <= to; iRow += 4) {
+    const __m256d v_infeas = _mm256_loadu_pd(&infeasibility[iRow]);
+    const __m256d v_product =
+        _mm256_mul_pd(_mm256_set1_pd(best_merit),
+                      _mm256_loadu_pd(&weight[iRow]));
+    const __m256d v_choose =
+        _mm256_and_pd(_mm256_cmp_pd(v_infeas, v_zero, _CMP_GT_OQ),
+                      _mm256_cmp_pd(v_product, v_infeas, _CMP_LT_OQ));
+    if (!_mm256_movemask_pd(v_choose)) continue;
+    best_index = chooseMeritPortable(infeasibility, weight, iRow, iRow + 4,
+                                     best_merit, best_index);
+  }
+  return chooseMeritPortable(infeasibility, weight, iRow, to, best_merit,
+                             best_index);
+}
+
+HIGHS_AVX2 void tightAvx2(double* array, const HighsInt size) {
+  const __m256d v_tiny = _mm256_set1_pd(kHighsTiny);
+  const __m256d v_zero = _mm256_setzero_pd();
+  HighsInt k = 0;
+  for (; k + 4 <= size; k += 4) {
+    const __m256d v = _mm256_loadu_pd(&array[k]);
+    _mm256_storeu_pd(
+        &array[k],
+        _mm256_blendv_pd(v, v_zero,
+                         _mm256_cmp_pd(absAvx2(v), v_tiny, _CMP_LT_OQ)));
+  }
+  tightPortable(&array[k], size - k);
+}
+
+#undef HIGHS_AVX2
+#endif  // HIGHS_HAVE_AVX2_TARGET
+
+#ifdef HIGHS_HAVE_AVX512_TARGET
+#define HIGHS_AVX512 __attribute__((target("avx512f")))
+
+HIGHS_AVX512 inline __m512d gatherAvx512(const double* array,
+                                         const HighsInt* index) {
+#ifdef HIGHSINT64
+  return _mm512_i64gather_pd(_mm512_loadu_si512(index), array, 8);
+#else
+  return _mm512_i32gather_pd(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index)), array, 8);
+#endif
+}
+
+HIGHS_AVX512 inline void scatterAvx512(double* array, const HighsInt* index,
+                                       const __m512d v) {
+#ifdef HIGHSINT64
+  _mm512_i64scatter_pd(array, _mm512_loadu_si512(index), v, 8);
+#else
+  _mm512_i32scatter_pd(
+      array, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index)), v,
+      8);
+#endif
+}
+
+HIGHS_AVX512 void rowUpdateAvx512(double* result, const HighsInt* index,
+                                  const double* value, const HighsInt count,
+                                  const double multiplier) {
+  const __m512d v_multiplier = _mm512_set1_pd(multiplier);
+  const __m512d v_tiny = _mm512_set1_pd(kHighsTiny);
+  const __m512d v_zero = _mm512_set1_pd(kHighsZero);
+  HighsInt k = 0;
+  for (; k + 8 <= count; k += 8) {
+    const __m512d v = _mm512_add_pd(
+        gatherAvx512(result, &index[k]),
+        _mm512_mul_pd(v_multiplier, _mm512_loadu_pd(&value[k])));
+    const __mmask8 tiny =
+        _mm512_cmp_pd_mask(_mm512_abs_pd(v), v_tiny, _CMP_LT_OQ);
+    scatterAvx512(result, &index[k], _mm512_mask_blend_pd(tiny, v, v_zero));
+  }
+  rowUpdatePortable(result, &index[k], &value[k], count - k, multiplier);
+}
+
+HIGHS_AVX512 double sparseDotAvx512(const double* array,
+                                    const HighsInt* index,
+                                    const double* value,
+                                    const HighsInt count) {
+  double product[8];
+  double sum = 0;
+  HighsInt k = 0;
+  for (; k + 8 <= count; k += 8) {
+    _mm512_storeu_pd(product, _mm512_mul_pd(gatherAvx512(array, &index[k]),
+                                            _mm512_loadu_pd(&value[k])));
+    for (HighsInt j = 0; j < 8; j++) sum += product[j];
+  }
+  for (; k < count; k++) sum += array[index[k]] * value[k];
+  return sum;
+}
+
+HIGHS_AVX512 void gatherPackAvx512(const double* array, const HighsInt* index,
+                                   const HighsInt count, const HighsInt offset,
+                                   HighsInt* pack_index, double* pack_value) {
+  HighsInt k = 0;
+#ifdef HIGHSINT64
+  const __m512i v_offset = _mm512_set1_epi64(offset);
+  for (; k + 8 <= count; k += 8) {
+    const __m512i v_index = _mm512_loadu_si512(&index[k]);
+    _mm512_storeu_si512(&pack_index[k], _mm512_add_epi64(v_index, v_offset));
+    _mm512_storeu_pd(&pack_value[k], _mm512_i64gather_pd(v_index, array, 8));
+  }
+#else
+  const __m256i v_offset = _mm256_set1_epi32(offset);
+  for (; k + 8 <= count; k += 8) {
+    const __m256i v_index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&index[k]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&pack_index[k]),
+                        _mm256_add_epi32(v_index, v_offset));
+    _mm512_storeu_pd(&pack_value[k], _mm512_i32gather_pd(v_index, array, 8));
+  }
+#endif
+  gatherPackPortable(array, &index[k], count - k, offset, &pack_index[k],
+                     &pack_value[k]);
+}
+
+HIGHS_AVX512 HighsInt
+filterPossibleAvx512(const HighsInt* pack_index, const double* pack_value,
+                     const HighsInt pack_count, const int8_t* move,
+                     const HighsInt move_out, const double tolerance,
+                     std::pair<HighsInt, double>* possible) {
+  const __m512d v_move_out = _mm512_set1_pd(move_out);
+  const __m512d v_tolerance = _mm512_set1_pd(tolerance);
+  double alpha[8];
+  HighsInt num_possible = 0;
+  HighsInt k = 0;
+  for (; k + 8 <= pack_count; k += 8) {
+    const __m512d v_move = _mm512_set_pd(
+        move[pack_index[k + 7]], move[pack_index[k + 6]],
+        move[pack_index[k + 5]], move[pack_index[k + 4]],
+        move[pack_index[k + 3]], move[pack_index[k + 2]],
+        move[pack_index[k + 1]], move[pack_index[k]]);
+    const __m512d v_alpha = _mm512_mul_pd(
+        _mm512_mul_pd(_mm512_loadu_pd(&pack_value[k]), v_move_out), v_move);
+    const __mmask8 mask =
+        _mm512_cmp_pd_mask(v_alpha, v_tolerance, _CMP_GT_OQ);
+    if (!mask) continue;
+    _mm512_storeu_pd(alpha, v_alpha);
+    for (HighsInt j = 0; j < 8; j++)
+      if (mask & (1 << j))
+        possible[num_possible++] = std::make_pair(pack_index[k + j], alpha[j]);
+  }
+  return num_possible +
+         filterPossiblePortable(&pack_index[k], &pack_value[k],
+                                pack_count - k, move, move_out, tolerance,
+                                &possible[num_possible]);
+}
+
+HIGHS_AVX512 HighsInt chooseMeritAvx512(const double* infeasibility,
+                                        const double* weight,
+                                        const HighsInt from,
+                                        const HighsInt to, double& best_merit,
+                                        HighsInt best_index) {
+  const __m512d v_zero = _mm512_set1_pd(kHighsZero);
+  HighsInt iRow = from;
+  for (; iRow + 8 <= to; iRow += 8) {
+    const __m512d v_infeas = _mm512_loadu_pd(&infeasibility[iRow]);
+    const __m512d v_product = _mm512_mul_pd(_mm512_set1_pd(best_merit),
+                                            _mm512_loadu_pd(&weight[iRow]));
+    const __mmask8 choose =
+        _mm512_cmp_pd_mask(v_infeas, v_zero, _CMP_GT_OQ) &
+        _mm512_cmp_pd_mask(v_product, v_infeas, _CMP_LT_OQ);
+    if (!choose) continue;
+    best_index = chooseMeritPortable(infeasibility, weight, iRow, iRow + 8,
+                                     best_merit, best_index);
+  }
+  return chooseMeritPortable(infeasibility, weight, iRow, to, best_merit,
+                             best_index);
+}
+
+HIGHS_AVX512 void tightAvx512(double* array, const HighsInt size) {
+  const __m512d v_tiny = _mm512_set1_pd(kHighsTiny);
+  HighsInt k = 0;
+  for (; k + 8 <= size; k += 8) {
+    const __m512d v = _mm512_loadu_pd(&array[k]);
+    const __mmask8 tiny =
+        _mm512_cmp_pd_mask(_mm512_abs_pd(v), v_tiny, _CMP_LT_OQ);
+    _mm512_storeu_pd(&array[k], _mm512_maskz_mov_pd(~tiny, v));
+  }
+  tightPortable(&array[k], size - k);
+}
+
+#undef HIGHS_AVX512
+#endif  // HIGHS_HAVE_AVX512_TARGET
+
+HighsSimdLevel detectCpuLevel() {
+#if defined(HIGHS_HAVE_AVX2_TARGET) || defined(HIGHS_HAVE_AVX512_TARGET)
+  __builtin_cpu_init();
+#endif
+#ifdef HIGHS_HAVE_AVX512_TARGET
+  if (__builtin_cpu_supports("avx512f")) return HighsSimdLevel::kAvx512;
+#endif
+#ifdef HIGHS_HAVE_AVX2_TARGET
+  if (__builtin_cpu_supports("avx2")) return HighsSimdLevel::kAvx2;
+#endif
+  return HighsSimdLevel::kPortable;
+}
+
+HighsSimdKernels kernelsForLevel(const HighsSimdLevel level) {
+  HighsSimdKernels kernels{HighsSimdLevel::kPortable, rowUpdatePortable,
+                           sparseDotPortable,         gatherPackPortable,
+                           filterPossiblePortable,    chooseMeritPortable,
+                           tightPortable};
+#ifdef HIGHS_HAVE_AVX512_TARGET
+  if (level == HighsSimdLevel::kAvx512)
+    return HighsSimdKernels{level,
+                            rowUpdateAvx512,
+                            sparseDotAvx512,
+                            gatherPackAvx512,
+                            filterPossibleAvx512,
+                            chooseMeritAvx512,
+                            tightAvx512};
+#endif
+#ifdef HIGHS_HAVE_AVX2_TARGET
+  if (level == HighsSimdLevel::kAvx2)
+    return HighsSimdKernels{level,           rowUpdateAvx2,
+                            sparseDotAvx2,   gatherPackAvx2,
+                            filterPossibleAvx2, chooseMeritAvx2,
+                            tightAvx2};
+#endif
+  return kernels;
+}
+
+HighsSimdKernels& activeKernels() {
+  static HighsSimdKernels kernels = kernelsForLevel(highsSimdCpuLevel());
+  return kernels;
+}
+
+}  // namespace
+
+HighsSimdLevel highsSimdCpuLevel() {
+  static const HighsSimdLevel level = detectCpuLevel();
+  return level;
+}
+
+HighsSimdLevel highsSimdLevel() { return activeKernels().level; }
+
+HighsSimdLevel highsSimdSetLevel(const HighsSimdLevel level) {
+  activeKernels() = kernelsForLevel(std::min(level, highsSimdCpuLevel()));
+  return highsSimdLevel();
+}
+
+std::string highsSimdLevelToString(const HighsSimdLevel level) {
+  switch (level) {
+    case HighsSimdLevel::kAvx512:
+      return "AVX-512";
+    case HighsSimdLevel::kAvx2:
+      return "AVX2";
+    default:
+      return "portable";
+  }
+}
+
+void highsSimdRowUpdate(double* result, const HighsInt* index,
+                        const double* value, const HighsInt count,
+                        const double multiplier) {
+  activeKernels().row_update(result, index, value, count, multiplier);
+}
+
+void highsSimdRowUpdateRange(double* result, const HighsInt* index,
+                             const double* value, const HighsInt count,
+                             const double multiplier, const HighsInt from,
+                             const HighsInt to) {
+  for (HighsInt k = 0; k < count; k++) {
+    const HighsInt iCol = index[k];
+    if (iCol < from || iCol >= to) continue;
+    const double value1 = result[iCol] + multiplier * value[k];
+    result[iCol] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+}
+
+double highsSimdSparseDot(const double* array, const HighsInt* index,
+                          const double* value, const HighsInt count) {
+  return activeKernels().sparse_dot(array, index, value, count);
+}
+
+void highsSimdGatherPack(const double* array, const HighsInt* index,
+                         const HighsInt count, const HighsInt offset,
+                         HighsInt* pack_index, double* pack_value) {
+  activeKernels().gather_pack(array, index, count, offset, pack_index,
+                              pack_value);
+}
+
+HighsInt highsSimdFilterPossible(const HighsInt* pack_index,
+                                 const double* pack_value,
+                                 const HighsInt pack_count,
+                                 const int8_t* move, const HighsInt move_out,
+                                 const double tolerance,
+                                 std::pair<HighsInt, double>* possible) {
+  return activeKernels().filter_possible(pack_index, pack_value, pack_count,
+                                         move, move_out, tolerance, possible);
+}
+
+HighsInt highsSimdChooseMerit(const double* infeasibility,
+                              const double* weight, const HighsInt from,
+                              const HighsInt to, double& best_merit,
+                              HighsInt best_index) {
+  return activeKernels().choose_merit(infeasibility, weight, from, to,
+                                      best_merit, best_index);
+}
+
+void highsSimdTight(double* array, const HighsInt size) {
+  activeKernels().tight(array, size);
+}
@@ -0,0 +1,91 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsSimd.h
+ * @brief Vectorized kernels for simplex pricing and CHUZC/CHUZR,
+ * selected at run time according to the instructions that the CPU
+ * supports
+ */
+#ifndef UTIL_HIGHSSIMD_H_
+#define UTIL_HIGHSSIMD_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "util/HighsInt.h"
+
+enum class HighsSimdLevel { kPortable = 0, kAvx2, kAvx512 };
+
+// The highest level of kernels that the CPU supports, determined once
+HighsSimdLevel highsSimdCpuLevel();
+
+// The level of the kernels in use
+HighsSimdLevel highsSimdLevel();
+
+// Use the kernels of the given level, if the CPU supports it, or the
+// highest level that it supports. Returns the level in use. Not to be
+// called while kernels are running
+HighsSimdLevel highsSimdSetLevel(const HighsSimdLevel level);
+
+std::string highsSimdLevelToString(const HighsSimdLevel level);
+
+// The kernels give the same results at every level, since they
+// perform the same floating-point operations in the same order as the
+// portable kernels
+
+// result[index[k]] += multiplier * value[k] for k < count, with
+// results less than kHighsTiny in magnitude replaced by kHighsZero.
+// The entries of index must be distinct
+void highsSimdRowUpdate(double* result, const HighsInt* index,
+                        const double* value, const HighsInt count,
+                        const double multiplier);
+
+// As highsSimdRowUpdate, but only for from <= index[k] < to, so that
+// the update of a row can be partitioned by columns. There is no
+// vectorized version, but the rounding is that of highsSimdRowUpdate
+void highsSimdRowUpdateRange(double* result, const HighsInt* index,
+                             const double* value, const HighsInt count,
+                             const double multiplier, const HighsInt from,
+                             const HighsInt to);
+
+// Sum of array[index[k]] * value[k] for k < count, accumulated in
+// order of k
+double highsSimdSparseDot(const double* array, const HighsInt* index,
+                          const double* value, const HighsInt count);
+
+// pack_value[k] = array[index[k]] and pack_index[k] = index[k] +
+// offset for k < count
+void highsSimdGatherPack(const double* array, const HighsInt* index,
+                         const HighsInt count, const HighsInt offset,
+                         HighsInt* pack_index, double* pack_value);
+
+// Store (pack_index[k], alpha) in possible, in order of k, for which
+// alpha = pack_value[k] * move_out * move[pack_index[k]] exceeds
+// tolerance, returning the number stored
+HighsInt highsSimdFilterPossible(const HighsInt* pack_index,
+                                 const double* pack_value,
+                                 const HighsInt pack_count,
+                                 const int8_t* move, const HighsInt move_out,
+                                 const double tolerance,
+                                 std::pair<HighsInt, double>* possible);
+
+// Scan infeasibility[i] / weight[i] for from <= i < to, in order,
+// updating best_merit and returning best_index when a positive
+// infeasibility has a greater merit
+HighsInt highsSimdChooseMerit(const double* infeasibility,
+                              const double* weight, const HighsInt from,
+                              const HighsInt to, double& best_merit,
+                              HighsInt best_index);
+
+// Zero the values in array less than kHighsTiny in magnitude
+void highsSimdTight(double* array, const HighsInt size);
+
+#endif  // UTIL_HIGHSSIMD_H_
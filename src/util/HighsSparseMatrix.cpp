@@ -17,12 +17,63 @@
 #include <cassert>
 #include <cmath>
 
+#include "parallel/HighsParallel.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
+#include "util/HighsSimd.h"
 #include "util/HighsSort.h"
 #include "util/HighsSparseVectorSum.h"
 
 using std::fabs;
+
+// Minimum number of columns in each partition for parallel PRICE
+const HighsInt kParallelPriceGrain = 4096;
+
+// Whether there are enough columns and threads for parallel PRICE
+static bool useParallelPrice(const HighsInt num_col) {
+  return num_col >= 2 * kParallelPriceGrain &&
+         HighsTaskExecutor::getThisWorkerDeque() != nullptr &&
+         highs::parallel::num_threads() > 1;
+}
+
+// Zero the values in result that are tiny and form the indices of
+// its nonzeros, in order, by partitioning the columns across threads
+static void parallelCollectNonzeros(HVector& result, const HighsInt num_col) {
+  const HighsInt num_chunk =
+      (num_col + kParallelPriceGrain - 1) / kParallelPriceGrain;
+  std::vector<HighsInt> chunk_start(num_chunk + 1, 0);
+  highs::parallel::for_each(
+      0, num_chunk, [&](HighsInt from_chunk, HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++) {
+          const HighsInt to_col =
+              std::min(num_col, (chunk + 1) * kParallelPriceGrain);
+          HighsInt count = 0;
+          for (HighsInt iCol = chunk * kParallelPriceGrain; iCol < to_col;
+               iCol++) {
+            if (fabs(result.array[iCol]) < kHighsTiny) {
+              result.array[iCol] = 0;
+            } else {
+              count++;
+            }
+          }
+          chunk_start[chunk + 1] = count;
+        }
+      });
+  for (HighsInt chunk = 0; chunk < num_chunk; chunk++)
+    chunk_start[chunk + 1] += chunk_start[chunk];
+  highs::parallel::for_each(
+      0, num_chunk, [&](HighsInt from_chunk, HighsInt to_chunk) {
+        for (HighsInt chunk = from_chunk; chunk < to_chunk; chunk++) {
+          const HighsInt to_col =
+              std::min(num_col, (chunk + 1) * kParallelPriceGrain);
+          HighsInt count = chunk_start[chunk];
+          for (HighsInt iCol = chunk * kParallelPriceGrain; iCol < to_col;
+               iCol++)
+            if (result.array[iCol]) result.index[count++] = iCol;
+        }
+      });
+  result.count = chunk_start[num_chunk];
+}
 using std::max;
 using std::min;
 using std::swap;
@@ -1330,9 +1381,10 @@ void HighsSparseMatrix::priceByColumn(const bool quad_precision,
         quad_value += column.array[this->index_[iEl]] * this->value_[iEl];
       value = (double)quad_value;
     } else {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        value += column.array[this->index_[iEl]] * this->value_[iEl];
+      const HighsInt from_iEl = this->start_[iCol];
+      value = highsSimdSparseDot(
+          column.array.data(), &this->index_.data()[from_iEl],
+          &this->value_.data()[from_iEl], this->start_[iCol + 1] - from_iEl);
     }
     if (fabs(value) > kHighsTiny) {
       result.array[iCol] = value;
@@ -1341,6 +1393,30 @@ void HighsSparseMatrix::priceByColumn(const bool quad_precision,
   }
 }
 
+void HighsSparseMatrix::parallelPriceByColumn(HVector& result,
+                                              const HVector& column) const {
+  assert(this->isColwise());
+  if (!useParallelPrice(this->num_col_)) {
+    const bool quad_precision = false;
+    this->priceByColumn(quad_precision, result, column);
+    return;
+  }
+  highs::parallel::for_each(
+      0, this->num_col_,
+      [&](HighsInt from_col, HighsInt to_col) {
+        for (HighsInt iCol = from_col; iCol < to_col; iCol++) {
+          const HighsInt from_iEl = this->start_[iCol];
+          const double value = highsSimdSparseDot(
+              column.array.data(), &this->index_.data()[from_iEl],
+              &this->value_.data()[from_iEl],
+              this->start_[iCol + 1] - from_iEl);
+          result.array[iCol] = fabs(value) > kHighsTiny ? value : 0;
+        }
+      },
+      kParallelPriceGrain);
+  parallelCollectNonzeros(result, this->num_col_);
+}
+
 void HighsSparseMatrix::priceByRow(const bool quad_precision, HVector& result,
                                    const HVector& column,
                                    const HighsInt debug_report) const {
@@ -1362,7 +1438,8 @@ void HighsSparseMatrix::priceByRow(const bool quad_precision, HVector& result,
 void HighsSparseMatrix::priceByRowWithSwitch(
     const bool quad_precision, HVector& result, const HVector& column,
     const double expected_density, const HighsInt from_index,
-    const double switch_density, const HighsInt debug_report) const {
+    const double switch_density, const HighsInt debug_report,
+    const bool parallel) const {
   assert(this->isRowwise());
   HighsSparseVectorSum sum;
   // todo @Julian: Setting up the sparse vector sum is equivalent to calling
@@ -1438,6 +1515,9 @@ void HighsSparseMatrix::priceByRowWithSwitch(
           result.index[result.count++] = iCol;
         }
       }
+    } else if (parallel && useParallelPrice(this->num_col_)) {
+      this->parallelPriceByRowDenseResult(result.array, column, next_index);
+      parallelCollectNonzeros(result, this->num_col_);
     } else {
       this->priceByRowDenseResult(result.array, column, next_index);
       // Determine indices of nonzeros in result
@@ -1559,15 +1639,52 @@ void HighsSparseMatrix::priceByRowDenseResult(
     }
     if (debug_report == kDebugReportAll || debug_report == iRow)
       debugReportRowPrice(iRow, multiplier, to_iEl, result);
-    for (HighsInt iEl = this->start_[iRow]; iEl < to_iEl; iEl++) {
-      HighsInt iCol = this->index_[iEl];
-      double value0 = result[iCol];
-      double value1 = value0 + multiplier * this->value_[iEl];
-      result[iCol] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
-    }
+    const HighsInt from_iEl = this->start_[iRow];
+    highsSimdRowUpdate(result.data(), &this->index_.data()[from_iEl],
+                       &this->value_.data()[from_iEl], to_iEl - from_iEl,
+                       multiplier);
   }
 }
 
+void HighsSparseMatrix::parallelPriceByRowDenseResult(
+    std::vector<double>& result, const HVector& column,
+    const HighsInt from_index) const {
+  // Assumes that result is zeroed beforehand - in case continuing
+  // priceByRow after switch from sparse
+  //
+  // Each thread updates the values for a range of columns, and
+  // applies the rows in the same order as priceByRowDenseResult, so
+  // the result is identical. Since all the rows are scanned by each
+  // thread, there is one range per thread
+  assert(this->isRowwise());
+  const HighsInt num_range =
+      std::min(HighsInt(highs::parallel::num_threads()),
+               this->num_col_ / kParallelPriceGrain);
+  const HighsInt range_size = (this->num_col_ + num_range - 1) / num_range;
+  highs::parallel::for_each(
+      0, num_range,
+      [&](HighsInt from_range, HighsInt to_range) {
+        const HighsInt from_col = from_range * range_size;
+        const HighsInt to_col =
+            std::min(this->num_col_, to_range * range_size);
+        for (HighsInt ix = from_index; ix < column.count; ix++) {
+          HighsInt iRow = column.index[ix];
+          HighsInt to_iEl;
+          if (this->format_ == MatrixFormat::kRowwisePartitioned) {
+            to_iEl = this->p_end_[iRow];
+          } else {
+            to_iEl = this->start_[iRow + 1];
+          }
+          const HighsInt from_iEl = this->start_[iRow];
+          highsSimdRowUpdateRange(
+              result.data(), &this->index_.data()[from_iEl],
+              &this->value_.data()[from_iEl], to_iEl - from_iEl,
+              column.array[iRow], from_col, to_col);
+        }
+      },
+      1);
+}
+
 void HighsSparseMatrix::priceByRowDenseResult(
     std::vector<HighsCDouble>& result, const HVector& column,
     const HighsInt from_index, const HighsInt debug_report) const {
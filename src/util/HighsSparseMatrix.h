@@ -112,7 +112,11 @@ class HighsSparseMatrix {
       const bool quad_precision, HVector& result, const HVector& column,
       const double expected_density, const HighsInt from_index,
       const double switch_density,
-      const HighsInt debug_report = kDebugReportOff) const;
+      const HighsInt debug_report = kDebugReportOff,
+      const bool parallel = false) const;
+  // Column-wise PRICE with the columns partitioned across threads,
+  // giving the same result as priceByColumn without quad precision
+  void parallelPriceByColumn(HVector& result, const HVector& column) const;
   void update(const HighsInt var_in, const HighsInt var_out,
               const HighsSparseMatrix& matrix);
   double computeDot(const HVector& column, const HighsInt use_col) const {
@@ -133,6 +137,9 @@ class HighsSparseMatrix {
       std::vector<HighsCDouble>& result, const HVector& column,
       const HighsInt from_index,
       const HighsInt debug_report = kDebugReportOff) const;
+  void parallelPriceByRowDenseResult(std::vector<double>& result,
+                                     const HVector& column,
+                                     const HighsInt from_index) const;
   void debugReportRowPrice(const HighsInt iRow, const double multiplier,
                            const HighsInt to_iEl,
                            const vector<double>& result) const;